@@ -0,0 +1,140 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+#include "checkpoint.hpp"
+#include "fixture.hpp"
+#include "ruleset.hpp"
+#include "stream.hpp"
+
+// Stopping a streamed flight and going on in a new scorer. The flight is scored
+// once without a break, then again stopped at several places, saved, restored
+// and read to its end. Every run must report the same thermals and rankings.
+// Reports the size of the snapshots and the time to write and read them, over
+// the recorded flight and one made of appended copies of it.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using rules_t = ruleset::akaflieg_dresden;
+
+struct handler_t {
+	std::vector<stream::record_t>* thermals;
+	void start(const airport_t&) {}
+	void thermal(const stream::record_t& r) {
+		thermals->push_back(r);
+	}
+};
+
+using scorer_t = stream::scorer_t<rules_t, sample_t, handler_t>;
+
+struct outcome_t {
+	std::vector<stream::record_t> thermals;
+	stream::result_t result;
+};
+
+bool same(const stream::record_t& a, const stream::record_t& b) {
+	return a.begin.count() == b.begin.count() && a.end.count() == b.end.count() && a.points == b.points && a.local == b.local && a.remote == b.remote;
+}
+
+bool same(const stream::ranking_t& a, const stream::ranking_t& b) {
+	const bool windows = a.max_window.has_value() == b.max_window.has_value() && (!a.max_window || (a.max_window->first.count() == b.max_window->first.count() && a.max_window->second.count() == b.max_window->second.count()));
+	return a.max_points == b.max_points && windows && a.strongest.has_value() == b.strongest.has_value() && (!a.strongest || same(*a.strongest, *b.strongest));
+}
+
+bool same(const outcome_t& a, const outcome_t& b) {
+	bool equal = a.thermals.size() == b.thermals.size();
+	for(std::size_t i = 0; equal && i < a.thermals.size(); ++i) equal &= same(a.thermals[i], b.thermals[i]);
+	return equal && same(a.result.local, b.result.local) && same(a.result.remote, b.result.remote) && a.result.parse.records == b.result.parse.records;
+}
+
+struct timing_t {
+	std::size_t bytes = 0;
+	double save_ms = 0;
+	double restore_ms = 0;
+};
+
+// Scores lines, stopped after stop of them unless stop is lines.size().
+outcome_t score(const std::vector<std::string_view>& lines, std::size_t stop, timing_t& timing) {
+	outcome_t outcome;
+	std::string snapshot;
+	{
+		scorer_t scorer(parser::policy_t::skip, handler_t{ &outcome.thermals });
+		for(std::size_t i = 0; i < stop; ++i) scorer.line(lines[i]);
+		if(stop == lines.size()) {
+			outcome.result = scorer.finish();
+			return outcome;
+		}
+		const auto start = std::chrono::steady_clock::now();
+		checkpoint::writer_t out;
+		scorer.save(out);
+		snapshot = out.data();
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		timing.save_ms = elapsed.count();
+	}
+
+	scorer_t scorer(parser::policy_t::skip, handler_t{ &outcome.thermals });
+	const auto start = std::chrono::steady_clock::now();
+	checkpoint::reader_t in(snapshot);
+	const bool restored = scorer.restore(in) && in.empty();
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	timing.restore_ms = elapsed.count();
+	timing.bytes = snapshot.size();
+	if(!restored) return outcome_t{};
+
+	for(std::size_t i = stop; i < lines.size(); ++i) scorer.line(lines[i]);
+	outcome.result = scorer.finish();
+	return outcome;
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 8;
+	const std::size_t stops = argc > 3 ? std::atoi(argv[3]) : 16;
+
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+
+	const std::string text(file.view());
+	const std::string repeated = fixture::lengthen(text, copies);
+
+	bool equal = true;
+	for(const std::string* flight : { &text, &repeated }) {
+		std::vector<std::string_view> lines;
+		for(std::string_view rest = *flight; !rest.empty();) {
+			const auto end = std::min(rest.find('\n'), rest.size());
+			lines.push_back(rest.substr(0, end));
+			rest.remove_prefix(std::min(end + 1, rest.size()));
+		}
+
+		timing_t unused;
+		const auto whole = score(lines, lines.size(), unused);
+
+		timing_t worst;
+		for(std::size_t s = 1; s <= stops; ++s) {
+			timing_t timing;
+			const auto resumed = score(lines, lines.size() * s / (stops + 1), timing);
+			equal &= same(whole, resumed);
+			worst.bytes = std::max(worst.bytes, timing.bytes);
+			worst.save_ms = std::max(worst.save_ms, timing.save_ms);
+			worst.restore_ms = std::max(worst.restore_ms, timing.restore_ms);
+		}
+
+		std::cout
+			<< lines.size() << " Zeilen, " << whole.thermals.size() << " Bärte, " << stops << " Unterbrechungen" << std::endl
+			<< "  Sicherung höchstens " << worst.bytes << " Bytes" << std::endl
+			<< "  Schreiben höchstens " << worst.save_ms << " ms, Lesen höchstens " << worst.restore_ms << " ms" << std::endl;
+	}
+	return fixture::verdict(equal);
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <parser.hpp>
+
+#include "fixture.hpp"
+#include "circling.hpp"
+#include "detection.hpp"
+#include "ruleset.hpp"
+
+// Cost of following the circles during detection. Detection runs over a flight
+// alone and with a circling::tracker_t for many short rounds, the best round of
+// each is shown. A longer flight is made of appended copies of a recorded one,
+// each shifted to start where the previous ended. Fails if the circles cost
+// more than budget percent of detection.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using iterator_t = std::vector<sample_t>::const_iterator;
+using rules_t = ruleset::akaflieg_dresden;
+
+constexpr double budget = 10;
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 1;
+	const std::size_t rounds = argc > 3 ? std::atoi(argv[3]) : 100;
+
+	std::vector<sample_t> flight;
+	if(!fixture::load(path, flight) || copies == 0 || rounds == 0) return 1;
+
+	const auto samples = fixture::lengthen(flight, copies);
+
+	// Each round times both, in turn first, so a slow spell of the machine
+	// hits both alike. Long rounds let it hit one only. The overhead is taken
+	// from the totals of all rounds.
+	double alone = 1e300, tracked = 1e300;
+	double total[2] = { 0, 0 };
+	std::size_t thermals_alone = 0, thermals_tracked = 0, circles = 0;
+	for(std::size_t r = 0; r < rounds; ++r) {
+		double round[2];
+		for(std::size_t i = 0; i < 2; ++i) {
+			const bool track = (r + i) % 2;
+			std::vector<thermal_t<iterator_t>> thermals;
+			circling::tracker_t tracker;
+			const auto start = std::chrono::steady_clock::now();
+			if(track) {
+				detection::detect<rules_t>(samples.cbegin(), samples.cend(), std::back_inserter(thermals), nullptr, &tracker);
+			} else {
+				detection::detect<rules_t>(samples.cbegin(), samples.cend(), std::back_inserter(thermals));
+			}
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			round[track] = elapsed.count();
+			if(track) {
+				thermals_tracked = thermals.size();
+				circles = tracker.result().size();
+			} else {
+				thermals_alone = thermals.size();
+			}
+		}
+		alone = std::min(alone, round[0]);
+		tracked = std::min(tracked, round[1]);
+		total[0] += round[0];
+		total[1] += round[1];
+	}
+
+	const double overhead = 100 * (total[1] - total[0]) / total[0];
+	std::cout
+		<< samples.size() << " Fixes, " << thermals_alone << " Bärte, " << circles << " Kreise" << std::endl
+		<< "Erkennung:             " << alone << " ms" << std::endl
+		<< "Erkennung mit Kreisen: " << tracked << " ms" << std::endl
+		<< "Aufschlag:             " << overhead << " %" << std::endl;
+	if(thermals_alone != thermals_tracked) {
+		std::cerr << "Mit Kreisen " << thermals_tracked << " statt " << thermals_alone << " Bärte." << std::endl;
+		return 1;
+	}
+	if(overhead > budget) {
+		std::cerr << "Kreise kosten mehr als " << budget << " % der Erkennung." << std::endl;
+		return 1;
+	}
+	return 0;
+}
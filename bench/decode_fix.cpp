@@ -0,0 +1,177 @@
+#include <iostream>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+// Decodes the fixed columns of every B record of a file many times, through
+// std::string and std::stoi as units::gps_position(const std::string&, ...)
+// does, digit by digit as parser::decode_fixed and eight digits at a time as
+// parser::swar::decode_fixed, and reports nanoseconds per record. Beforehand
+// checks that both take a minus only where a value may be negative and that the
+// diagnostics of a record name the column of a misplaced one.
+
+struct totals_t {
+	std::int64_t sum = 0;
+	std::size_t invalid = 0;
+};
+
+void add(totals_t& totals, const parser::fixed_columns_t& c) {
+	totals.sum += c.hour * 3600 + c.minute * 60 + c.second;
+	totals.sum += (c.lat_deg * 60000 + c.lat_min) ^ (c.lon_deg * 60000 + c.lon_min);
+	totals.sum += c.altitude;
+}
+
+totals_t with_strings(const std::vector<std::string_view>& lines) {
+	totals_t totals;
+	for(auto line : lines) {
+		const std::string text(line);
+		const units::gps_position position(text.substr(7, 8), text.substr(15, 9));
+		parser::fixed_columns_t c;
+		c.hour = std::stoi(text.substr(1, 2));
+		c.minute = std::stoi(text.substr(3, 2));
+		c.second = std::stoi(text.substr(5, 2));
+		// Both directions are N and E in the benchmark data, see main.
+		const std::int32_t lat = position.latitude_milliminutes();
+		const std::int32_t lon = position.longitude_milliminutes();
+		c.lat_deg = lat / 60000;
+		c.lat_min = lat % 60000;
+		c.lon_deg = lon / 60000;
+		c.lon_min = lon % 60000;
+		c.altitude = std::stoi(text.substr(25, 5));
+		add(totals, c);
+	}
+	return totals;
+}
+
+template <bool (*decode)(std::string_view, parser::fixed_columns_t&)>
+totals_t with(const std::vector<std::string_view>& lines) {
+	totals_t totals;
+	for(auto line : lines) {
+		parser::fixed_columns_t c;
+		if(decode(line, c)) {
+			add(totals, c);
+		} else {
+			++totals.invalid;
+		}
+	}
+	return totals;
+}
+
+// A record of the sample flight with a minus put into one column.
+struct case_t {
+	// One based column of the minus, 0 for the record as it is.
+	std::size_t column;
+	// Column the diagnostic names, 0 if the record is valid.
+	std::size_t expected;
+};
+
+bool check() {
+	using sample_t = parser::record<parser::field::true_air_speed, parser::field::total_energy_vario>;
+	parser::layout_t<parser::field::true_air_speed, parser::field::total_energy_vario> layout;
+	layout.declare("I093638FXA3941ENL4246TAS4751GSP5254HDT5557TRT5862VAT6366OAT6770ACZ");
+	const std::string record = "B0936555129467N01352286EA00136001000060020000000002068079-000201750100";
+
+	const std::vector<case_t> cases {
+		{ 0, 0 },
+		// Time, latitude and longitude are never negative.
+		{ 2, 2 }, { 7, 7 }, { 8, 8 }, { 10, 10 }, { 16, 16 }, { 19, 19 },
+		// The pressure altitude only in its first column.
+		{ 26, 0 }, { 27, 27 }, { 30, 30 },
+		// TAS is never negative, the vario only in its first column.
+		{ 42, 42 }, { 59, 59 }
+	};
+
+	bool passed = true;
+	for(const auto& test : cases) {
+		std::string line = record;
+		if(test.column > 0) line[test.column - 1] = '-';
+
+		parser::fixed_columns_t scalar{}, swar{};
+		const bool scalar_valid = parser::decode_fixed(line, scalar);
+		const bool swar_valid = parser::swar::enabled && parser::swar::decode_fixed(line, swar);
+		const bool fixed_valid = test.expected == 0 || test.expected > 35;
+		sample_t s;
+		const auto diagnostic = layout.decode(line, s);
+
+		bool ok = scalar_valid == fixed_valid && diagnostic.column == test.expected;
+		// SWAR takes plain digits only and then agrees with the scalar path.
+		ok &= !(swar_valid && test.column == 26);
+		ok &= !swar_valid || (scalar_valid &&
+			swar.hour == scalar.hour && swar.minute == scalar.minute && swar.second == scalar.second &&
+			swar.lat_deg == scalar.lat_deg && swar.lat_min == scalar.lat_min &&
+			swar.lon_deg == scalar.lon_deg && swar.lon_min == scalar.lon_min &&
+			swar.altitude == scalar.altitude);
+		if(test.column == 26) ok &= scalar.altitude == -136;
+		if(test.expected == 0) ok &= s.total_energy_vario.to<double>() == -0.02;
+		if(!ok) {
+			std::cerr << "Minus in Spalte " << test.column << ": Diagnose Spalte " << diagnostic.column << ", erwartet " << test.expected << std::endl;
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+
+	std::vector<std::string_view> lines;
+	auto text = file.view();
+	while(!text.empty()) {
+		auto end = text.find('\n');
+		auto line = text.substr(0, end);
+		if(line.size() >= 35 && line[0] == 'B' && line[14] == 'N' && line[23] == 'E') {
+			lines.push_back(line);
+		}
+		text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+	}
+	if(lines.empty()) {
+		std::cerr << "Keine B-Datensätze in " << path << "." << std::endl;
+		return 1;
+	}
+
+	if(!parser::swar::enabled) {
+		std::cerr << "SWAR nicht verfügbar, swar misst decode_fixed." << std::endl;
+	}
+
+	const bool checked = check();
+	std::cout << (checked ? "Prüfungen bestanden" : "Prüfungen FEHLGESCHLAGEN") << std::endl;
+
+	const std::vector<std::pair<const char*, std::function<totals_t()>>> variants {
+		{ "string", [&]() { return with_strings(lines); } },
+		{ "skalar", [&]() { return with<parser::decode_fixed>(lines); } },
+		{ "swar", [&]() { return parser::swar::enabled ? with<parser::swar::decode_fixed>(lines) : with<parser::decode_fixed>(lines); } }
+	};
+
+	std::cout << "Verfahren;Datensätze;ungültig;Prüfsumme;ns/Datensatz" << std::endl;
+	for(const auto& [name, run] : variants) {
+		totals_t totals;
+		const auto start = std::chrono::steady_clock::now();
+		for(std::size_t r = 0; r < rounds; ++r) {
+			totals = run();
+		}
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		std::cout
+			<< name << ";"
+			<< lines.size() << ";"
+			<< totals.invalid << ";"
+			<< totals.sum << ";"
+			<< elapsed.count() / (rounds * lines.size()) << std::endl;
+	}
+
+	return checked ? 0 : 1;
+}
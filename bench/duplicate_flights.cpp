@@ -0,0 +1,106 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+#include "fingerprint.hpp"
+
+// Finding a flight again. The recorded flight stands for a re-upload, a copy
+// logged at a quarter of the rate with a few meters of noise and another
+// pressure setting for the second logger of a two-seater. The index holds many
+// other flights, copies moved to other places and times of the day, and is
+// searched for each of them.
+
+struct sample_t : parser::record<> {};
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t flights = argc > 2 ? std::atoi(argv[2]) : 10000;
+
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+	std::vector<sample_t> flight;
+	parser::parse_parallel(file.view(), flight, parser::policy_t::skip, 1);
+	if(flight.size() < 2) {
+		std::cerr << "Kein Flug in " << path << "." << std::endl;
+		return 1;
+	}
+
+	std::mt19937 random(1);
+	std::uniform_int_distribution<int> jitter(-3, 3);
+	std::vector<sample_t> second;
+	for(std::size_t i = 0; i < flight.size(); i += 4) {
+		auto s = flight[i];
+		s.position = units::gps_position::from_milliminutes(s.position.latitude_milliminutes() + jitter(random), s.position.longitude_milliminutes() + jitter(random));
+		s.altitude = units::altitude(s.altitude.count() + 40 + jitter(random));
+		second.push_back(s);
+	}
+
+	// Another flight: moved by dlat, dlon milliminutes and dt seconds.
+	auto moved = [&](std::int32_t dlat, std::int32_t dlon, std::int32_t dt) {
+		std::vector<sample_t> result = flight;
+		for(auto& s : result) {
+			s.position = units::gps_position::from_milliminutes(s.position.latitude_milliminutes() + dlat, s.position.longitude_milliminutes() + dlon);
+			s.time = units::timestamp((s.time.count() + dt) % units::timestamp::day);
+		}
+		return result;
+	};
+
+	fingerprint::index_t index;
+	std::uniform_int_distribution<int> place(-60000, 60000), time(0, units::timestamp::day - 1);
+	double sketching = 0;
+	for(std::size_t i = 0; i < flights; ++i) {
+		const auto other = moved(place(random), place(random), time(random));
+		const auto start = std::chrono::steady_clock::now();
+		const auto sketch = fingerprint::sketch(other.begin(), other.end());
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		sketching += elapsed.count();
+		index.add("anderer_" + std::to_string(i), sketch);
+	}
+	index.add(path, fingerprint::sketch(flight.begin(), flight.end()));
+
+	const auto same = fingerprint::sketch(flight.begin(), flight.end());
+	const auto twin = fingerprint::sketch(second.begin(), second.end());
+	const auto near = moved(2000, 0, 0);
+	const auto neighbour = fingerprint::sketch(near.begin(), near.end());
+	const auto later = moved(0, 0, 1800);
+	const auto afterwards = fingerprint::sketch(later.begin(), later.end());
+
+	const double threshold = 0.7;
+	std::size_t found = 0;
+	double lookup = 1e300;
+	for(int round = 0; round < 5; ++round) {
+		const auto start = std::chrono::steady_clock::now();
+		for(const auto* s : { &same, &twin, &neighbour, &afterwards }) {
+			found += index.find(*s, threshold).name != nullptr;
+		}
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		lookup = std::min(lookup, elapsed.count() / 4);
+	}
+
+	auto report = [&](const char* name, const fingerprint::sketch_t& s) {
+		const auto match = index.find(s, threshold);
+		std::cout << name << ": Ähnlichkeit " << same.similarity(s) << ", " << (match.name ? "gefunden als " + *match.name : std::string("nicht gefunden")) << std::endl;
+	};
+
+	std::cout << index.size() << " Flüge im Index, " << same.cells << " Zellen je Flug" << std::endl;
+	report("Erneut hochgeladen      ", same);
+	report("Zweiter Logger          ", twin);
+	report("3,7 km nördlich         ", neighbour);
+	report("30 min später           ", afterwards);
+	std::cout
+		<< "Fingerabdruck: " << sketching / flights << " ms je Flug mit " << flight.size() << " Fixes" << std::endl
+		<< "Suche:         " << lookup << " ms" << std::endl;
+	return found == 5 * 2 ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+#include <iostream>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+#include "emit.hpp"
+#include "fixture.hpp"
+#include "ruleset.hpp"
+#include "stream.hpp"
+
+// Writes the thermals of a long flight in every output format to /dev/null and
+// reports nanoseconds per thermal. Beforehand checks that a value that is not
+// finite is null in JSON Lines and an empty field in CSV, as neither can hold
+// inf or nan.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using rules_t = ruleset::akaflieg_dresden;
+
+struct handler_t {
+	std::vector<stream::record_t>* thermals;
+	void start(const airport_t&) {}
+	void thermal(const stream::record_t& r) {
+		thermals->push_back(r);
+	}
+};
+
+// Output of one thermal in the given format, without the CSV header.
+std::string written(emit::format_t format, const stream::record_t& r) {
+	std::FILE* file = std::tmpfile();
+	if(!file) return std::string();
+	{
+		io::writer out(::fileno(file));
+		const auto emitter = emit::make(format, out);
+		emitter->file("f", false);
+		emitter->thermal(r);
+	}
+	std::string text;
+	std::rewind(file);
+	for(int c; (c = std::fgetc(file)) != EOF;) text.push_back(static_cast<char>(c));
+	std::fclose(file);
+	if(format == emit::format_t::csv) text.erase(0, text.find('\n') + 1);
+	return text;
+}
+
+bool check() {
+	const stream::record_t r {
+		units::timestamp(3600),
+		units::timestamp(3700),
+		units::length::meter_t(std::numeric_limits<double>::infinity()),
+		units::velocity::meters_per_second_t(std::numeric_limits<double>::quiet_NaN()),
+		1.5,
+		true,
+		false
+	};
+	const std::vector<std::pair<emit::format_t, std::string>> expected {
+		{ emit::format_t::csv, "f,bart,,01:00:00,01:01:40,,,1.5,1,0\n" },
+		{ emit::format_t::jsonl, "{\"datei\":\"f\",\"art\":\"bart\",\"von\":\"01:00:00\",\"bis\":\"01:01:40\",\"tek_hoehe\":null,\"steigen\":null,\"punkte\":1.5,\"lokal\":true,\"ueberland\":false}\n" }
+	};
+	bool passed = true;
+	for(const auto& [format, text] : expected) {
+		const auto output = written(format, r);
+		if(output != text) {
+			std::cerr << "Erwartet " << text << "Geschrieben " << output;
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 8;
+	const std::size_t rounds = argc > 3 ? std::atoi(argv[3]) : 20;
+
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+
+	const bool checked = check();
+	std::cout << (checked ? "Prüfungen bestanden" : "Prüfungen FEHLGESCHLAGEN") << std::endl;
+
+	std::vector<stream::record_t> thermals;
+	{
+		stream::scorer_t<rules_t, sample_t, handler_t> scorer(parser::policy_t::skip, handler_t{ &thermals });
+		parser::detail::for_each_line(fixture::lengthen(file.view(), copies), [&](std::string_view line) {
+			scorer.line(line);
+		});
+		scorer.finish();
+	}
+	if(thermals.empty()) {
+		std::cerr << "Keine Bärte in " << path << "." << std::endl;
+		return 1;
+	}
+
+	const int null = ::open("/dev/null", O_WRONLY);
+	if(null < 0) {
+		std::cerr << "/dev/null kann nicht geöffnet werden." << std::endl;
+		return 1;
+	}
+
+	const std::vector<std::pair<const char*, emit::format_t>> formats {
+		{ "text", emit::format_t::text },
+		{ "csv", emit::format_t::csv },
+		{ "jsonl", emit::format_t::jsonl },
+		{ "binary", emit::format_t::binary }
+	};
+
+	std::cout << "Format;Bärte;ns/Bart" << std::endl;
+	for(const auto& [name, format] : formats) {
+		const auto start = std::chrono::steady_clock::now();
+		for(std::size_t round = 0; round < rounds; ++round) {
+			io::writer out(null);
+			const auto emitter = emit::make(format, out);
+			emitter->file(path, false);
+			for(const auto& r : thermals) emitter->thermal(r);
+		}
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << name << ";" << thermals.size() << ";" << elapsed.count() / (rounds * thermals.size()) << std::endl;
+	}
+	::close(null);
+
+	return checked ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <iostream>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+// The flights the benchmarks run on: a recorded one and long ones made of
+// appended copies of it.
+namespace fixture {
+
+	// The fixes of the flight at path. False with a message if it can not be
+	// read or holds fewer than two fixes.
+	template <class sample_t>
+	bool load(const std::string& path, std::vector<sample_t>& flight) {
+		io::mapped_file file(path);
+		if(!file) {
+			std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+			return false;
+		}
+		flight.clear();
+		parser::parse_parallel(file.view(), flight, parser::policy_t::skip);
+		if(flight.size() < 2) {
+			std::cerr << "Kein Flug in " << path << "." << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	// The flight copies times, each copy shifted to start where the previous
+	// ended.
+	template <class sample_t>
+	std::vector<sample_t> lengthen(const std::vector<sample_t>& flight, std::size_t copies) {
+		std::vector<sample_t> samples;
+		if(flight.empty()) return samples;
+		samples.reserve(flight.size() * copies);
+		const std::int32_t duration = delta(flight.front().time, flight.back().time) + 1;
+		for(std::size_t c = 0; c < copies; ++c) {
+			for(auto s : flight) {
+				s.time = units::timestamp((s.time.count() + std::int32_t(c) * duration) % units::timestamp::day);
+				samples.push_back(s);
+			}
+		}
+		return samples;
+	}
+
+	// The text of a flight with its B records repeated copies times, each copy
+	// shifted to start where the previous ended. For stages that parse.
+	inline std::string lengthen(std::string_view text, std::size_t copies) {
+		std::string header;
+		std::vector<std::string_view> lines;
+		parser::detail::for_each_line(text, [&](std::string_view line) {
+			if(!line.empty() && line[0] == 'B') lines.push_back(line);
+			else if(lines.empty()) header.append(line).push_back('\n');
+		});
+		if(lines.empty()) return std::string(text);
+
+		auto seconds = [](std::string_view line) {
+			return std::atoi(std::string(line.substr(1, 2)).c_str()) * 3600 + std::atoi(std::string(line.substr(3, 2)).c_str()) * 60 + std::atoi(std::string(line.substr(5, 2)).c_str());
+		};
+		const int first = seconds(lines.front());
+		const int duration = (seconds(lines.back()) - first + units::timestamp::day) % units::timestamp::day + 1;
+
+		std::string result = header;
+		for(std::size_t c = 0; c < copies; ++c) {
+			for(auto line : lines) {
+				const int t = (seconds(line) + int(c) * duration) % units::timestamp::day;
+				char time[16];
+				std::snprintf(time, sizeof(time), "%02d%02d%02d", t / 3600, t / 60 % 60, t % 60);
+				result.push_back('B');
+				result.append(time, 6);
+				result.append(line.substr(7));
+				result.push_back('\n');
+			}
+		}
+		return result;
+	}
+
+	// Tells whether a faster variant found the same as the plain one, as the
+	// exit status of the benchmark.
+	inline int verdict(bool same) {
+		std::cout << (same ? "Gleiche Ergebnisse" : "ABWEICHUNG") << std::endl;
+		return same ? 0 : 1;
+	}
+
+}
@@ -0,0 +1,99 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <parser.hpp>
+
+#include "fixture.hpp"
+#include "pipeline.hpp"
+#include "ruleset.hpp"
+#include "sweep.hpp"
+
+// Latency of scoring one long flight against the number of threads given to
+// pipeline::score and sweep::run. The flight is made of appended copies of a
+// recorded one, each shifted to start where the previous ended. Every thread
+// count must give exactly the result of one thread.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using iterator_t = std::vector<sample_t>::const_iterator;
+using rules_t = ruleset::akaflieg_dresden;
+
+struct outcome_t {
+	std::vector<std::size_t> begin, end;
+	std::vector<std::uint32_t> local, remote;
+
+	bool operator==(const outcome_t& other) const {
+		return begin == other.begin && end == other.end && local == other.local && remote == other.remote;
+	}
+};
+
+template <class result_t>
+void add(outcome_t& outcome, const result_t& result, iterator_t first) {
+	for(const auto& t : result.thermals) {
+		outcome.begin.push_back(t.begin - first);
+		outcome.end.push_back(t.end - first);
+	}
+	outcome.local.insert(outcome.local.end(), result.local.begin(), result.local.end());
+	outcome.remote.insert(outcome.remote.end(), result.remote.begin(), result.remote.end());
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 4;
+	const std::size_t rounds = argc > 3 ? std::atoi(argv[3]) : 5;
+
+	std::vector<sample_t> flight;
+	if(!fixture::load(path, flight) || copies == 0 || rounds == 0) return 1;
+
+	const auto samples = fixture::lengthen(flight, copies);
+
+	const auto start = nearest_airport(samples.front().position);
+	sweep::grid_t grid(sweep::rules_t::of<rules_t>());
+	grid.turn_rate = { units::angular_velocity::degrees_per_second_t(4), units::angular_velocity::degrees_per_second_t(6), units::angular_velocity::degrees_per_second_t(8) };
+	const auto variants = grid.variants();
+
+	std::cout
+		<< samples.size() << " Fixes, " << std::thread::hardware_concurrency() << " Kerne" << std::endl
+		<< "Threads;Wertung ms;Variantenvergleich ms;gleich" << std::endl;
+
+	outcome_t reference;
+	for(unsigned int threads : { 1, 2, 4, 8, 16 }) {
+		std::vector<double> score_ms, sweep_ms;
+		outcome_t outcome;
+		for(std::size_t r = 0; r < rounds; ++r) {
+			outcome = outcome_t();
+
+			auto begin = std::chrono::steady_clock::now();
+			const auto score = pipeline::score<rules_t>(samples.cbegin(), samples.cend(), std::pmr::get_default_resource(), nullptr, threads);
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+			score_ms.push_back(elapsed.count());
+			add(outcome, score, samples.cbegin());
+
+			begin = std::chrono::steady_clock::now();
+			const auto results = sweep::run(samples.cbegin(), samples.cend(), start, variants, threads);
+			elapsed = std::chrono::steady_clock::now() - begin;
+			sweep_ms.push_back(elapsed.count());
+			for(const auto& result : results) {
+				add(outcome, result, samples.cbegin());
+			}
+		}
+		if(threads == 1) reference = outcome;
+
+		std::sort(score_ms.begin(), score_ms.end());
+		std::sort(sweep_ms.begin(), sweep_ms.end());
+		std::cout
+			<< threads << ";"
+			<< score_ms[score_ms.size() / 2] << ";"
+			<< sweep_ms[sweep_ms.size() / 2] << ";"
+			<< (outcome == reference ? "ja" : "nein") << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "airfields.hpp"
+#include "airports.hpp"
+
+// Startup and lookup cost of the built in airport list against a mapped
+// airfield cache. The cache holds the built in list copied n times with small
+// offsets, about the size of a European OpenAIP export for n = 20. Every
+// indexed answer is checked against a linear search over the same airfields.
+
+double since(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+const airport_t& linear(const std::vector<airport_t>& airports, const units::gps_position& position) {
+	const airport_t* best = &airports.front();
+	auto best_distance = units::distance(position, best->position);
+	for(const auto& a : airports) {
+		const auto d = units::distance(position, a.position);
+		if(d < best_distance) {
+			best = &a;
+			best_distance = d;
+		}
+	}
+	return *best;
+}
+
+int main(int argc, char** argv) {
+	const int copies = argc > 1 ? std::atoi(argv[1]) : 20;
+	const int lookups = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+	auto start = std::chrono::steady_clock::now();
+	const auto& builtin = builtin_airports();
+	std::cout << "Eingebaute Liste: " << builtin.size() << " Flugplätze in " << since(start) << " µs" << std::endl;
+
+	std::vector<airport_t> airports;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> jitter(-3000, 3000);
+	for(int c = 0; c < copies; ++c) {
+		for(const auto& a : builtin) {
+			const int dlat = c ? jitter(random) : 0;
+			const int dlon = c ? jitter(random) : 0;
+			airports.push_back(airport_t{
+				a.name + (c ? " " + std::to_string(c) : ""),
+				units::gps_position::from_milliminutes(a.position.latitude_milliminutes() + dlat, a.position.longitude_milliminutes() + dlon),
+				a.elevation
+			});
+		}
+	}
+
+	start = std::chrono::steady_clock::now();
+	const auto bytes = airfields::compile(airports);
+	std::cout << "Cache: " << airports.size() << " Flugplätze, " << bytes.size() << " Bytes, gebaut in " << since(start) << " µs" << std::endl;
+
+	start = std::chrono::steady_clock::now();
+	const auto db = airfields::database_t::from(bytes);
+	std::cout << "Cache geöffnet in " << since(start) << " µs" << std::endl;
+
+	// Over Germany and a margin around it.
+	std::uniform_int_distribution<int> lat(45 * 60000, 56 * 60000), lon(4 * 60000, 16 * 60000);
+	std::vector<units::gps_position> positions;
+	for(int i = 0; i < lookups; ++i) {
+		positions.push_back(units::gps_position::from_milliminutes(lat(random), lon(random)));
+	}
+
+	start = std::chrono::steady_clock::now();
+	std::vector<const airport_t*> expected;
+	for(const auto& p : positions) expected.push_back(&linear(airports, p));
+	const double linear_time = since(start);
+
+	start = std::chrono::steady_clock::now();
+	std::vector<const airport_t*> found;
+	for(const auto& p : positions) {
+		units::length::meter_t d(0);
+		found.push_back(db->nearest(p, d));
+	}
+	const double indexed_time = since(start);
+
+	int mismatches = 0;
+	for(std::size_t i = 0; i < positions.size(); ++i) {
+		if(!found[i] || found[i]->name != expected[i]->name) ++mismatches;
+	}
+
+	std::cout << "Linear:     " << linear_time / lookups << " µs je Suche" << std::endl;
+	std::cout << "Indiziert:  " << indexed_time / lookups << " µs je Suche" << std::endl;
+	std::cout << "Abweichungen: " << mismatches << std::endl;
+	return mismatches ? 1 : 0;
+}
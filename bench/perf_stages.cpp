@@ -0,0 +1,345 @@
+#include <iostream>
+#include <fstream>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+#include "fixture.hpp"
+#include "detection.hpp"
+#include "pipeline.hpp"
+#include "ruleset.hpp"
+#include "scoring.hpp"
+
+// Counters of every scoring stage over a fixed corpus, compared against a
+// committed baseline. The corpus is the sample flight and a long flight made
+// of copies of it. Each stage runs often enough to take a few milliseconds per
+// measurement, the best of several measurements counts, per call.
+//
+//   thermik_bench_perf [--basis DATEI] [--schreiben DATEI] [--runden N]
+//                      [--schwelle [ZÄHLER=]PROZENT] [--schwelle-zeit PROZENT]
+//
+// With --basis a stage regressing by more than the threshold of a counter fails
+// the run. Every hardware counter both runs counted is compared against its own
+// threshold, see thresholds, --schwelle ZÄHLER=PROZENT sets one and a bare
+// --schwelle PROZENT the one of instructions. Machines without hardware
+// counters, most virtual ones, only give the task clock, which varies far more
+// between runs. It is compared against --schwelle-zeit (50 %) only where no
+// hardware counter could be, and the run says so.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using iterator_t = std::vector<sample_t>::const_iterator;
+using rules_t = ruleset::akaflieg_dresden;
+
+// Order of the columns in the baseline file.
+const char* const metrics[] = { "instructions", "cycles", "cache_misses", "branch_misses", "task_clock_ns" };
+constexpr std::size_t metric_count = std::size(metrics);
+constexpr std::size_t task_clock = metric_count - 1;
+
+// Regression allowed per counter, in percent. Instructions hardly vary from
+// run to run, misses depend on what else the machine runs.
+constexpr double thresholds[metric_count] = { 10, 15, 30, 20, 50 };
+
+using values_t = std::array<std::optional<double>, metric_count>;
+
+// Counters of the calling thread. Every counter is opened on its own, so one
+// the machine lacks does not take the others with it.
+class counters_t {
+
+	std::array<int, metric_count> fds;
+
+	static int open(std::uint32_t type, std::uint64_t config) {
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = type;
+		attr.config = config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+
+public:
+
+	counters_t() {
+		fds = {
+			open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+			open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+			open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+			open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES),
+			open(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK)
+		};
+	}
+
+	counters_t(const counters_t&) = delete;
+	counters_t& operator=(const counters_t&) = delete;
+
+	~counters_t() {
+		for(int fd : fds) {
+			if(fd >= 0) ::close(fd);
+		}
+	}
+
+	bool available(std::size_t metric) const {
+		return fds[metric] >= 0;
+	}
+
+	void start() {
+		for(int fd : fds) {
+			if(fd < 0) continue;
+			::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+
+	values_t stop() {
+		values_t result;
+		for(std::size_t m = 0; m < metric_count; ++m) {
+			if(fds[m] < 0) continue;
+			::ioctl(fds[m], PERF_EVENT_IOC_DISABLE, 0);
+			std::uint64_t value = 0;
+			if(::read(fds[m], &value, sizeof(value)) == sizeof(value)) result[m] = static_cast<double>(value);
+		}
+		return result;
+	}
+
+};
+
+struct row_t {
+	std::string stage;
+	std::string flight;
+	values_t values;
+};
+
+// Best of rounds measurements of f, per call. Calls per measurement are chosen
+// so that one takes at least 20 ms.
+values_t measure(counters_t& counters, std::size_t rounds, const std::function<void()>& f) {
+	std::size_t calls = 1;
+	for(;;) {
+		const auto start = std::chrono::steady_clock::now();
+		for(std::size_t i = 0; i < calls; ++i) f();
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		if(elapsed.count() >= 20 || calls >= (1u << 20)) break;
+		calls *= 2;
+	}
+
+	values_t best;
+	for(std::size_t r = 0; r < rounds; ++r) {
+		counters.start();
+		for(std::size_t i = 0; i < calls; ++i) f();
+		const auto values = counters.stop();
+		for(std::size_t m = 0; m < metric_count; ++m) {
+			if(!values[m]) continue;
+			const double per_call = *values[m] / calls;
+			if(!best[m] || per_call < *best[m]) best[m] = per_call;
+		}
+	}
+	return best;
+}
+
+std::vector<row_t> run(counters_t& counters, std::size_t rounds, const std::string& flight, const std::string& text) {
+	std::vector<row_t> rows;
+	auto add = [&](const char* stage, const std::function<void()>& f) {
+		rows.push_back(row_t{ stage, flight, measure(counters, rounds, f) });
+	};
+
+	std::vector<sample_t> samples;
+	parser::parse_parallel(text, samples, parser::policy_t::skip, 1);
+
+	add("parse", [&] {
+		std::vector<sample_t> s;
+		parser::parse_parallel(text, s, parser::policy_t::skip, 1);
+	});
+
+	std::vector<units::angular_velocity::degrees_per_second_t> turn;
+	add("forward_azimuth", [&] {
+		turn = detection::turn_rates(samples.cbegin(), samples.cend(), 1);
+	});
+
+	add("floating_average", [&] {
+		auto average = detection::floating_average(turn, rules_t::window);
+		(void)average;
+	});
+
+	std::vector<thermal_t<iterator_t>> detected;
+	detection::detect<rules_t>(samples.cbegin(), samples.cend(), std::back_inserter(detected));
+	std::vector<thermal_t<iterator_t>> optimized;
+	energy_scratch_t<iterator_t> energy;
+	add("optimize", [&] {
+		optimized = detected;
+		for(auto& t : optimized) optimize(t, energy);
+	});
+
+	add("find_max_hour", [&] {
+		auto best = find_max_hour(optimized.cbegin(), optimized.cend(), rules_t::scoring_window);
+		(void)best;
+	});
+
+	add("pipeline", [&] {
+		auto score = pipeline::score<rules_t>(samples.cbegin(), samples.cend(), std::pmr::get_default_resource(), nullptr, 1);
+		(void)score;
+	});
+	return rows;
+}
+
+std::string format(const std::optional<double>& v) {
+	if(!v) return "-";
+	std::ostringstream s;
+	s.precision(10);
+	s << *v;
+	return s.str();
+}
+
+std::map<std::pair<std::string, std::string>, values_t> read_baseline(const std::string& path, bool& ok) {
+	std::map<std::pair<std::string, std::string>, values_t> result;
+	std::ifstream file(path);
+	ok = bool(file);
+	std::string line;
+	while(std::getline(file, line)) {
+		if(line.empty() || line[0] == '#') continue;
+		std::istringstream fields(line);
+		std::string stage, flight;
+		fields >> stage >> flight;
+		values_t values;
+		for(std::size_t m = 0; m < metric_count; ++m) {
+			std::string v;
+			fields >> v;
+			if(!v.empty() && v != "-") values[m] = std::atof(v.c_str());
+		}
+		result[{ stage, flight }] = values;
+	}
+	return result;
+}
+
+int main(int argc, char **argv) {
+
+	std::string baseline, output;
+	std::array<double, metric_count> threshold;
+	std::copy(std::begin(thresholds), std::end(thresholds), threshold.begin());
+	std::size_t rounds = 5;
+	for(int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if(arg == "--basis" && i + 1 < argc) baseline = argv[++i];
+		else if(arg == "--schreiben" && i + 1 < argc) output = argv[++i];
+		else if(arg == "--schwelle" && i + 1 < argc) {
+			const std::string value = argv[++i];
+			const auto equals = value.find('=');
+			std::size_t m = 0;
+			if(equals != std::string::npos) {
+				const std::string name = value.substr(0, equals);
+				m = std::find(std::begin(metrics), std::end(metrics), name) - std::begin(metrics);
+				if(m == metric_count) {
+					std::cerr << "Unbekannter Zähler " << name << "." << std::endl;
+					return 1;
+				}
+			}
+			threshold[m] = std::atof(value.c_str() + (equals == std::string::npos ? 0 : equals + 1));
+		}
+		else if(arg == "--schwelle-zeit" && i + 1 < argc) threshold[task_clock] = std::atof(argv[++i]);
+		else if(arg == "--runden" && i + 1 < argc) rounds = std::max(1, std::atoi(argv[++i]));
+		else {
+			std::cerr << "Unbekannte Option " << arg << "." << std::endl;
+			return 1;
+		}
+	}
+
+	const std::string path = "igc/95iv6hr2.igc";
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+
+	counters_t counters;
+	std::cout << "Zähler:";
+	for(std::size_t m = 0; m < metric_count; ++m) {
+		std::cout << ' ' << metrics[m] << (counters.available(m) ? "" : " (fehlt)");
+	}
+	std::cout << std::endl;
+
+	std::vector<row_t> rows = run(counters, rounds, "95iv6hr2", std::string(file.view()));
+	const auto long_rows = run(counters, rounds, "95iv6hr2x8", fixture::lengthen(file.view(), 8));
+	rows.insert(rows.end(), long_rows.begin(), long_rows.end());
+
+	bool have_baseline = false;
+	const auto base = baseline.empty() ? decltype(read_baseline(baseline, have_baseline))() : read_baseline(baseline, have_baseline);
+	if(!baseline.empty() && !have_baseline) {
+		std::cerr << "Basis " << baseline << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+
+	int regressions = 0;
+	std::size_t timed_only = 0;
+	for(const auto& r : rows) {
+		std::cout << r.stage << ' ' << r.flight;
+		for(std::size_t m = 0; m < metric_count; ++m) {
+			std::cout << ' ' << metrics[m] << '=' << format(r.values[m]);
+		}
+
+		const auto b = base.find({ r.stage, r.flight });
+		if(b != base.end()) {
+			auto compare = [&](std::size_t m) {
+				if(!(r.values[m] && b->second[m] && *b->second[m] > 0)) return false;
+				const double change = 100 * (*r.values[m] / *b->second[m] - 1);
+				std::cout << ", " << metrics[m] << ' ' << (change >= 0 ? "+" : "") << change << " %";
+				if(change > threshold[m]) {
+					std::cout << " REGRESSION";
+					++regressions;
+				}
+				return true;
+			};
+			bool counted = false;
+			for(std::size_t m = 0; m < task_clock; ++m) counted |= compare(m);
+			if(!counted && compare(task_clock)) ++timed_only;
+		}
+		std::cout << std::endl;
+	}
+	if(timed_only > 0) {
+		std::cout << "Hardwarezähler fehlen in Messung oder Basis, " << timed_only << " Stufen nur über " << metrics[task_clock] << " verglichen (Schwelle " << threshold[task_clock] << " %)." << std::endl;
+	}
+
+	if(!output.empty()) {
+		std::ofstream out(output);
+		out << "# Best of " << rounds << " rounds per call, written by thermik_bench_perf --schreiben." << std::endl;
+		out << "# - for a counter the machine lacks." << std::endl;
+		out << "# stage flight";
+		for(const auto* m : metrics) out << ' ' << m;
+		out << std::endl;
+		for(const auto& r : rows) {
+			out << r.stage << ' ' << r.flight;
+			for(const auto& v : r.values) out << ' ' << format(v);
+			out << std::endl;
+		}
+		if(!out) {
+			std::cerr << "Datei " << output << " kann nicht geschrieben werden." << std::endl;
+			return 1;
+		}
+	}
+
+	if(regressions > 0) {
+		std::cerr << regressions << " Stufen langsamer als die Basis erlaubt." << std::endl;
+		return 1;
+	}
+	return 0;
+}
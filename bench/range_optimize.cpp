@@ -0,0 +1,134 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <parser.hpp>
+
+#include "fixture.hpp"
+#include "detection.hpp"
+#include "ruleset.hpp"
+#include "scoring.hpp"
+
+// optimize and find_max_hour with the range index of TE heights against the
+// plain searches they replace, over one long flight. The flight is made of
+// appended copies of a recorded one, each shifted to start where the previous
+// ended. Both must find the same thermals and windows.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using iterator_t = std::vector<sample_t>::const_iterator;
+using rules_t = ruleset::akaflieg_dresden;
+
+template <class iterator_t>
+void plain_optimize(thermal_t<iterator_t>& thermal) {
+	thermal_t<iterator_t> max = thermal;
+	for(auto it1 = thermal.begin; it1 != thermal.end; ++it1) {
+		for(auto it2 = it1+1; it2 != thermal.end; ++it2) {
+			thermal_t<iterator_t> t(it1, it2);
+			if(t.points > max.points) max = t;
+		}
+	}
+	thermal = max;
+}
+
+template <class thermal_it>
+std::pair<std::size_t, std::size_t> plain_max_hour(const thermal_it begin, const thermal_it end, units::time::second_t window, double& points) {
+	std::pair<std::size_t, std::size_t> result{ 0, 0 };
+	points = 0;
+	for(auto it1 = begin; it1 != end; ++it1) {
+		for(auto it2 = it1+1; it2 != end; ++it2) {
+			if((it2->end->time - it1->begin->time) <= window) {
+				double total = 0;
+				for(auto it3 = it1; it3 != it2; ++it3) total += it3->points;
+				total += it2->points;
+				if(total > points) {
+					points = total;
+					result = { std::size_t(it1 - begin), std::size_t(it2 - begin) };
+				}
+			}
+		}
+	}
+	return result;
+}
+
+template <class function_t>
+double best_of(std::size_t rounds, function_t f) {
+	double best = 1e300;
+	for(std::size_t r = 0; r < rounds; ++r) {
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::min(best, elapsed.count());
+	}
+	return best;
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 8;
+	const std::size_t rounds = argc > 3 ? std::atoi(argv[3]) : 3;
+
+	std::vector<sample_t> flight;
+	if(!fixture::load(path, flight) || copies == 0 || rounds == 0) return 1;
+
+	const auto samples = fixture::lengthen(flight, copies);
+
+	std::vector<thermal_t<iterator_t>> detected;
+	detection::detect<rules_t>(samples.cbegin(), samples.cend(), std::back_inserter(detected));
+
+	std::vector<thermal_t<iterator_t>> plain, indexed, alone;
+	const double plain_ms = best_of(rounds, [&] {
+		plain = detected;
+		for(auto& t : plain) plain_optimize(t);
+	});
+	const double build_ms = best_of(rounds, [&] {
+		const energy_t<iterator_t> energy(samples.cbegin(), samples.cend());
+	});
+	const double indexed_ms = best_of(rounds, [&] {
+		const energy_t<iterator_t> energy(samples.cbegin(), samples.cend());
+		indexed = detected;
+		for(auto& t : indexed) optimize(t, energy);
+	});
+	const double alone_ms = best_of(rounds, [&] {
+		energy_scratch_t<iterator_t> energy;
+		alone = detected;
+		for(auto& t : alone) optimize(t, energy);
+	});
+
+	bool same = plain.size() == indexed.size() && plain.size() == alone.size();
+	for(std::size_t i = 0; same && i < plain.size(); ++i) {
+		same &= plain[i].begin == indexed[i].begin && plain[i].end == indexed[i].end && plain[i].points == indexed[i].points;
+		same &= plain[i].begin == alone[i].begin && plain[i].end == alone[i].end;
+	}
+
+	double plain_points = 0;
+	std::pair<std::size_t, std::size_t> plain_window;
+	const double plain_hour_ms = best_of(rounds, [&] {
+		plain_window = plain_max_hour(plain.cbegin(), plain.cend(), rules_t::scoring_window, plain_points);
+	});
+	double points = 0;
+	std::pair<std::size_t, std::size_t> window;
+	const double hour_ms = best_of(rounds, [&] {
+		const auto max = find_max_hour(indexed.cbegin(), indexed.cend(), rules_t::scoring_window);
+		points = max.points;
+		window = { std::size_t(max.begin - indexed.cbegin()), std::size_t(max.end - indexed.cbegin()) };
+	});
+	// Differences of the prefix sums round apart from sums added up in order.
+	same &= std::abs(points - plain_points) <= 1e-9 * (plain_points + 1) && window == plain_window;
+
+	std::cout
+		<< samples.size() << " Fixes, " << detected.size() << " Bärte" << std::endl
+		<< "optimize ohne Index:        " << plain_ms << " ms" << std::endl
+		<< "optimize mit Flugindex:     " << indexed_ms << " ms (Index " << build_ms << " ms), " << plain_ms / indexed_ms << "x" << std::endl
+		<< "optimize mit Bartindex:     " << alone_ms << " ms, " << plain_ms / alone_ms << "x" << std::endl
+		<< "find_max_hour ohne Schranke: " << plain_hour_ms << " ms" << std::endl
+		<< "find_max_hour mit Schranke:  " << hour_ms << " ms, " << plain_hour_ms / hour_ms << "x" << std::endl;
+	return fixture::verdict(same);
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <fstream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <parser.hpp>
+#include <io/bulk_reader.hpp>
+
+// Reads and parses every IGC file of a directory, with blocking std::ifstream
+// reads one file at a time and with io::bulk_reader on each backend. Every
+// variant runs once against a cold page cache, the files dropped from it
+// beforehand, and once against the warm cache.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+struct totals_t {
+	std::size_t files = 0;
+	std::size_t bytes = 0;
+	std::size_t records = 0;
+};
+
+void parse(std::string_view text, totals_t& totals) {
+	std::vector<sample_t> samples;
+	auto result = parser::parse_parallel(text, samples, parser::policy_t::skip, 1);
+	totals.files += 1;
+	totals.bytes += text.size();
+	totals.records += result.records;
+}
+
+// Asks the kernel to forget the cached pages of every file. Only clean pages
+// are dropped, which is all of them for an archive that is not being written.
+void drop_cache(const std::vector<std::string>& paths) {
+	for(const auto& path : paths) {
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if(fd < 0) continue;
+		::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		::close(fd);
+	}
+}
+
+totals_t read_ifstream(const std::vector<std::string>& paths) {
+	totals_t totals;
+	for(const auto& path : paths) {
+		std::ifstream file(path);
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		parse(buffer.str(), totals);
+	}
+	return totals;
+}
+
+totals_t read_bulk(const std::vector<std::string>& paths, io::bulk_reader::backend_t backend, std::size_t depth) {
+	totals_t totals;
+	io::bulk_reader reader(depth, backend);
+	reader.read(paths, [&](std::size_t, std::string_view text, bool ok) {
+		if(ok) parse(text, totals);
+	});
+	return totals;
+}
+
+int main(int argc, char **argv) {
+
+	if(argc < 2) {
+		std::cerr << "Aufruf: " << argv[0] << " VERZEICHNIS [TIEFE]" << std::endl;
+		return 1;
+	}
+	const std::size_t depth = argc > 2 ? std::atoi(argv[2]) : 32;
+
+	std::vector<std::string> paths;
+	for(const auto& entry : std::filesystem::directory_iterator(argv[1])) {
+		if(entry.is_regular_file() && entry.path().extension() == ".igc") {
+			paths.push_back(entry.path().string());
+		}
+	}
+	std::sort(paths.begin(), paths.end());
+	if(paths.empty()) {
+		std::cerr << "Keine IGC-Dateien in " << argv[1] << "." << std::endl;
+		return 1;
+	}
+
+	if(io::bulk_reader(depth).backend() != io::bulk_reader::backend_t::io_uring) {
+		std::cerr << "io_uring nicht verfügbar, nur Threads." << std::endl;
+	}
+
+	const std::vector<std::pair<const char*, std::function<totals_t()>>> variants {
+		{ "ifstream", [&]() { return read_ifstream(paths); } },
+		{ "io_uring", [&]() { return read_bulk(paths, io::bulk_reader::backend_t::io_uring, depth); } },
+		{ "threads", [&]() { return read_bulk(paths, io::bulk_reader::backend_t::threads, depth); } }
+	};
+
+	std::cout << "Verfahren;Cache;Dateien;MiB;Datensätze;s;MiB/s;Dateien/s" << std::endl;
+	for(const auto& [name, run] : variants) {
+		for(const bool cold : { true, false }) {
+			if(cold) {
+				drop_cache(paths);
+			}
+			const auto start = std::chrono::steady_clock::now();
+			const auto totals = run();
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			const double mib = totals.bytes / (1024.0 * 1024.0);
+			std::cout
+				<< name << ";"
+				<< (cold ? "kalt" : "warm") << ";"
+				<< totals.files << ";"
+				<< mib << ";"
+				<< totals.records << ";"
+				<< elapsed.count() << ";"
+				<< mib / elapsed.count() << ";"
+				<< totals.files / elapsed.count() << std::endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <parser.hpp>
+#include <io/mapped_file.hpp>
+
+#include "pipeline.hpp"
+#include "resample.hpp"
+#include "ruleset.hpp"
+
+// Error of scoring a resampled track instead of the recorded one. A recorded
+// 1 Hz flight is turned into the track a faster logger without sub second
+// time stamps would write, k fixes per second on the straight line to the
+// next fix. That track is scored as it is and after resampling to 1 Hz, and
+// the recorded flight is also scored at coarser rates. Each result is
+// compared with the recorded flight: thermals found, their total and best
+// points, and how far the begin and end of matching thermals moved.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using rules_t = ruleset::akaflieg_dresden;
+
+struct outcome_t {
+	// Seconds of day.
+	std::vector<std::int32_t> begin, end;
+	std::vector<double> points;
+	double total = 0;
+	double best = 0;
+	double milliseconds = 0;
+};
+
+outcome_t score(const std::vector<sample_t>& track) {
+	outcome_t result;
+	const auto start = std::chrono::steady_clock::now();
+	const auto score = pipeline::score<rules_t>(track.cbegin(), track.cend(), std::pmr::get_default_resource(), nullptr, 1);
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	result.milliseconds = elapsed.count();
+	for(const auto& t : score.thermals) {
+		result.begin.push_back(t.begin->time.count());
+		result.end.push_back(t.end->time.count());
+		result.points.push_back(t.points);
+		if(std::isfinite(t.points)) {
+			result.total += t.points;
+			result.best = std::max(result.best, t.points);
+		}
+	}
+	return result;
+}
+
+// k fixes per second, all with the time of the recorded fix they follow.
+std::vector<sample_t> faster(const std::vector<sample_t>& flight, int k) {
+	std::vector<sample_t> result;
+	for(std::size_t i = 0; i < flight.size(); ++i) {
+		const auto& a = flight[i];
+		const auto& b = flight[std::min(i + 1, flight.size() - 1)];
+		for(int j = 0; j < k; ++j) {
+			const double w = double(j) / k;
+			sample_t s = a;
+			s.position = units::gps_position::from_milliminutes(
+				resample::detail::lerp(a.position.latitude_milliminutes(), b.position.latitude_milliminutes(), w),
+				resample::detail::lerp(a.position.longitude_milliminutes(), b.position.longitude_milliminutes(), w)
+			);
+			s.altitude = units::altitude(resample::detail::lerp(a.altitude.count(), b.altitude.count(), w));
+			s.true_air_speed = a.true_air_speed + (b.true_air_speed - a.true_air_speed) * w;
+			result.push_back(s);
+		}
+	}
+	return result;
+}
+
+void compare(const std::string& name, std::size_t fixes, const outcome_t& reference, const outcome_t& o) {
+	// Thermals of the reference overlapping one of o, and the largest shift
+	// of begin or end among them.
+	std::size_t matched = 0;
+	std::int32_t shift = 0;
+	for(std::size_t i = 0; i < reference.begin.size(); ++i) {
+		for(std::size_t j = 0; j < o.begin.size(); ++j) {
+			if(o.begin[j] <= reference.end[i] && reference.begin[i] <= o.end[j]) {
+				++matched;
+				shift = std::max({ shift, std::abs(o.begin[j] - reference.begin[i]), std::abs(o.end[j] - reference.end[i]) });
+				break;
+			}
+		}
+	}
+	const bool finite = std::all_of(o.points.begin(), o.points.end(), [](double p) { return std::isfinite(p); });
+	std::cout
+		<< name << ": " << fixes << " Fixes, " << o.milliseconds << " ms, "
+		<< o.begin.size() << " Bärte (" << matched << " von " << reference.begin.size() << " getroffen, "
+		<< "Versatz bis " << shift << " s), Summe " << o.total
+		<< " (" << (reference.total ? 100 * (o.total - reference.total) / reference.total : 0) << " %), bester " << o.best
+		<< (finite ? "" : ", ungültige Punkte") << std::endl;
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+
+	io::mapped_file file(path);
+	if(!file) {
+		std::cerr << "Datei " << path << " kann nicht gelesen werden." << std::endl;
+		return 1;
+	}
+	std::vector<sample_t> flight;
+	parser::parse_parallel(file.view(), flight, parser::policy_t::skip);
+	if(flight.size() < 2) {
+		std::cerr << "Kein Flug in " << path << "." << std::endl;
+		return 1;
+	}
+
+	const auto reference = score(flight);
+	compare("Aufgezeichnet", flight.size(), reference, reference);
+
+	std::vector<sample_t> canonical;
+	resample::resample(flight.begin(), flight.end(), resample::options_t{}, std::back_inserter(canonical));
+	compare("Aufgezeichnet, 1 s", canonical.size(), reference, score(canonical));
+
+	for(int k : { 2, 4, 10 }) {
+		const auto fast = faster(flight, k);
+		compare(std::to_string(k) + " Hz", fast.size(), reference, score(fast));
+
+		std::vector<sample_t> resampled;
+		const auto start = std::chrono::steady_clock::now();
+		resample::resample(fast.begin(), fast.end(), resample::options_t{}, std::back_inserter(resampled));
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		auto o = score(resampled);
+		compare(std::to_string(k) + " Hz, 1 s", resampled.size(), reference, o);
+		std::cout << "  Abtastung " << elapsed.count() << " ms" << std::endl;
+	}
+
+	// The window stays 17 fixes, so it spans interval times as many seconds.
+	for(std::int32_t interval : { 2, 3, 5 }) {
+		std::vector<sample_t> coarse;
+		resample::resample(flight.begin(), flight.end(), resample::options_t{ interval }, std::back_inserter(coarse));
+		compare(std::to_string(interval) + " s", coarse.size(), reference, score(coarse));
+	}
+	return 0;
+}
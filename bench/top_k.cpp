@@ -0,0 +1,156 @@
+#include <iostream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parser.hpp>
+
+#include "fixture.hpp"
+#include "pipeline.hpp"
+#include "ruleset.hpp"
+#include "selection.hpp"
+
+// Picks the k best thermals without overlap from one long flight, with
+// selection::selector_t and with a selection that optimizes every remaining
+// range again for each k, and checks that both pick the same parts for every
+// class. A long flight is made by appending copies of a recorded one, each
+// shifted to start where the previous ended. Checks that the lists of one
+// class hold only parts of it, with a cylinder so narrow that local parts are
+// also cut from thermals that are not local.
+
+struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+using iterator_t = std::vector<sample_t>::const_iterator;
+using rules_t = ruleset::akaflieg_dresden;
+using picks_t = std::vector<thermal_t<iterator_t>>;
+
+struct narrow_t : rules_t {
+	static constexpr units::length::meter_t cylinder_radius{2000};
+};
+
+// Without reuse: each pick optimizes all ranges still free.
+template <class class_t>
+picks_t from_scratch(const pipeline::score_t<iterator_t>& score, std::size_t k) {
+	const auto mask = [&](iterator_t it) { return score.classes[it - score.begin]; };
+	const auto starts = [&](iterator_t it) { return class_t::starts(mask(it)); };
+
+	// Runs of fixes the class may hold.
+	std::vector<std::pair<iterator_t, iterator_t>> ranges;
+	for(const auto& [first, last] : score.detected) {
+		std::optional<iterator_t> run;
+		for(auto it = first; it <= last; ++it) {
+			if(class_t::holds(mask(it))) {
+				if(!run) run = it;
+				if(it == last) ranges.emplace_back(*run, last);
+			} else if(run) {
+				ranges.emplace_back(*run, it - 1);
+				run.reset();
+			}
+		}
+	}
+
+	energy_scratch_t<iterator_t> energy;
+	picks_t picks;
+	for(std::size_t n = 0; n < k; ++n) {
+		std::size_t best_range = ranges.size();
+		std::optional<thermal_t<iterator_t>> best;
+		for(std::size_t r = 0; r < ranges.size(); ++r) {
+			if(ranges[r].second - ranges[r].first < 1) continue;
+			thermal_t<iterator_t> t(ranges[r].first, ranges[r].second);
+			optimize(t, energy, starts);
+			if(!best || t.points > best->points || (t.points == best->points && t.begin < best->begin)) {
+				best = t;
+				best_range = r;
+			}
+		}
+		if(!best || !(best->points > 0)) break;
+		picks.push_back(*best);
+
+		const auto [first, last] = ranges[best_range];
+		ranges.erase(ranges.begin() + best_range);
+		if(best->begin != first) ranges.emplace_back(first, best->begin - 1);
+		if(best->end != last) ranges.emplace_back(best->end + 1, last);
+	}
+	return picks;
+}
+
+template <class class_t>
+picks_t with_heap(const pipeline::score_t<iterator_t>& score, std::size_t k) {
+	picks_t picks;
+	for(const auto& pick : selection::top_k<class_t>(score, k)) {
+		picks.push_back(pick.thermal);
+	}
+	return picks;
+}
+
+double points(const picks_t& picks) {
+	double total = 0;
+	for(const auto& t : picks) total += t.points;
+	return total;
+}
+
+bool same(const picks_t& lhs, const picks_t& rhs) {
+	if(lhs.size() != rhs.size()) return false;
+	for(std::size_t i = 0; i < lhs.size(); ++i) {
+		if(lhs[i].begin != rhs[i].begin || lhs[i].end != rhs[i].end || lhs[i].points != rhs[i].points) return false;
+	}
+	return true;
+}
+
+// Both selections pick the same parts of a class.
+template <class class_t>
+bool agree(const pipeline::score_t<iterator_t>& score, std::size_t k) {
+	return same(from_scratch<class_t>(score, k), with_heap<class_t>(score, k));
+}
+
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "igc/95iv6hr2.igc";
+	const std::size_t copies = argc > 2 ? std::atoi(argv[2]) : 4;
+
+	std::vector<sample_t> flight;
+	if(!fixture::load(path, flight) || copies == 0) return 1;
+
+	const auto narrow = pipeline::score<narrow_t>(flight.cbegin(), flight.cend());
+	std::size_t local = 0, foreign = 0, wrong = 0;
+	for(const auto& pick : selection::top_k<selection::local_t>(narrow, 50)) {
+		++local;
+		foreign += std::find(narrow.local.begin(), narrow.local.end(), pick.source) == narrow.local.end();
+		wrong += !narrow.is_local(pick.thermal);
+	}
+	for(const auto& pick : selection::top_k<selection::remote_t>(narrow, 50)) {
+		wrong += !narrow.is_remote(pick.thermal);
+	}
+	std::cout << "Radius 2 km: " << local << " lokale Teile, " << foreign << " aus nicht lokalen Bärten" << std::endl;
+	bool ok = foreign > 0 && wrong == 0;
+	ok &= agree<selection::local_t>(narrow, 50) && agree<selection::remote_t>(narrow, 50);
+
+	const auto samples = fixture::lengthen(flight, copies);
+
+	const auto score = pipeline::score<rules_t>(samples.cbegin(), samples.cend());
+	std::cout << samples.size() << " Fixes, " << score.thermals.size() << " Bärte" << std::endl;
+
+	std::cout << "k;Verfahren;Punkte;ms" << std::endl;
+	for(std::size_t k : { 1, 2, 5, 10, 20, 50 }) {
+		picks_t picks[2];
+		const std::pair<const char*, picks_t (*)(const pipeline::score_t<iterator_t>&, std::size_t)> selections[] = {
+			{ "scratch", &from_scratch<selection::flight_t> },
+			{ "heap", &with_heap<selection::flight_t> }
+		};
+		for(std::size_t s = 0; s < 2; ++s) {
+			const auto start = std::chrono::steady_clock::now();
+			picks[s] = selections[s].second(score, k);
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			std::cout << k << ";" << selections[s].first << ";" << points(picks[s]) << ";" << elapsed.count() << std::endl;
+		}
+		ok &= same(picks[0], picks[1]);
+	}
+	ok &= agree<selection::local_t>(score, 50) && agree<selection::remote_t>(score, 50);
+
+	return fixture::verdict(ok);
+}
@@ -0,0 +1,47 @@
+#include <iostream>
+#include <fstream>
+
+#include <string>
+#include <vector>
+
+#include <io/mapped_file.hpp>
+
+#include "airfields.hpp"
+
+// Builds one airfield cache from several CUP files, for example the SeeYou and
+// OpenAIP exports of neighbouring countries, so thermik_challenge --airfields
+// can map it directly.
+
+int main(int argc, char** argv) {
+	if(argc < 3) {
+		std::cerr << "Aufruf: " << argv[0] << " QUELLE.cup... CACHE" << std::endl;
+		return 1;
+	}
+
+	std::vector<airport_t> airports;
+	for(int i = 1; i + 1 < argc; ++i) {
+		io::mapped_file file(argv[i]);
+		if(!file) {
+			std::cerr << "Datei " << argv[i] << " kann nicht gelesen werden." << std::endl;
+			return 1;
+		}
+		auto cup = airfields::read_cup(file.view());
+		std::cout << argv[i] << ": " << cup.airports.size() << " Flugplätze, " << cup.skipped << " andere Wegpunkte" << std::endl;
+		airports.insert(airports.end(), std::make_move_iterator(cup.airports.begin()), std::make_move_iterator(cup.airports.end()));
+	}
+	if(airports.empty()) {
+		std::cerr << "Keine Flugplätze gefunden." << std::endl;
+		return 1;
+	}
+
+	const std::string bytes = airfields::compile(airports);
+	std::ofstream out(argv[argc - 1], std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), bytes.size());
+	out.close();
+	if(!out) {
+		std::cerr << "Datei " << argv[argc - 1] << " kann nicht geschrieben werden." << std::endl;
+		return 1;
+	}
+	std::cout << argv[argc - 1] << ": " << airports.size() << " Flugplätze, " << bytes.size() << " Bytes" << std::endl;
+	return 0;
+}
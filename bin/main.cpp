@@ -1,15 +1,42 @@
 #include <iostream>
+#include <fstream>
 
 #include <parser.hpp>
+#include <io/bulk_reader.hpp>
+#include <io/bundle.hpp>
+#include <io/decompressor.hpp>
+#include <io/mapped_file.hpp>
+#include <io/server.hpp>
+#include <io/writer.hpp>
 #include <vector>
 #include <iterator>
-#include <fstream>
+#include <memory_resource>
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <filesystem>
 #include <functional>
-#include <numeric>
+#include <string>
 
+#include "airfields.hpp"
 #include "airports.hpp"
+#include "analysis.hpp"
+#include "arena.hpp"
+#include "checkpoint.hpp"
+#include "detection.hpp"
+#include "emit.hpp"
+#include "fingerprint.hpp"
+#include "live.hpp"
+#include "pipeline.hpp"
+#include "resample.hpp"
+#include "ruleset.hpp"
+#include "selection.hpp"
+#include "scoring.hpp"
+#include "stream.hpp"
+#include "sweep.hpp"
+#include "thermal.hpp"
 
 struct date_time {
 
@@ -32,312 +59,740 @@ std::ostream& operator<<(std::ostream& lhs, date_time rhs) {
 	return lhs;
 }
 
-struct sample_t {
-	units::time::second_t time;
-	units::gps_position position;
-	units::length::meter_t altitude;
-	units::length::meter_t fix_accuracy;
-	units::velocity::kilometers_per_hour_t true_air_speed;
-	units::velocity::kilometers_per_hour_t ground_speed;
-	units::velocity::meters_per_second_t total_energy_vario;
-	units::angle::degree_t true_heading;
-	units::angle::degree_t true_track;
-	units::temperature::celsius_t oat;
-	units::acceleration::standard_gravity_t gload;
-	units::angle::degree_t gps_track;
-	units::angular_velocity::degrees_per_second_t angularspeed;
-	units::angular_velocity::degrees_per_second_t floating_average_angularspeed;
-};
-
-template <class iterator_t>
-struct thermal_t {
-	iterator_t begin;
-	iterator_t end;
-	units::length::meter_t gain;
-	units::length::meter_t gain_te;
-	units::velocity::meters_per_second_t average;
-	double points;
-
-	thermal_t(
-		iterator_t begin,
-		iterator_t end
-	) :
-		begin(begin),
-		end(end),
-		gain(end->altitude - begin->altitude),
-		gain_te(
-			gain +
-			((
-				units::math::pow<2>(end->true_air_speed) -
-				units::math::pow<2>(begin->true_air_speed)
-			) /
-				units::acceleration::standard_gravity_t(2))
-		),
-		average(gain_te/ (end->time - begin->time)),
-		points(std::max(gain_te.to<double>(),0.0) * average.to<double>())
-	{
+using analysis::sample_t;
+
+// Comma separated list of numbers, empty if any entry is not a number.
+std::vector<double> numbers(const std::string& arg) {
+	std::vector<double> result;
+	std::size_t begin = 0;
+	while(begin <= arg.size()) {
+		auto end = std::min(arg.find(',', begin), arg.size());
+		auto entry = arg.substr(begin, end - begin);
+		char* parsed = nullptr;
+		double value = std::strtod(entry.c_str(), &parsed);
+		if(entry.empty() || *parsed != '\0') return {};
+		result.push_back(value);
+		begin = end + 1;
 	}
-};
+	return result;
+}
 
-template <size_t N, class forward_it, class T>
-void floating_average(const forward_it begin, const forward_it end, T forward_it::value_type::*attribute, T forward_it::value_type::*result) {
-	auto rolling_sum = T{0};
-	auto window_end = begin;
-	for(size_t i = 0; i < N; ++i) {
-		rolling_sum = rolling_sum + (*window_end).*attribute;
-		++window_end;
-	}
-	auto window_middle = begin;
-	for(size_t i = 0; i < N/2; ++i) {
-		++window_middle;
-	}
-	auto window_begin = begin;
-	while(window_end != end) {
-		(*window_middle).*result = rolling_sum/N;
-		rolling_sum = rolling_sum - (*window_begin).*attribute;
-		rolling_sum = rolling_sum + (*window_end).*attribute;
-		++window_middle;
-		++window_begin;
-		++window_end;
+// Reads the values in unit T and stores them as U.
+template <class T, class U = T>
+std::vector<U> as(const std::vector<double>& values) {
+	std::vector<U> result;
+	for(auto v : values) {
+		result.push_back(U(T(v)));
 	}
+	return result;
 }
 
-template <class iterator_t>
-void optimize(thermal_t<iterator_t>& thermal) {
-	thermal_t<iterator_t> max = thermal;
+// Sets the values tried for the parameter a sweep option such as --turn-rate
+// names, false if it names none.
+bool assign(sweep::grid_t& grid, const std::string& arg, const std::vector<double>& values) {
+	if(arg == "--window") grid.window = as<std::size_t>(values);
+	else if(arg == "--turn-rate") grid.turn_rate = as<units::angular_velocity::degrees_per_second_t>(values);
+	else if(arg == "--merge-gap") grid.merge_gap = as<units::time::second_t>(values);
+	else if(arg == "--radius") grid.cylinder_radius = as<units::length::kilometer_t, units::length::meter_t>(values);
+	else if(arg == "--glide-ratio") grid.glide_ratio = values;
+	else if(arg == "--scoring-window") grid.scoring_window = as<units::time::minute_t, units::time::second_t>(values);
+	else return false;
+	return true;
+}
 
-	for(auto it1 = thermal.begin; it1 != thermal.end; ++it1) {
-		for(auto it2 = it1+1; it2 != thermal.end; ++it2) {
-			thermal_t<iterator_t> t(it1, it2);
-			if(t.points > max.points) max = t;
+template <class iterator_t>
+void print_sweep(const std::vector<sweep::result_t<iterator_t>>& results) {
+	for(std::size_t v = 0; v < results.size(); ++v) {
+		const auto& r = results[v];
+		std::cout
+			<< "Variante " << v + 1
+			<< ": Fenster " << r.rules.window
+			<< ", Drehrate " << r.rules.turn_rate
+			<< ", Lücke " << r.rules.merge_gap
+			<< ", Tonne " << units::length::kilometer_t(r.rules.cylinder_radius)
+			<< ", Gleitzahl " << r.rules.glide_ratio
+			<< ", Wertungsfenster " << units::time::minute_t(r.rules.scoring_window) << std::endl;
+
+		std::cout << "Von;Bis;TEK-Höhe;Steigen;Punkte" << std::endl;
+		for(const auto& t : r.thermals) {
+			std::cout
+				<< date_time(t.begin->time) << ";"
+				<< date_time(t.end->time) << ";"
+				<< t.gain_te.template to<double>() << ";"
+				<< t.average.template to<double>() << ";"
+				<< t.points << std::endl;
 		}
-	}
 
-	thermal = max;
+		auto summary = [&](const char* name, const auto& thermals) {
+			double strongest = 0;
+			for(const auto& t : thermals) {
+				strongest = std::max(strongest, t.points);
+			}
+			auto max_hour = find_max_hour(thermals.begin(), thermals.end(), r.rules.scoring_window);
+			std::cout << name << ";Stärkster Bart;" << strongest << ";Summe;" << max_hour.points << std::endl;
+		};
+		summary("Lokal", r.local_thermals());
+		summary("Überland", r.remote_thermals());
+		std::cout << std::endl;
+	}
 }
 
-template<class iterator_t>
-bool is_local(thermal_t<iterator_t> thermal, const airport_t& ap) {
-	return std::any_of(
-		thermal.begin,
-		thermal.end,
-		[&](const auto& sample){
-			return units::distance(sample.position, ap.position) > units::length::kilometer_t(10);
+// Results go to the emitter, the writer is flushed before other output.
+struct output_t {
+	io::writer& writer;
+	emit::emitter_t& emitter;
+};
+
+// wind, if given, asks for the circles of every thermal and holds the wind the
+// logger recorded.
+template <class rules, class iterator_t>
+void report(iterator_t begin, iterator_t end, std::pmr::memory_resource* memory, bool debug, std::size_t top, const std::vector<parser::wind_t>* wind, emit::emitter_t& out) {
+	std::vector<detection::trace_t> trace;
+	circling::tracker_t circles;
+	auto score = pipeline::score<rules>(begin, end, memory, debug ? &trace : nullptr, std::thread::hardware_concurrency(), wind ? &circles : nullptr);
+
+	if(debug) {
+		std::size_t i = 0;
+		for(auto it = begin; it != end; ++it, ++i) {
+			std::cerr
+				<< date_time(it->time) << ";"
+				<< trace[i].gps_track << ";"
+				<< trace[i].angularspeed << ";"
+				<< trace[i].floating_average_angularspeed << std::endl;
 		}
-	);
-}
+	}
 
-template <class iterator_t>
-bool is_remote(thermal_t<iterator_t> thermal, const airport_t& ap) {
-	return (thermal.begin->altitude*40) > (units::distance(thermal.begin->position, ap.position));
+	analysis::flight_t flight(memory);
+	analysis::summarize<rules>(score, flight);
+	const auto& records = flight.thermals;
+
+	out.start(*flight.start_airport);
+	for(std::size_t i = 0; i < records.size(); ++i) {
+		out.thermal(records[i]);
+		if(wind) {
+			const auto& t = score.thermals[i];
+			const auto summary = circling::summarize(circles.result(), std::distance(begin, t.begin), std::distance(begin, t.end));
+			out.circles(records[i], summary, circling::logged(*wind, records[i].begin, records[i].end));
+		}
+	}
+	out.ranking(emit::class_t::local, flight.local);
+	out.ranking(emit::class_t::remote, flight.remote);
+
+	if(top > 0) {
+		auto best = [&](const auto& picks) {
+			std::vector<stream::record_t> result;
+			for(const auto& p : picks) {
+				const auto& t = p.thermal;
+				result.push_back(stream::record_t{ t.begin->time, t.end->time, t.gain_te, t.average, t.points, score.is_local(t), score.is_remote(t) });
+			}
+			return result;
+		};
+		out.top(emit::class_t::flight, best(selection::top_k(score, top, memory)));
+		out.top(emit::class_t::local, best(selection::top_k<selection::local_t>(score, top, memory)));
+		out.top(emit::class_t::remote, best(selection::top_k<selection::remote_t>(score, top, memory)));
+	}
 }
 
-template <class thermal_it>
-auto find_max_hour(const thermal_it begin, const thermal_it end) {
-
-	struct {
-		double points;
-		thermal_it begin;
-		thermal_it end;
-	} max;
-
-	for(auto it1 = begin; it1 != end; ++it1) {
-		for(auto it2 = it1+1; it2 != end; ++it2) {
-			if((it2->end->time - it1->begin->time) <= units::time::hour_t(1)) {
-				double total_points = 0;
-				for(auto it3 = it1; it3 != it2; ++it3) {
-					total_points += it3->points;
-				}
-				total_points += it2->points;
-				if(total_points > max.points) {
-					max.points = total_points;
-					max.begin = it1;
-					max.end = it2;
-				}
-			}
+// Progress of the run for --checkpoint. Flights are counted over all files and
+// bundle entries in the order they are read. A restarted run skips the flights
+// finished before and, in stream mode, goes on inside the flight it stopped in.
+// Output written after the last snapshot is written again.
+struct progress_t {
+
+	std::string path;
+	std::chrono::steady_clock::duration every;
+	std::chrono::steady_clock::time_point saved = std::chrono::steady_clock::now();
+	io::writer* writer = nullptr;
+	bool failed = false;
+
+	// Every option and path of the run, see arguments(). A snapshot only
+	// continues the same run.
+	std::string arguments;
+
+	// Flights finished, in this run and the one resumed.
+	std::uint64_t finished = 0;
+	// Flights finished by the run resumed, skipped in this one.
+	std::uint64_t skip = 0;
+	std::uint64_t seen = 0;
+	int status = 0;
+	// Scorer of the flight stopped in, empty if none, and bytes of it read.
+	std::string scorer;
+	std::uint64_t consumed = 0;
+
+	bool due() const {
+		return std::chrono::steady_clock::now() - saved >= every;
+	}
+
+	void save() {
+		checkpoint::writer_t out;
+		out.put(arguments);
+		out.put(finished);
+		out.put(status);
+		out.put(consumed);
+		out.put(scorer);
+		// Whatever the snapshot counts as done must have been written.
+		writer->flush();
+		if(!checkpoint::save(path, out) && !failed) {
+			std::cerr << "Sicherung " << path << " kann nicht geschrieben werden." << std::endl;
+			failed = true;
 		}
+		saved = std::chrono::steady_clock::now();
+	}
+
+	// False if the snapshot is damaged or from another run.
+	bool restore(std::string_view snapshot) {
+		checkpoint::reader_t in(snapshot);
+		std::string saved_arguments;
+		const bool ok =
+			in.get(saved_arguments) &&
+			in.get(finished) &&
+			in.get(status) &&
+			in.get(consumed) &&
+			in.get(scorer) &&
+			in.empty();
+		skip = finished;
+		return ok && saved_arguments == arguments;
 	}
 
-	return max;
+	// True if the next flight was finished by the run resumed.
+	bool skipped() {
+		if(seen == skip) return false;
+		++seen;
+		return true;
+	}
+
+	void finish(int flight_status) {
+		++finished;
+		status |= flight_status;
+		scorer.clear();
+		consumed = 0;
+		if(due()) save();
+	}
+
+	// Inside a flight in stream mode.
+	template <class scorer_t>
+	void reading(const scorer_t& s, std::uint64_t bytes) {
+		if(!due()) return;
+		checkpoint::writer_t state;
+		s.save(state);
+		scorer = state.data();
+		consumed = bytes;
+		save();
+	}
+
+};
+
+struct options_t {
+	std::string rules = ruleset::akaflieg_dresden::name;
+	bool debug = false;
+	bool stream = false;
+	emit::format_t format = emit::format_t::text;
+	// Number of best thermals without overlap to report, 0 if off.
+	std::size_t top = 0;
+	// Seconds between fixes after resampling, 0 keeps the rate of the logger.
+	std::int32_t interval = 0;
+	// Circles and wind of every thermal.
+	bool circles = false;
+	// Flights scored before, in this run and earlier ones. Flights found in it
+	// are not scored again. Null if off.
+	fingerprint::index_t* duplicates = nullptr;
+	// Snapshots of the run, null if off.
+	progress_t* progress = nullptr;
+	// Listen for live streams on this port instead of reading files, 0 if off.
+	int serve = 0;
+	// Sweep parameters and their values, in command line order.
+	std::vector<std::pair<std::string, std::vector<double>>> sweep;
+	// CUP files loaded, in command line order.
+	std::vector<std::string> airfields;
+};
+
+// Everything of options and paths that shapes the output, paths made
+// absolute. Serving and the index of flights do not go with --checkpoint.
+std::string arguments(const options_t& options, const std::vector<std::string>& paths) {
+	auto absolute = [](const std::vector<std::string>& files) {
+		std::vector<std::string> result;
+		for(const auto& f : files) {
+			std::error_code ec;
+			const auto path = std::filesystem::absolute(f, ec);
+			result.push_back(ec ? f : path.lexically_normal().string());
+		}
+		return result;
+	};
+	checkpoint::writer_t out;
+	out.put(options.rules);
+	out.put(options.debug);
+	out.put(options.stream);
+	out.put(options.format);
+	out.put(static_cast<std::uint64_t>(options.top));
+	out.put(options.interval);
+	out.put(options.circles);
+	out.put(options.sweep);
+	out.put(absolute(options.airfields));
+	out.put(absolute(paths));
+	return out.data();
 }
 
-template <class iterator_t>
-std::ostream& operator<<(std::ostream& lhs, thermal_t<iterator_t> rhs) {
+std::ostream& operator<<(std::ostream& lhs, const stream::record_t& rhs) {
 	lhs
-		<< "Von " << date_time(rhs.begin->time)
-		<< " bis " << date_time(rhs.end->time)
+		<< "Von " << date_time(rhs.begin)
+		<< " bis " << date_time(rhs.end)
 		<< " mit " << rhs.gain_te
 		<< " und " << rhs.average
 		<< " eribt " << rhs.points << " Punkte";
 	return lhs;
 }
 
-int main(int argc, char **argv) {
+// Scores one flight while reading it, every thermal is printed once it is final.
+int analyse_stream(std::istream& input, const options_t& options, const output_t& out) {
+	int status = 0;
+	const bool found = ruleset::dispatch(options.rules, [&](auto rules) {
+		struct handler_t {
+			const output_t* out;
+			void start(const airport_t& ap) {
+				out->emitter.start(ap);
+			}
+			void thermal(const stream::record_t& r) {
+				out->emitter.thermal(r);
+			}
+		};
+		stream::scorer_t<decltype(rules), sample_t, handler_t> scorer(parser::policy_t::skip, handler_t{ &out });
+
+		std::uint64_t consumed = 0;
+		auto* progress = options.progress;
+		if(progress && !progress->scorer.empty()) {
+			checkpoint::reader_t in(progress->scorer);
+			if(!scorer.restore(in) || !in.empty()) {
+				std::cerr << "Sicherung " << progress->path << " lässt sich nicht fortsetzen." << std::endl;
+				status = 1;
+				return;
+			}
+			consumed = progress->consumed;
+			input.ignore(consumed);
+			progress->scorer.clear();
+			if(const auto* airport = scorer.state().start_airport) out.emitter.start(*airport);
+		}
 
-	if(argc <= 1) {
-		std::cerr << "Keine Datein angegeben." << std::endl;
-		return 1;
-	}
+		std::string line;
+		std::size_t lines = 0;
+		while(!scorer.done() && std::getline(input, line)) {
+			scorer.line(line);
+			consumed += line.size() + 1;
+			if(progress && ++lines % 4096 == 0) progress->reading(scorer, consumed);
+		}
+		auto result = scorer.finish();
 
-	std::vector<sample_t> samples;
-	std::ifstream file(argv[1]);
-	parser::parse(file, std::back_inserter(samples));
-
-	// First pass
-	for(size_t i = 0; i < samples.size()-1;++i) {
-		samples[i].gps_track = units::forward_azimuth(samples[i].position, samples[i+1].position);
-		if(i>0) {
-			auto normalize =[](units::angle::degree_t a)->units::angle::degree_t {
-				a += units::angle::degree_t(360);
-				a = units::math::fmod(a, units::angle::degree_t(360));
-				if(a > units::angle::degree_t(180)) a -= units::angle::degree_t(360);
-				return a;
-			};
-			samples[i].angularspeed = normalize(samples[i-1].gps_track - samples[i].gps_track) / (samples[i].time - samples[i-1].time);
+		for(const auto& d : result.parse.diagnostics) {
+			std::cerr << "Zeile " << d.line << ", Spalte " << d.column << ": " << parser::describe(d.error) << std::endl;
+		}
+		if(result.parse.error != parser::error_t::none) {
+			status = 1;
+			return;
 		}
+
+		out.emitter.ranking(emit::class_t::local, result.local);
+		out.emitter.ranking(emit::class_t::remote, result.remote);
+	});
+
+	if(!found) {
+		std::cerr << "Unbekannte Ausschreibung " << options.rules << "." << std::endl;
+		return 1;
 	}
+	return status;
+}
 
-	// Second pass
-	floating_average<17>(
-		samples.begin(),
-		samples.end(),
-		&sample_t::angularspeed,
-		&sample_t::floating_average_angularspeed
-	);
+std::atomic<bool> stop_serving{ false };
 
-	// Third pass
-	std::vector<thermal_t<decltype(samples)::iterator>> thermals;
-	for(auto it = samples.begin(); it!=samples.end(); ++it) {
-		if(
-			units::math::abs(
-				it->floating_average_angularspeed
-			) >= units::angular_velocity::degrees_per_second_t(6)
-		) {
-			auto begin = it;
-			for(
-				;
-				it != samples.end() &&
-				units::math::abs(it->floating_average_angularspeed) >= units::angular_velocity::degrees_per_second_t(6);
-				++it
-			) {}
-			thermal_t<decltype(it)> thermal(begin, it);
-
-			if(thermal.points > 0) {
-				thermals.push_back(std::move(thermal));
+// Scores the gliders streaming to the port until interrupted. Every thermal is
+// printed once it is final, together with the glider's rankings so far.
+int serve(const options_t& options) {
+	io::server server(options.serve);
+	if(!server) {
+		std::cerr << "Port " << options.serve << " kann nicht geöffnet werden." << std::endl;
+		return 1;
+	}
+	std::signal(SIGINT, [](int) { stop_serving = true; });
+	std::signal(SIGTERM, [](int) { stop_serving = true; });
+
+	const bool found = ruleset::dispatch(options.rules, [&](auto rules) {
+		auto registry = live::registry<decltype(rules), sample_t>(
+			[](std::size_t glider, const stream::record_t& r, const stream::result_t& state) {
+				std::cout
+					<< "Segler " << glider << ": " << r
+					<< ", lokal " << state.local.max_points
+					<< ", Überland " << state.remote.max_points << " Punkte" << std::endl;
+			},
+			[](std::size_t glider, const stream::result_t& result) {
+				std::cout
+					<< "Segler " << glider << " beendet: "
+					<< result.parse.records << " Datensätze, lokal " << result.local.max_points
+					<< ", Überland " << result.remote.max_points << " Punkte" << std::endl;
 			}
-		}
+		);
+
+		const auto start = std::chrono::steady_clock::now();
+		server.run(registry, stop_serving);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		const auto& stats = registry.stats();
+		std::cerr
+			<< "Segler gleichzeitig: " << stats.peak_gliders
+			<< ", Zeilen: " << stats.lines
+			<< " (" << (stats.lines / elapsed.count()) << "/s)"
+			<< ", Datensätze: " << stats.records
+			<< ", verworfen: " << stats.skipped + stats.overlong
+			<< ", Bärte: " << stats.thermals << std::endl;
+	});
+
+	if(!found) {
+		std::cerr << "Unbekannte Ausschreibung " << options.rules << "." << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+// Scores one parsed flight. Everything it allocates comes from the arena.
+int score(std::string_view name, const std::pmr::vector<sample_t>& samples, const parser::result_t& result, arena_t& arena, const options_t& options, const output_t& out) {
+	for(const auto& d : result.diagnostics) {
+		std::cerr << "Zeile " << d.line << ", Spalte " << d.column << ": " << parser::describe(d.error) << std::endl;
+	}
+	for(const auto& code : result.missing) {
+		std::cerr << "Feld " << code << " nicht im Logger deklariert." << std::endl;
+	}
+	if(result.error != parser::error_t::none || samples.empty()) {
+		return 1;
 	}
 
-	//Fourth pass
-	for(auto thermal_it = thermals.begin(); thermal_it+1 != thermals.end(); ) {
-		auto next_it = thermal_it +1;
-		if(next_it->begin->time - thermal_it->end->time <= units::time::second_t(12)) {
-			thermal_t merged(thermal_it->begin, next_it->end);
-			*thermal_it = merged;
-			thermals.erase(next_it);
-		} else {
-			++thermal_it;
+	if(options.duplicates) {
+		const auto sketch = fingerprint::sketch(samples.begin(), samples.end());
+		const auto match = options.duplicates->find(sketch, fingerprint::same);
+		if(match.name) {
+			out.emitter.duplicate(*match.name, match.similarity);
+			return 0;
 		}
+		options.duplicates->add(std::string(name), sketch);
 	}
 
-	// Fith pass
-	for(auto& t : thermals) {
-		optimize(t);
-	}
-
-	auto start_airport = std::accumulate(
-		airports.begin(),
-		airports.end(),
-		airports.front(),
-		[&](airport_t lhs, airport_t rhs) {
-			if(
-				units::distance(
-					samples.front().position,
-					lhs.position
-				) <
-				units::distance(
-					samples.front().position,
-					rhs.position
-				)
-			) {
-				return lhs;
-			} else {
-				return rhs;
-			}
+	std::pmr::vector<sample_t> resampled(arena.get());
+	if(options.interval > 0) {
+		resampled.reserve(samples.size());
+		resample::resample(samples.begin(), samples.end(), resample::options_t{ options.interval }, std::back_inserter(resampled));
+	}
+	const auto& fixes = options.interval > 0 ? resampled : samples;
+
+	const bool found = ruleset::dispatch(options.rules, [&](auto rules) {
+		using rules_t = decltype(rules);
+
+		if(options.sweep.empty()) {
+			report<rules_t>(fixes.begin(), fixes.end(), arena.get(), options.debug, options.top, options.circles ? &result.wind : nullptr, out.emitter);
+			return;
+		}
+
+		// Only sweep options are taken into options.sweep.
+		sweep::grid_t grid(sweep::rules_t::of<rules_t>());
+		for(const auto& [arg, values] : options.sweep) {
+			assign(grid, arg, values);
 		}
-	);
 
-	std::cout << "Took of on " << start_airport.name << std::endl;
+		// The comparison of variants is text only.
+		out.writer.flush();
+		const auto& start_airport = nearest_airport(fixes.front().position);
+		std::cout << "Took of on " << start_airport.name << std::endl << std::endl;
+		print_sweep(sweep::run(fixes.begin(), fixes.end(), start_airport, grid.variants()));
+	});
+
+	if(!found) {
+		std::cerr << "Unbekannte Ausschreibung " << options.rules << "." << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
 
-	for(auto& t : thermals) {
-		std::cout << t << std::endl;
+// Scores one flight held in memory.
+int analyse(std::string_view name, std::string_view text, arena_t& arena, const options_t& options, const output_t& out) {
+	std::pmr::vector<sample_t> samples(arena.get());
+	const auto result = parser::parse_parallel(text, samples, parser::policy_t::skip);
+	return score(name, samples, result, arena, options, out);
+}
+
+// Scores one flight as it is decompressed.
+int analyse(std::string_view name, std::istream& input, arena_t& arena, const options_t& options, const output_t& out) {
+	std::pmr::vector<sample_t> samples(arena.get());
+	const auto result = parser::parse(input, std::back_inserter(samples), parser::policy_t::skip);
+	return score(name, samples, result, arena, options, out);
+}
+
+// Scores every flight of one input file, a plain or compressed IGC file or a
+// zip or tar bundle. Flights are named if there may be more than one.
+int analyse_input(const std::string& path, std::string_view data, arena_t& arena, const options_t& options, const output_t& out, bool announce) {
+	const auto format = io::detect(data);
+	if(!io::supported(format.compression)) {
+		std::cerr << "Datei " << path << ": Kompression wird nicht unterstützt." << std::endl;
+		return 1;
 	}
 
-	std::vector<thermal_t<decltype(samples)::iterator>> local_thermals;
-	std::copy_if(
-		thermals.begin(),
-		thermals.end(),
-		std::back_inserter(local_thermals),
-		[&](auto& t) -> bool {
-			return is_local(t, start_airport);
+	int status = 0;
+	if(format.container != io::container_t::none) {
+		const bool intact = io::for_each_entry(data, format, [&](const std::string& name, std::istream& input) {
+			if(options.progress && options.progress->skipped()) return;
+			const std::string entry = path + "/" + name;
+			out.emitter.file(entry, true);
+			const int flight = options.stream ? analyse_stream(input, options, out) : analyse(entry, input, arena, options, out);
+			arena.reset();
+			if(options.progress) options.progress->finish(flight);
+			status |= flight;
+		});
+		if(!intact) {
+			std::cerr << "Archiv " << path << " ist beschädigt oder wird nicht unterstützt." << std::endl;
+			status = 1;
 		}
-	);
+		return status;
+	}
 
+	if(options.progress && options.progress->skipped()) return 0;
+	out.emitter.file(path, announce);
+	if(format.compression == io::compression_t::none && !options.stream) {
+		status = analyse(path, data, arena, options, out);
+	} else {
+		io::decompressor buffer(data, format.compression);
+		std::istream input(&buffer);
+		status = options.stream ? analyse_stream(input, options, out) : analyse(path, input, arena, options, out);
+		if(buffer.failed()) {
+			std::cerr << "Datei " << path << " ist beschädigt." << std::endl;
+			status = 1;
+		}
+	}
+	arena.reset();
+	if(options.progress) options.progress->finish(status);
+	return status;
+}
 
+int main(int argc, char **argv) {
 
-	std::vector<thermal_t<decltype(samples)::iterator>> remote_thermals;
-	std::copy_if(
-		thermals.begin(),
-		thermals.end(),
-		std::back_inserter(remote_thermals),
-		[&](auto& t) -> bool {
-			return is_remote(t, start_airport);
+	options_t options;
+	std::vector<std::string> paths;
+	fingerprint::index_t duplicates;
+	std::string duplicates_path;
+	progress_t progress;
+	// Seconds between snapshots, negative if not given.
+	int every = -1;
+	for(int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if(arg == "--debug") {
+			options.debug = true;
+			continue;
 		}
-	);
-
-	std::cout << "Lokale Wertung:" << std::endl;
-	auto strongest_local = std::accumulate(
-		local_thermals.begin(),
-		local_thermals.end(),
-		local_thermals.front(),
-		[](const auto& t1, const auto& t2){
-			if(t1.points > t2.points) {
-				return t1;
-			} else {
-				return t2;
+		if(arg == "--stream") {
+			options.stream = true;
+			continue;
+		}
+		if(arg == "--rules" && i + 1 < argc) {
+			options.rules = argv[++i];
+			continue;
+		}
+		if(arg == "--format") {
+			if(i + 1 >= argc || !emit::parse(argv[++i], options.format)) {
+				std::cerr << "Unbekanntes Format, möglich sind text, csv, jsonl und binary." << std::endl;
+				return 1;
 			}
+			continue;
 		}
-	);
-
-	std::cout << "Stärkster Bart:" << strongest_local << std::endl;
-
-	auto local_max_hour = find_max_hour(local_thermals.begin(), local_thermals.end());
-	std::cout
-		<< "60min akkumuliert: " << local_max_hour.points
-		<< " Punkte, Wertung von " << date_time(local_max_hour.begin->begin->time)
-		<< " bis " << date_time(local_max_hour.end->end->time) << std::endl;
-
-	std::cout << "Überland Wertung:" << std::endl;
-	auto strongest_remote = std::accumulate(
-		remote_thermals.begin(),
-		remote_thermals.end(),
-		remote_thermals.front(),
-		[](const auto& t1, const auto& t2){
-			if(t1.points > t2.points) {
-				return t1;
-			} else {
-				return t2;
+		if(arg == "--top") {
+			const int k = i + 1 < argc ? std::atoi(argv[++i]) : 0;
+			if(k <= 0) {
+				std::cerr << "--top braucht eine Anzahl größer null." << std::endl;
+				return 1;
 			}
+			options.top = k;
+			continue;
+		}
+		if(arg == "--circles") {
+			options.circles = true;
+			continue;
+		}
+		if(arg == "--resample") {
+			options.interval = i + 1 < argc ? std::atoi(argv[++i]) : 0;
+			if(options.interval <= 0) {
+				std::cerr << "--resample braucht einen Abstand in Sekunden größer null." << std::endl;
+				return 1;
+			}
+			continue;
+		}
+		if(arg == "--duplicates") {
+			if(i + 1 >= argc) {
+				std::cerr << "--duplicates braucht eine Indexdatei." << std::endl;
+				return 1;
+			}
+			duplicates_path = argv[++i];
+			// A missing index is started empty.
+			if(!duplicates.load(duplicates_path) && std::ifstream(duplicates_path)) {
+				std::cerr << "Datei " << duplicates_path << " ist kein Index von Flügen." << std::endl;
+				return 1;
+			}
+			options.duplicates = &duplicates;
+			continue;
+		}
+		if(arg == "--airfields") {
+			if(i + 1 >= argc) {
+				std::cerr << "--airfields braucht eine CUP Datei." << std::endl;
+				return 1;
+			}
+			std::string error;
+			auto db = airfields::load(argv[++i], error);
+			if(!db) {
+				std::cerr << error << std::endl;
+				return 1;
+			}
+			airfields::use(std::move(db));
+			options.airfields.push_back(argv[i]);
+			continue;
+		}
+		if(arg == "--checkpoint") {
+			if(i + 1 >= argc) {
+				std::cerr << "--checkpoint braucht eine Datei." << std::endl;
+				return 1;
+			}
+			progress.path = argv[++i];
+			continue;
+		}
+		if(arg == "--checkpoint-every") {
+			every = i + 1 < argc ? std::atoi(argv[++i]) : -1;
+			if(every < 0) {
+				std::cerr << "--checkpoint-every braucht einen Abstand in Sekunden." << std::endl;
+				return 1;
+			}
+			continue;
+		}
+		if(arg == "--serve") {
+			options.serve = i + 1 < argc ? std::atoi(argv[++i]) : 0;
+			if(options.serve <= 0 || options.serve > 65535) {
+				std::cerr << "Ungültiger Port für " << arg << "." << std::endl;
+				return 1;
+			}
+			continue;
+		}
+		// Parameters of the rules compared in variants, each with a list of values.
+		if(
+			arg == "--window" || arg == "--turn-rate" || arg == "--merge-gap" ||
+			arg == "--radius" || arg == "--glide-ratio" || arg == "--scoring-window"
+		) {
+			auto values = i + 1 < argc ? numbers(argv[++i]) : std::vector<double>();
+			if(values.empty()) {
+				std::cerr << "Ungültige Werte für " << arg << "." << std::endl;
+				return 1;
+			}
+			options.sweep.emplace_back(arg, values);
+			continue;
+		}
+		if(arg.rfind("--", 0) == 0) {
+			std::cerr << "Unbekannte Option " << arg << "." << std::endl;
+			return 1;
 		}
-	);
+		paths.push_back(arg);
+	}
 
-	std::cout << "Stärkster Bart:" << strongest_remote << std::endl;
+	if(options.top > 0 && (options.stream || options.serve)) {
+		std::cerr << "--top braucht den ganzen Flug und geht nicht mit --stream oder --serve." << std::endl;
+		return 1;
+	}
+
+	if(options.circles && (options.stream || options.serve || options.format == emit::format_t::csv)) {
+		std::cerr << "--circles braucht den ganzen Flug und geht nicht mit --stream, --serve oder CSV." << std::endl;
+		return 1;
+	}
 
-	auto remote_max_hour = find_max_hour(remote_thermals.begin(), remote_thermals.end());
-	std::cout
-		<< "60min akkumuliert: " << remote_max_hour.points
-		<< " Punkte, Wertung von " << date_time(remote_max_hour.begin->begin->time)
-		<< " bis " << date_time(remote_max_hour.end->end->time) << std::endl;
+	if(options.interval > 0 && (options.stream || options.serve)) {
+		std::cerr << "--resample braucht den ganzen Flug und geht nicht mit --stream oder --serve." << std::endl;
+		return 1;
+	}
 
-	return 0;
+	if(options.duplicates && (options.stream || options.serve || options.format == emit::format_t::csv)) {
+		std::cerr << "--duplicates braucht den ganzen Flug und geht nicht mit --stream, --serve oder CSV." << std::endl;
+		return 1;
+	}
+
+	if(every >= 0 && progress.path.empty()) {
+		std::cerr << "--checkpoint-every geht nur mit --checkpoint." << std::endl;
+		return 1;
+	}
+
+	// The index would be saved apart from the snapshot, a resumed run could
+	// find a flight as its own duplicate.
+	if(!progress.path.empty() && (options.serve || options.duplicates)) {
+		std::cerr << "--checkpoint geht nicht mit --serve oder --duplicates." << std::endl;
+		return 1;
+	}
+
+	if(options.serve) {
+		return serve(options);
+	}
+
+	if(paths.empty()) {
+		std::cerr << "Keine Datein angegeben." << std::endl;
+		return 1;
+	}
+
+	if(!options.sweep.empty() && options.format != emit::format_t::text) {
+		std::cerr << "Der Variantenvergleich gibt es nur als Text." << std::endl;
+		return 1;
+	}
+
+	io::writer writer;
+	const auto emitter = emit::make(options.format, writer);
+	const output_t out{ writer, *emitter };
+
+	if(!progress.path.empty()) {
+		progress.every = std::chrono::seconds(every >= 0 ? every : 10);
+		progress.writer = &writer;
+		progress.arguments = arguments(options, paths);
+		std::string error;
+		if(const auto snapshot = checkpoint::load(progress.path, error)) {
+			if(!progress.restore(*snapshot)) {
+				std::cerr << "Sicherung " << progress.path << " gehört zu einem anderen Aufruf." << std::endl;
+				return 1;
+			}
+		} else if(!error.empty()) {
+			std::cerr << error << std::endl;
+			return 1;
+		}
+		options.progress = &progress;
+	}
+
+	// One arena for all flights, reset in between.
+	arena_t arena;
+	int status = 0;
+	if(paths.size() == 1) {
+		io::mapped_file file(paths.front());
+		if(!file) {
+			std::cerr << "Datei " << paths.front() << " kann nicht gelesen werden." << std::endl;
+			return 1;
+		}
+		status = analyse_input(paths.front(), file.view(), arena, options, out, false);
+	} else {
+		// Many flights are read ahead while the earlier ones are scored.
+		io::bulk_reader reader;
+		reader.read(paths, [&](std::size_t i, std::string_view data, bool ok) {
+			if(!ok) {
+				if(options.progress && options.progress->skipped()) return;
+				out.emitter.file(paths[i], true);
+				std::cerr << "Datei " << paths[i] << " kann nicht gelesen werden." << std::endl;
+				status |= 1;
+				if(options.progress) options.progress->finish(1);
+				return;
+			}
+			status |= analyse_input(paths[i], data, arena, options, out, true);
+		});
+	}
+
+	if(options.duplicates && !duplicates.save(duplicates_path)) {
+		std::cerr << "Index " << duplicates_path << " kann nicht geschrieben werden." << std::endl;
+		status = 1;
+	}
+	if(options.progress) {
+		// The run is complete, the next one starts from the beginning.
+		std::error_code ec;
+		std::filesystem::remove(progress.path, ec);
+		status |= progress.status;
+	}
+	return status;
 }
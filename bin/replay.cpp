@@ -0,0 +1,243 @@
+#include <iostream>
+#include <fstream>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Load client for thermik_challenge --serve. Every glider is a TCP connection
+// streaming its fixes at N times real time, either a recorded IGC file or a
+// synthetic flight of alternating climbs and glides.
+
+// Replayed lines with the second of day they are due. Header lines are due with
+// the first fix.
+struct line_t {
+	int time;
+	std::string text;
+};
+
+std::vector<line_t> load(const std::string& path) {
+	std::vector<line_t> result;
+	std::ifstream file(path);
+	std::string line;
+	int time = -1;
+	std::vector<std::string> header;
+	while(std::getline(file, line)) {
+		if(!line.empty() && line.back() == '\r') line.pop_back();
+		if(line.size() >= 7 && line[0] == 'B') {
+			time = std::atoi(line.substr(1, 2).c_str()) * 3600 + std::atoi(line.substr(3, 2).c_str()) * 60 + std::atoi(line.substr(5, 2).c_str());
+			for(auto& h : header) {
+				result.push_back(line_t{ time, std::move(h) + '\n' });
+			}
+			header.clear();
+		}
+		if(time < 0) {
+			header.push_back(line);
+		} else {
+			result.push_back(line_t{ time, line + '\n' });
+		}
+	}
+	return result;
+}
+
+// Synthetic flight of one glider, one fix per second from 10:00. Five minutes
+// circling in a climb alternate with five minutes of straight glide, every
+// glider starts at its own spot near Dresden.
+class synthetic_t {
+
+	static constexpr int start = 10 * 3600;
+	static constexpr double pi = 3.14159265358979323846;
+	static constexpr double meters_per_degree = 111195;
+
+	double latitude;
+	double longitude;
+	double altitude = 1200;
+	double heading;
+	int seconds;
+
+public:
+
+	synthetic_t(std::size_t glider, int duration) :
+		latitude(51.1 + 0.002 * (glider % 50)),
+		longitude(13.7 + 0.002 * (glider / 50 % 50)),
+		heading(glider * 37 % 360),
+		seconds(duration)
+	{}
+
+	static std::string header() {
+		return "AXXXSYN\nHFDTE010126\nI013640TAS\n";
+	}
+
+	int begin() const {
+		return start;
+	}
+
+	int end() const {
+		return start + seconds;
+	}
+
+	// B record due at second t of the day.
+	std::string fix(int t) {
+		const bool circling = (t - start) / 300 % 2 == 0;
+		const double speed = circling ? 22 : 33;
+		heading += circling ? 14.4 : 0;
+		altitude += circling ? 1.8 : -0.9;
+
+		const double rad = heading * pi / 180;
+		latitude += speed * std::cos(rad) / meters_per_degree;
+		longitude += speed * std::sin(rad) / (meters_per_degree * std::cos(latitude * pi / 180));
+
+		auto coordinate = [](double deg, int width) {
+			const double a = std::abs(deg);
+			const int whole = static_cast<int>(a);
+			const int milliminutes = static_cast<int>(std::lround((a - whole) * 60000));
+			char text[16];
+			std::snprintf(text, sizeof(text), "%0*d%05d", width, whole, milliminutes);
+			return std::string(text);
+		};
+
+		char text[64];
+		std::snprintf(
+			text, sizeof(text), "B%02d%02d%02d%s%c%s%cA%05d%05d%05d\n",
+			t / 3600, t / 60 % 60, t % 60,
+			coordinate(latitude, 2).c_str(), latitude < 0 ? 'S' : 'N',
+			coordinate(longitude, 3).c_str(), longitude < 0 ? 'W' : 'E',
+			static_cast<int>(altitude), static_cast<int>(altitude),
+			static_cast<int>(speed * 360)
+		);
+		return text;
+	}
+
+};
+
+int connect_to(int port) {
+	int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+	if(fd < 0) return -1;
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		::close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+bool send_all(int fd, const std::string& data) {
+	std::size_t sent = 0;
+	while(sent < data.size()) {
+		ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+		if(n <= 0) return false;
+		sent += n;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	if(argc < 4) {
+		std::cerr << "Aufruf: " << argv[0] << " PORT SEGLER FAKTOR [DATEI.igc | --synthetisch STUNDEN]" << std::endl;
+		return 1;
+	}
+
+	const int port = std::atoi(argv[1]);
+	const std::size_t count = std::atoi(argv[2]);
+	const double speed = std::atof(argv[3]);
+	const std::string source = argc > 4 ? argv[4] : "igc/95iv6hr2.igc";
+	if(port <= 0 || count == 0 || !(speed > 0)) {
+		std::cerr << "Ungültige Argumente." << std::endl;
+		return 1;
+	}
+
+	std::vector<line_t> recorded;
+	std::vector<synthetic_t> synthetic;
+	int begin, end;
+	if(source == "--synthetisch") {
+		const int hours = argc > 5 ? std::atoi(argv[5]) : 4;
+		for(std::size_t g = 0; g < count; ++g) {
+			synthetic.emplace_back(g, hours * 3600);
+		}
+		begin = synthetic.front().begin();
+		end = synthetic.front().end();
+	} else {
+		recorded = load(source);
+		if(recorded.empty()) {
+			std::cerr << "Datei " << source << " kann nicht gelesen werden." << std::endl;
+			return 1;
+		}
+		begin = recorded.front().time;
+		end = recorded.back().time;
+	}
+
+	std::vector<int> gliders;
+	for(std::size_t g = 0; g < count; ++g) {
+		const int fd = connect_to(port);
+		if(fd < 0) {
+			std::cerr << "Segler " << g + 1 << " kann sich nicht verbinden." << std::endl;
+			break;
+		}
+		gliders.push_back(fd);
+		if(!synthetic.empty()) send_all(fd, synthetic_t::header());
+	}
+
+	// Every tick sends each glider the lines that came due since the last one.
+	// Recorded flights are identical for all gliders, their chunk is built once.
+	const auto start = std::chrono::steady_clock::now();
+	std::size_t next = 0;
+	std::size_t lines = 0;
+	int due = begin - 1;
+	while(due < end) {
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		const int now = std::min<int>(end, begin + static_cast<int>(elapsed.count() * speed));
+
+		std::string chunk;
+		std::size_t chunk_lines = 0;
+		for(; next < recorded.size() && recorded[next].time <= now; ++next) {
+			chunk += recorded[next].text;
+			++chunk_lines;
+		}
+		for(std::size_t g = 0; g < gliders.size(); ++g) {
+			if(!synthetic.empty()) {
+				chunk.clear();
+				chunk_lines = 0;
+				for(int t = due + 1; t <= now; ++t) {
+					chunk += synthetic[g].fix(t);
+					++chunk_lines;
+				}
+			}
+			lines += chunk_lines;
+			if(!chunk.empty() && !send_all(gliders[g], chunk)) {
+				std::cerr << "Segler " << g + 1 << " wurde getrennt." << std::endl;
+				::close(gliders[g]);
+				gliders[g] = gliders.back();
+				gliders.pop_back();
+				if(!synthetic.empty()) synthetic[g] = synthetic[gliders.size()];
+				--g;
+			}
+		}
+		due = now;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	for(int fd : gliders) {
+		::close(fd);
+	}
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::cerr
+		<< gliders.size() << " Segler, " << lines << " Zeilen in " << elapsed.count() << " s ("
+		<< lines / elapsed.count() << "/s)" << std::endl;
+	return 0;
+}
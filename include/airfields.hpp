@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <units.h>
+#include <units/gps.hpp>
+
+#include "airports.hpp"
+#include "io/mapped_file.hpp"
+
+// Airfields read from SeeYou CUP files, as SeeYou and OpenAIP export them,
+// instead of the built in list. A CUP file is compiled once into a binary
+// cache that is mapped at startup as it is: a sorted array of positions, a
+// grid of cells over it and the names. Only the airfield a flight starts
+// from is ever turned into an airport_t.
+namespace airfields {
+
+	struct cup_t {
+		std::vector<airport_t> airports;
+		// Waypoints that are no airfield or can not be read.
+		std::size_t skipped = 0;
+	};
+
+	// Airfields of a CUP file, waypoints of style 2 (grass), 4 (gliding) and
+	// 5 (paved). Columns are taken from the header line where there is one.
+	cup_t read_cup(std::string_view text);
+
+	// The cache of the given airfields.
+	std::string compile(const std::vector<airport_t>& airports);
+
+	class database_t {
+
+		// Cache file, or the compiled bytes if it could not be written.
+		io::mapped_file file;
+		std::string buffer;
+		std::string_view data;
+
+		struct header_t;
+		struct entry_t;
+		friend std::string compile(const std::vector<airport_t>& airports);
+
+		std::uint32_t count = 0;
+		std::int32_t cell = 0;
+		std::int32_t lat0 = 0, lon0 = 0;
+		std::uint32_t rows = 0, cols = 0;
+		std::size_t entries_offset = 0, cells_offset = 0, names_offset = 0;
+
+		// Airfields handed out, their addresses stay valid for the lifetime of
+		// the database.
+		mutable std::mutex lock;
+		mutable std::deque<airport_t> materialized;
+		mutable std::unordered_map<std::uint32_t, const airport_t*> by_index;
+
+		bool attach(std::string_view bytes);
+		entry_t entry(std::uint32_t index) const;
+		// First entry of a cell, cell_index + 1 gives its end.
+		std::uint32_t first(std::size_t cell_index) const;
+
+	public:
+
+		database_t() = default;
+		database_t(const database_t&) = delete;
+		database_t& operator=(const database_t&) = delete;
+
+		// Maps a cache file, null if it is no valid cache.
+		static std::unique_ptr<database_t> open(const std::string& path);
+		// Uses compiled bytes directly.
+		static std::unique_ptr<database_t> from(std::string bytes);
+
+		std::size_t size() const {
+			return count;
+		}
+
+		// Nearest airfield to position and its distance, null if there is none.
+		const airport_t* nearest(const units::gps_position& position, units::length::meter_t& distance) const;
+
+	};
+
+	// Maps the cache of a CUP file, compiling it first if it is missing or
+	// older than the file. A cache may also be given directly. Sets error and
+	// returns null if neither works.
+	std::unique_ptr<database_t> load(const std::string& path, std::string& error);
+
+	// Makes nearest_airport search db, in addition to every database used
+	// before. Call before scoring starts, databases stay until the program ends.
+	void use(std::unique_ptr<database_t> db);
+
+	// Nearest airfield over all databases in use, null if none is.
+	const airport_t* nearest(const units::gps_position& position);
+
+}
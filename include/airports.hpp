@@ -11,731 +11,736 @@ struct airport_t {
     units::length::meter_t elevation;
 };
 
-inline std::vector<airport_t> airports {
-{"Aachen Merzbruck"	, units::gps_position( 50, 49.383, 'N',	06, 11.183,'E'),	units::length::meter_t(189.0	)},
-{"Aalen Heidenheim"	, units::gps_position( 48, 46.667, 'N',	10, 15.883,'E'),	units::length::meter_t(585.0	)},
-{"Achmer"		, units::gps_position( 52, 22.633, 'N',	07, 54.800,'E'),	units::length::meter_t(53.0	)},
-{"Agathazell"		, units::gps_position( 47, 33.300, 'N',	10, 16.367,'E'),	units::length::meter_t(727.0	)},
-{"Ahlhorn"		, units::gps_position( 52, 53.333, 'N',	 8, 13.950,'E'),	units::length::meter_t(47.0	)},
-{"Ahrenlohe"		, units::gps_position( 53, 42.000, 'N',	 9, 44.483,'E'),	units::length::meter_t(7.0	)},
-{"Aichach"		, units::gps_position( 48, 28.400, 'N',	11, 08.133,'E'),	units::length::meter_t(439.0	)},
-{"Ailertchen"		, units::gps_position( 50, 35.550, 'N',	07, 56.667,'E'),	units::length::meter_t(469.0	)},
-{"Albstadt Degerfeld"	, units::gps_position( 48, 14.983, 'N',	 9, 03.833,'E'),	units::length::meter_t(891.0	)},
-{"Allendorf"		, units::gps_position( 51, 02.100, 'N',	 8, 40.850,'E'),	units::length::meter_t(354.0	)},
-{"Allstedt"		, units::gps_position( 51, 22.833, 'N',	11, 26.800,'E'),	units::length::meter_t(284.0	)},
-{"Alsfeld"		, units::gps_position( 50, 45.033, 'N',	 9, 14.917,'E'),	units::length::meter_t(292.0	)},
-{"Altdorf Hagenhausen"	, units::gps_position( 49, 23.217, 'N',	11, 25.267,'E'),	units::length::meter_t(538.0	)},
-{"Altdorf Wallburg"	, units::gps_position( 48, 16.200, 'N',	07, 50.533,'E'),	units::length::meter_t(194.0	)},
-{"Alte Ems Herbrum"	, units::gps_position( 53, 01.847, 'N',	07, 18.210,'E'),	units::length::meter_t(1.0	)},
-{"Altena Hegenscheid"	, units::gps_position( 51, 18.783, 'N',	07, 42.217,'E'),	units::length::meter_t(473.0	)},
-{"Altenbachtal"		, units::gps_position( 49, 55.367, 'N',	 9, 09.483,'E'),	units::length::meter_t(130.0	)},
-{"Altenstadt Mil"	, units::gps_position( 47, 50.133, 'N',	10, 52.267,'E'),	units::length::meter_t(737.0	)},
-{"Altfeld"		, units::gps_position( 49, 49.917, 'N',	 9, 32.233,'E'),	units::length::meter_t(354.0	)},
-{"Altoetting"		, units::gps_position( 48, 12.967, 'N',	12, 38.900,'E'),	units::length::meter_t(398.0	)},
-{"Am Kreuzberg"		, units::gps_position( 50, 18.406, 'N',	10, 22.780,'E'),	units::length::meter_t(262.0	)},
-{"Am Salzgittersee"	, units::gps_position( 52, 10.217, 'N',	10, 18.950,'E'),	units::length::meter_t(81.0	)},
-{"Am Stauffenberg"	, units::gps_position( 51, 21.717, 'N',	 9, 37.767,'E'),	units::length::meter_t(369.0	)},
-{"Amberg"		, units::gps_position( 49, 26.350, 'N',	11, 48.383,'E'),	units::length::meter_t(388.0	)},
-{"Amoeneburg"		, units::gps_position( 50, 47.433, 'N',	 8, 54.483,'E'),	units::length::meter_t(230.0	)},
-{"Ampfing Waldkraiburg"	, units::gps_position( 48, 15.800, 'N',	12, 24.733,'E'),	units::length::meter_t(415.0	)},
-{"An Den 7 Bergen"	, units::gps_position( 52, 03.450, 'N',	 9, 48.633,'E'),	units::length::meter_t(135.0	)},
-{"Anklam"		, units::gps_position( 53, 49.967, 'N',	13, 40.133,'E'),	units::length::meter_t(6.0	)},
-{"Ansbach Petersdorf"	, units::gps_position( 49, 21.650, 'N',	10, 40.100,'E'),	units::length::meter_t(418.0	)},
-{"Anspach Taunus"	, units::gps_position( 50, 17.333, 'N',	 8, 32.117,'E'),	units::length::meter_t(335.0	)},
-{"Antersberg"		, units::gps_position( 47, 57.767, 'N',	11, 59.767,'E'),	units::length::meter_t(498.0	)},
-{"Arnbruck"		, units::gps_position( 49, 07.533, 'N',	12, 59.117,'E'),	units::length::meter_t(524.0	)},
-{"Arnsberg-Menden"	, units::gps_position( 51, 29.017, 'N',	07, 53.883,'E'),	units::length::meter_t(241.0	)},
-{"Arnstadt Alkersleben"	, units::gps_position( 50, 50.517, 'N',	11, 04.200,'E'),	units::length::meter_t(351.0	)},
-{"Aschaffenburg"	, units::gps_position( 49, 56.333, 'N',	 9, 03.750,'E'),	units::length::meter_t(125.0	)},
-{"Aschersleben"		, units::gps_position( 51, 46.017, 'N',	11, 29.933,'E'),	units::length::meter_t(162.0	)},
-{"Asslarer Huette"	, units::gps_position( 50, 35.983, 'N',	 8, 26.633,'E'),	units::length::meter_t(232.0	)},
-{"Attendorn Finnentrop"	, units::gps_position( 51, 08.750, 'N',	07, 56.183,'E'),	units::length::meter_t(317.0	)},
-{"Aue bei Hattorf"	, units::gps_position( 51, 38.000, 'N',	10, 15.283,'E'),	units::length::meter_t(190.0	)},
-{"Auerbach"		, units::gps_position( 50, 29.833, 'N',	12, 22.683,'E'),	units::length::meter_t(573.0	)},
-{"Augsburg"		, units::gps_position( 48, 25.517, 'N',	10, 55.900,'E'),	units::length::meter_t(463.0	)},
-{"Aukrug"		, units::gps_position( 54, 03.883, 'N',	 9, 47.900,'E'),	units::length::meter_t(17.0	)},
-{"Aventoft"		, units::gps_position( 54, 53.767, 'N',	 8, 49.233,'E'),	units::length::meter_t(2.0	)},
-{"Babenhausen"		, units::gps_position( 49, 57.167, 'N',	 8, 58.150,'E'),	units::length::meter_t(133.0	)},
-{"Backnang-Heiningen"	, units::gps_position( 48, 55.190, 'N',	 9, 27.320,'E'),	units::length::meter_t(294.0	)},
-{"Bad Berka"		, units::gps_position( 50, 54.233, 'N',	11, 15.517,'E'),	units::length::meter_t(305.0	)},
-{"Bad Brueckenau"	, units::gps_position( 50, 16.317, 'N',	 9, 49.417,'E'),	units::length::meter_t(402.0	)},
-{"Bad Ditzenbach"	, units::gps_position( 48, 33.767, 'N',	 9, 43.733,'E'),	units::length::meter_t(730.0	)},
-{"Bad Duerkheim"	, units::gps_position( 49, 28.383, 'N',	 8, 11.783,'E'),	units::length::meter_t(107.0	)},
-{"Bad Endorf Jolling"	, units::gps_position( 47, 55.617, 'N',	12, 17.233,'E'),	units::length::meter_t(514.0	)},
-{"Bad Frankenhausen"	, units::gps_position( 51, 22.367, 'N',	11, 08.583,'E'),	units::length::meter_t(241.0	)},
-{"Bad Gandersheim"	, units::gps_position( 51, 51.150, 'N',	10, 01.567,'E'),	units::length::meter_t(239.0	)},
-{"Bad Hersfeld"		, units::gps_position( 50, 50.667, 'N',	 9, 42.433,'E'),	units::length::meter_t(239.0	)},
-{"Bad Kissingen"	, units::gps_position( 50, 12.633, 'N',	10, 04.167,'E'),	units::length::meter_t(198.0	)},
-{"Bad Koenigshofen"	, units::gps_position( 50, 17.250, 'N',	10, 25.317,'E'),	units::length::meter_t(313.0	)},
-{"Bad Langensalza"	, units::gps_position( 51, 07.750, 'N',	10, 37.300,'E'),	units::length::meter_t(199.0	)},
-{"Bad Marienberg"	, units::gps_position( 50, 39.650, 'N',	 8, 01.717,'E'),	units::length::meter_t(544.0	)},
-{"Bad Neuenahr Ahrweiler"	, units::gps_position( 50, 33.467, 'N',	07, 08.233,'E'),	units::length::meter_t(204.0	)},
-{"Bad Neustadt/Saale"	, units::gps_position( 50, 18.367, 'N',	10, 13.633,'E'),	units::length::meter_t(303.0	)},
-{"Bad Sobernheim"	, units::gps_position( 49, 47.483, 'N',	07, 40.000,'E'),	units::length::meter_t(244.0	)},
-{"Bad Waldsee Reute"	, units::gps_position( 47, 54.900, 'N',	 9, 42.600,'E'),	units::length::meter_t(577.0	)},
-{"Bad Wildungen"	, units::gps_position( 51, 05.633, 'N',	 9, 08.900,'E'),	units::length::meter_t(332.0	)},
-{"Bad Windsheim"	, units::gps_position( 49, 30.617, 'N',	10, 21.967,'E'),	units::length::meter_t(370.0	)},
-{"Bad Woerishofen Gld"	, units::gps_position( 48, 01.615, 'N',	10, 36.136,'E'),	units::length::meter_t(619.0	)},
-{"Bad Woerishofen-Nord"	, units::gps_position( 48, 00.983, 'N',	10, 36.900,'E'),	units::length::meter_t(619.0	)},
-{"Bad Zwischenahn"	, units::gps_position( 53, 12.617, 'N',	07, 59.317,'E'),	units::length::meter_t(9.0	)},
-{"Baden Oos"		, units::gps_position( 48, 47.450, 'N',	 8, 11.050,'E'),	units::length::meter_t(125.0	)},
-{"Ballenstedt"		, units::gps_position( 51, 44.750, 'N',	11, 13.750,'E'),	units::length::meter_t(153.0	)},
-{"Baltrum"		, units::gps_position( 53, 43.517, 'N',	07, 22.333,'E'),	units::length::meter_t(3.0	)},
-{"Bamberg"		, units::gps_position( 49, 55.233, 'N',	10, 54.850,'E'),	units::length::meter_t(250.0	)},
-{"Barssel"		, units::gps_position( 53, 09.867, 'N',	07, 47.650,'E'),	units::length::meter_t(3.0	)},
-{"Barth"		, units::gps_position( 54, 20.300, 'N',	12, 42.617,'E'),	units::length::meter_t(6.0	)},
-{"Bartholomae Amalienhof"	, units::gps_position( 48, 44.800, 'N',	10, 00.300,'E'),	units::length::meter_t(637.0	)},
-{"Baumerlenbach"	, units::gps_position( 49, 13.833, 'N',	 9, 25.150,'E'),	units::length::meter_t(236.0	)},
-{"Baumholder Mil"	, units::gps_position( 49, 39.100, 'N',	07, 18.433,'E'),	units::length::meter_t(442.0	)},
-{"Bautzen"		, units::gps_position( 51, 11.617, 'N',	14, 31.183,'E'),	units::length::meter_t(174.0	)},
-{"Bayreuth"		, units::gps_position( 49, 59.117, 'N',	11, 38.467,'E'),	units::length::meter_t(482.0	)},
-{"Beelen"		, units::gps_position( 51, 55.900, 'N',	 8, 04.900,'E'),	units::length::meter_t(59.0	)},
-{"Beilngries"		, units::gps_position( 49, 01.267, 'N',	11, 29.083,'E'),	units::length::meter_t(365.0	)},
-{"Benediktbeuren"	, units::gps_position( 47, 42.950, 'N',	11, 23.433,'E'),	units::length::meter_t(609.0	)},
-{"Bensheimer Stadtwiesen"	, units::gps_position( 49, 41.517, 'N',	 8, 34.967,'E'),	units::length::meter_t(93.0	)},
-{"Bergheim"		, units::gps_position( 50, 58.617, 'N',	06, 36.500,'E'),	units::length::meter_t(70.0	)},
-{"Bergneustadt"		, units::gps_position( 51, 03.117, 'N',	07, 42.433,'E'),	units::length::meter_t(481.0	)},
-{"Berlin Schoenefeld"	, units::gps_position( 52, 22.717, 'N',	13, 31.233,'E'),	units::length::meter_t(49.0	)},
-{"Berlin Tegel"		, units::gps_position( 52, 33.583, 'N',	13, 17.267,'E'),	units::length::meter_t(37.0	)},
-{"Berliner Heide"	, units::gps_position( 52, 40.183, 'N',	10, 22.233,'E'),	units::length::meter_t(69.0	)},
-{"Berneck"		, units::gps_position( 48, 34.383, 'N',	 9, 43.783,'E'),	units::length::meter_t(746.0	)},
-{"Betzdorf Kirchen"	, units::gps_position( 50, 49.017, 'N',	07, 49.817,'E'),	units::length::meter_t(351.0	)},
-{"Biberach Riss"	, units::gps_position( 48, 06.700, 'N',	 9, 45.800,'E'),	units::length::meter_t(580.0	)},
-{"Bielefeld"		, units::gps_position( 51, 57.883, 'N',	 8, 32.683,'E'),	units::length::meter_t(137.0	)},
-{"Bienenfarm"		, units::gps_position( 52, 39.733, 'N',	12, 44.717,'E'),	units::length::meter_t(27.0	)},
-{"Binningen"		, units::gps_position( 47, 47.967, 'N',	 8, 43.217,'E'),	units::length::meter_t(489.0	)},
-{"Bischofsberg"		, units::gps_position( 50, 25.933, 'N',	10, 17.000,'E'),	units::length::meter_t(342.0	)},
-{"Bisperode West"	, units::gps_position( 52, 04.733, 'N',	 9, 28.567,'E'),	units::length::meter_t(194.0	)},
-{"Bitburg"		, units::gps_position( 49, 56.717, 'N',	06, 33.900,'E'),	units::length::meter_t(372.0	)},
-{"Blaubeuren"		, units::gps_position( 48, 25.183, 'N',	 9, 47.850,'E'),	units::length::meter_t(677.0	)},
-{"Blexen"		, units::gps_position( 53, 32.350, 'N',	 8, 32.367,'E'),	units::length::meter_t(3.0	)},
-{"Blomberg Borkhausen"	, units::gps_position( 51, 55.033, 'N',	 9, 06.667,'E'),	units::length::meter_t(182.0	)},
-{"Blumberg"		, units::gps_position( 47, 50.667, 'N',	 8, 33.917,'E'),	units::length::meter_t(701.0	)},
-{"Boberg"		, units::gps_position( 53, 30.883, 'N',	10, 08.650,'E'),	units::length::meter_t(2.0	)},
-{"Boehlen"		, units::gps_position( 51, 12.967, 'N',	12, 22.100,'E'),	units::length::meter_t(131.0	)},
-{"Bohlenberger Feld"	, units::gps_position( 53, 25.100, 'N',	07, 54.250,'E'),	units::length::meter_t(6.0	)},
-{"Bohlhof"		, units::gps_position( 47, 39.050, 'N',	 8, 23.200,'E'),	units::length::meter_t(558.0	)},
-{"Bohmte Bad Essen"	, units::gps_position( 52, 21.067, 'N',	 8, 19.683,'E'),	units::length::meter_t(45.0	)},
-{"Bonn Hangelar"	, units::gps_position( 50, 46.133, 'N',	07, 09.767,'E'),	units::length::meter_t(61.0	)},
-{"Bopfingen"		, units::gps_position( 48, 50.900, 'N',	10, 20.050,'E'),	units::length::meter_t(619.0	)},
-{"Borghorst Fuechten"	, units::gps_position( 52, 09.017, 'N',	07, 27.117,'E'),	units::length::meter_t(47.0	)},
-{"Borken Hoxfeld"	, units::gps_position( 51, 51.183, 'N',	06, 48.917,'E'),	units::length::meter_t(49.0	)},
-{"Borkenberge"		, units::gps_position( 51, 46.800, 'N',	07, 17.283,'E'),	units::length::meter_t(49.0	)},
-{"Borkum"		, units::gps_position( 53, 35.650, 'N',	06, 42.967,'E'),	units::length::meter_t(1.0	)},
-{"Bottenhorn"		, units::gps_position( 50, 47.683, 'N',	 8, 27.650,'E'),	units::length::meter_t(516.0	)},
-{"Brandenburg Muehlenfeld"	, units::gps_position( 52, 26.217, 'N',	12, 35.583,'E'),	units::length::meter_t(28.0	)},
-{"Brannenburg"		, units::gps_position( 47, 44.333, 'N',	12, 06.967,'E'),	units::length::meter_t(467.0	)},
-{"Braunfels"		, units::gps_position( 50, 31.533, 'N',	 8, 23.583,'E'),	units::length::meter_t(240.0	)},
-{"Braunschweig"		, units::gps_position( 52, 19.150, 'N',	10, 33.267,'E'),	units::length::meter_t(92.0	)},
-{"Breitscheid"		, units::gps_position( 50, 40.617, 'N',	 8, 10.183,'E'),	units::length::meter_t(562.0	)},
-{"Bremen"		, units::gps_position( 53, 02.850, 'N',	 8, 47.217,'E'),	units::length::meter_t(3.0	)},
-{"Bremgarten"		, units::gps_position( 47, 54.200, 'N',	07, 37.050,'E'),	units::length::meter_t(213.0	)},
-{"Brilon"		, units::gps_position( 51, 24.150, 'N',	 8, 38.517,'E'),	units::length::meter_t(460.0	)},
-{"Brockzetel"		, units::gps_position( 53, 28.883, 'N',	07, 39.100,'E'),	units::length::meter_t(9.0	)},
-{"Bronkow"		, units::gps_position( 51, 40.317, 'N',	13, 57.817,'E'),	units::length::meter_t(128.0	)},
-{"Bruchsal"		, units::gps_position( 49, 08.117, 'N',	 8, 33.817,'E'),	units::length::meter_t(113.0	)},
-{"Buechel Mil"		, units::gps_position( 50, 10.433, 'N',	07, 03.800,'E'),	units::length::meter_t(479.0	)},
-{"Buechig Ostheim"	, units::gps_position( 50, 26.900, 'N',	10, 15.150,'E'),	units::length::meter_t(388.0	)},
-{"Bueckeburg Achum Mil"	, units::gps_position( 52, 16.700, 'N',	 9, 04.933,'E'),	units::length::meter_t(70.0	)},
-{"Bueckeburg Wein"	, units::gps_position( 52, 15.050, 'N',	 9, 01.067,'E'),	units::length::meter_t(77.0	)},
-{"Bueren Schwalenberg"	, units::gps_position( 51, 32.567, 'N',	 8, 34.833,'E'),	units::length::meter_t(265.0	)},
-{"Bundenthal Rumbach"	, units::gps_position( 49, 05.633, 'N',	07, 47.633,'E'),	units::length::meter_t(308.0	)},
-{"Burg Feuerstein"	, units::gps_position( 49, 47.650, 'N',	11, 08.033,'E'),	units::length::meter_t(501.0	)},
-{"Burg"		, units::gps_position( 52, 14.500, 'N',	11, 51.367,'E'),	units::length::meter_t(52.0	)},
-{"Burgberg Witzenhausen"	, units::gps_position( 51, 20.984, 'N',	 9, 49.489,'E'),	units::length::meter_t(198.0	)},
-{"Burgheim"		, units::gps_position( 48, 41.517, 'N',	11, 02.017,'E'),	units::length::meter_t(406.0	)},
-{"Butzbach Pfingstweide"	, units::gps_position( 50, 26.150, 'N',	 8, 37.167,'E'),	units::length::meter_t(340.0	)},
-{"Celle Arloh"		, units::gps_position( 52, 41.267, 'N',	10, 06.733,'E'),	units::length::meter_t(64.0	)},
-{"Celle Mil"		, units::gps_position( 52, 35.467, 'N',	10, 01.333,'E'),	units::length::meter_t(40.0	)},
-{"Cham Janahof"		, units::gps_position( 49, 12.700, 'N',	12, 39.400,'E'),	units::length::meter_t(364.0	)},
-{"Chemnitz Jahnsdorf"	, units::gps_position( 50, 44.850, 'N',	12, 50.233,'E'),	units::length::meter_t(370.0	)},
-{"Coburg Brandensteinsebene"	, units::gps_position( 50, 15.750, 'N',	10, 59.750,'E'),	units::length::meter_t(449.0	)},
-{"Coburg Steinruecken"	, units::gps_position( 50, 13.833, 'N',	10, 59.717,'E'),	units::length::meter_t(356.0	)},
-{"Cottbus Drewitz"	, units::gps_position( 51, 53.367, 'N',	14, 31.917,'E'),	units::length::meter_t(82.0	)},
-{"Dachau Groebenried"	, units::gps_position( 48, 13.717, 'N',	11, 25.367,'E'),	units::length::meter_t(489.0	)},
-{"Dahlemer Binz"	, units::gps_position( 50, 24.333, 'N',	06, 31.733,'E'),	units::length::meter_t(579.0	)},
-{"Damme"		, units::gps_position( 52, 29.250, 'N',	 8, 11.100,'E'),	units::length::meter_t(46.0	)},
-{"Dauborn"		, units::gps_position( 50, 19.300, 'N',	 8, 11.633,'E'),	units::length::meter_t(164.0	)},
-{"Daun Senheld"		, units::gps_position( 50, 10.550, 'N',	06, 51.467,'E'),	units::length::meter_t(526.0	)},
-{"Deckenpfronn Egelsee"	, units::gps_position( 48, 38.300, 'N',	 8, 49.050,'E'),	units::length::meter_t(578.0	)},
-{"Deggendorf"		, units::gps_position( 48, 49.817, 'N',	12, 52.783,'E'),	units::length::meter_t(314.0	)},
-{"Degmarn"		, units::gps_position( 49, 15.467, 'N',	 9, 16.467,'E'),	units::length::meter_t(169.0	)},
-{"Dehausen Diemelstadt"	, units::gps_position( 51, 27.800, 'N',	 9, 02.967,'E'),	units::length::meter_t(305.0	)},
-{"Der Dingel Huemme"	, units::gps_position( 51, 32.167, 'N',	 9, 22.783,'E'),	units::length::meter_t(220.0	)},
-{"Der Ring Schwalmstadt"	, units::gps_position( 50, 54.183, 'N',	 9, 14.433,'E'),	units::length::meter_t(212.0	)},
-{"Dessau"		, units::gps_position( 51, 49.900, 'N',	12, 11.067,'E'),	units::length::meter_t(56.0	)},
-{"Detmold"		, units::gps_position( 51, 56.450, 'N',	 8, 54.250,'E'),	units::length::meter_t(189.0	)},
-{"Dettingen Teck"	, units::gps_position( 48, 36.500, 'N',	 9, 28.533,'E'),	units::length::meter_t(386.0	)},
-{"Diepholz Mil"		, units::gps_position( 52, 35.133, 'N',	 8, 20.467,'E'),	units::length::meter_t(40.0	)},
-{"Dierdorf Wienau"	, units::gps_position( 50, 33.950, 'N',	07, 39.150,'E'),	units::length::meter_t(291.0	)},
-{"Dillingen"		, units::gps_position( 49, 23.167, 'N',	06, 44.917,'E'),	units::length::meter_t(239.0	)},
-{"Dingolfing"		, units::gps_position( 48, 39.400, 'N',	12, 29.933,'E'),	units::length::meter_t(352.0	)},
-{"Dinkelsbuehl"		, units::gps_position( 49, 03.900, 'N',	10, 24.150,'E'),	units::length::meter_t(488.0	)},
-{"Dinslaken Schwarze Heide"	, units::gps_position( 51, 36.967, 'N',	06, 51.933,'E'),	units::length::meter_t(65.0	)},
-{"Dobenreuth"		, units::gps_position( 49, 41.817, 'N',	11, 08.600,'E'),	units::length::meter_t(338.0	)},
-{"Donaueschingen"	, units::gps_position( 47, 58.417, 'N',	 8, 31.333,'E'),	units::length::meter_t(680.0	)},
-{"Donauwoerth Genderkirchen"	, units::gps_position( 48, 42.183, 'N',	10, 51.133,'E'),	units::length::meter_t(399.0	)},
-{"Donzdorf Messelberg"	, units::gps_position( 48, 40.717, 'N',	 9, 50.750,'E'),	units::length::meter_t(690.0	)},
-{"Dorsten Kanal"	, units::gps_position( 51, 39.733, 'N',	06, 59.100,'E'),	units::length::meter_t(32.0	)},
-{"Dortmund Wickede"	, units::gps_position( 51, 31.150, 'N',	07, 36.867,'E'),	units::length::meter_t(128.0	)},
-{"Dresden"		, units::gps_position( 51, 08.067, 'N',	13, 46.083,'E'),	units::length::meter_t(229.0	)},
-{"Dueren Huertgenwald"	, units::gps_position( 50, 41.633, 'N',	06, 25.100,'E'),	units::length::meter_t(360.0	)},
-{"Duesseldorf Wolfsaap"	, units::gps_position( 51, 15.883, 'N',	06, 51.217,'E'),	units::length::meter_t(113.0	)},
-{"Duesseldorf"		, units::gps_position( 51, 17.267, 'N',	06, 46.150,'E'),	units::length::meter_t(37.0	)},
-{"Ebern Sendelbach"	, units::gps_position( 50, 02.383, 'N',	10, 49.367,'E'),	units::length::meter_t(253.0	)},
-{"Eberswalde Finow"	, units::gps_position( 52, 49.633, 'N',	13, 41.617,'E'),	units::length::meter_t(37.0	)},
-{"Egelsbach"		, units::gps_position( 49, 57.650, 'N',	 8, 38.483,'E'),	units::length::meter_t(119.0	)},
-{"Eggenfelden"		, units::gps_position( 48, 23.767, 'N',	12, 43.283,'E'),	units::length::meter_t(407.0	)},
-{"Eggersdorf"		, units::gps_position( 52, 28.967, 'N',	14, 05.450,'E'),	units::length::meter_t(67.0	)},
-{"Eibinger Forstwiesen "	, units::gps_position( 50, 01.082, 'N',	07, 53.608,'E'),	units::length::meter_t(392.0	)},
-{"Eichstaett"		, units::gps_position( 48, 52.617, 'N',	11, 10.900,'E'),	units::length::meter_t(524.0	)},
-{"Eisenach Kindel"	, units::gps_position( 50, 59.533, 'N',	10, 28.567,'E'),	units::length::meter_t(335.0	)},
-{"Eisenhuettenstadt"	, units::gps_position( 52, 11.833, 'N',	14, 35.133,'E'),	units::length::meter_t(46.0	)},
-{"Ellwangen"		, units::gps_position( 48, 57.683, 'N',	10, 14.083,'E'),	units::length::meter_t(503.0	)},
-{"Elsenthal Grafenau"	, units::gps_position( 48, 49.350, 'N',	13, 22.050,'E'),	units::length::meter_t(485.0	)},
-{"Elz"		, units::gps_position( 50, 25.600, 'N',	 8, 00.600,'E'),	units::length::meter_t(213.0	)},
-{"Emden"		, units::gps_position( 53, 23.467, 'N',	07, 13.533,'E'),	units::length::meter_t(1.0	)},
-{"Emmerich"		, units::gps_position( 51, 49.333, 'N',	06, 16.467,'E'),	units::length::meter_t(13.0	)},
-{"Erbach"		, units::gps_position( 48, 20.517, 'N',	 9, 55.000,'E'),	units::length::meter_t(476.0	)},
-{"Erbendorf Schweisslohe"	, units::gps_position( 49, 50.633, 'N',	12, 04.017,'E'),	units::length::meter_t(494.0	)},
-{"Erding Mil"		, units::gps_position( 48, 19.333, 'N',	11, 56.917,'E'),	units::length::meter_t(463.0	)},
-{"Erfurt"		, units::gps_position( 50, 58.783, 'N',	10, 57.483,'E'),	units::length::meter_t(317.0	)},
-{"Essen Muelheim"	, units::gps_position( 51, 24.133, 'N',	06, 56.233,'E'),	units::length::meter_t(128.0	)},
-{"Esslingen Jaegerhaus"	, units::gps_position( 48, 45.733, 'N',	 9, 20.033,'E'),	units::length::meter_t(496.0	)},
-{"Essweiler"		, units::gps_position( 49, 33.733, 'N',	07, 34.800,'E'),	units::length::meter_t(409.0	)},
-{"Eudenbach"		, units::gps_position( 50, 40.333, 'N',	07, 21.917,'E'),	units::length::meter_t(300.0	)},
-{"Eutingen Gaeu"	, units::gps_position( 48, 29.133, 'N',	 8, 46.700,'E'),	units::length::meter_t(497.0	)},
-{"Falkenberg Loennewitz"	, units::gps_position( 51, 32.867, 'N',	13, 13.683,'E'),	units::length::meter_t(85.0	)},
-{"Farrenberg"		, units::gps_position( 48, 23.133, 'N',	 9, 04.600,'E'),	units::length::meter_t(794.0	)},
-{"Fassberg Mil"		, units::gps_position( 52, 55.150, 'N',	10, 11.033,'E'),	units::length::meter_t(70.0	)},
-{"Fichtelbrunn"		, units::gps_position( 49, 29.883, 'N',	11, 39.567,'E'),	units::length::meter_t(498.0	)},
-{"Finsterw Heinrichsruh"	, units::gps_position( 51, 38.067, 'N',	13, 40.317,'E'),	units::length::meter_t(127.0	)},
-{"Finsterwalde Schacksdorf"	, units::gps_position( 51, 36.450, 'N',	13, 44.283,'E'),	units::length::meter_t(122.0	)},
-{"Fischbek"		, units::gps_position( 53, 27.350, 'N',	 9, 49.783,'E'),	units::length::meter_t(64.0	)},
-{"Flensburg"		, units::gps_position( 54, 46.400, 'N',	 9, 22.733,'E'),	units::length::meter_t(40.0	)},
-{"Frankfurt Engelsbach"	, units::gps_position( 49, 57.633, 'N',	 8, 38.483,'E'),	units::length::meter_t(115.0	)},
-{"Frankfurt Hahn"	, units::gps_position( 49, 56.917, 'N',	07, 15.833,'E'),	units::length::meter_t(503.0	)},
-{"Frankfurt Main"	, units::gps_position( 50, 02.000, 'N',	 8, 34.233,'E'),	units::length::meter_t(110.0	)},
-{"Freiburg i.Br."	, units::gps_position( 48, 01.367, 'N',	07, 49.967,'E'),	units::length::meter_t(242.0	)},
-{"Friedersdorf"		, units::gps_position( 52, 16.917, 'N',	13, 48.133,'E'),	units::length::meter_t(33.0	)},
-{"Friedrichshafen"	, units::gps_position( 47, 40.283, 'N',	 9, 30.683,'E'),	units::length::meter_t(418.0	)},
-{"Friesener Warte"	, units::gps_position( 49, 50.183, 'N',	11, 02.800,'E'),	units::length::meter_t(517.0	)},
-{"Fritzlar Mil"		, units::gps_position( 51, 06.883, 'N',	 9, 17.150,'E'),	units::length::meter_t(174.0	)},
-{"Fuerstenzell"		, units::gps_position( 48, 31.083, 'N',	13, 20.767,'E'),	units::length::meter_t(412.0	)},
-{"Fuerth Seckendorf"	, units::gps_position( 49, 28.883, 'N',	10, 51.517,'E'),	units::length::meter_t(334.0	)},
-{"Fuessen"		, units::gps_position( 47, 35.000, 'N',	10, 41.450,'E'),	units::length::meter_t(787.0	)},
-{"Fulda Jossa"		, units::gps_position( 50, 28.517, 'N',	 9, 26.533,'E'),	units::length::meter_t(471.0	)},
-{"Gammelsdorf"		, units::gps_position( 48, 34.067, 'N',	11, 55.950,'E'),	units::length::meter_t(495.0	)},
-{"Ganderkesee Atlas"	, units::gps_position( 53, 02.167, 'N',	 8, 30.317,'E'),	units::length::meter_t(31.0	)},
-{"Garbenheimer Wiesen"	, units::gps_position( 50, 34.500, 'N',	 8, 31.917,'E'),	units::length::meter_t(151.0	)},
-{"Gardelegen"		, units::gps_position( 52, 31.833, 'N',	11, 21.217,'E'),	units::length::meter_t(73.0	)},
-{"Gedern"		, units::gps_position( 50, 25.950, 'N',	 9, 11.667,'E'),	units::length::meter_t(371.0	)},
-{"Geilenkirchen Mil"	, units::gps_position( 50, 57.650, 'N',	06, 02.550,'E'),	units::length::meter_t(92.0	)},
-{"Geitau"		, units::gps_position( 47, 40.767, 'N',	11, 57.733,'E'),	units::length::meter_t(818.0	)},
-{"Gelnhausen"		, units::gps_position( 50, 11.783, 'N',	 9, 10.067,'E'),	units::length::meter_t(126.0	)},
-{"Gera Leumnitz"	, units::gps_position( 50, 52.883, 'N',	12, 08.133,'E'),	units::length::meter_t(307.0	)},
-{"Geratshof"		, units::gps_position( 47, 59.583, 'N',	10, 50.617,'E'),	units::length::meter_t(634.0	)},
-{"Gerstetten"		, units::gps_position( 48, 37.233, 'N',	10, 03.667,'E'),	units::length::meter_t(599.0	)},
-{"Giebelstadt"		, units::gps_position( 49, 38.900, 'N',	 9, 57.983,'E'),	units::length::meter_t(299.0	)},
-{"Giengen Brenz"	, units::gps_position( 48, 38.033, 'N',	10, 13.000,'E'),	units::length::meter_t(518.0	)},
-{"Giessen Lutzellinden"	, units::gps_position( 50, 32.667, 'N',	 8, 35.450,'E'),	units::length::meter_t(232.0	)},
-{"Giessen Reiskirchen"	, units::gps_position( 50, 34.000, 'N',	 8, 52.183,'E'),	units::length::meter_t(213.0	)},
-{"Giessen Wieseck"	, units::gps_position( 50, 36.250, 'N',	 8, 43.717,'E'),	units::length::meter_t(165.0	)},
-{"Goch Asperden"	, units::gps_position( 51, 41.450, 'N',	06, 06.233,'E'),	units::length::meter_t(16.0	)},
-{"Goeppingen Betzg"	, units::gps_position( 48, 39.517, 'N',	 9, 37.450,'E'),	units::length::meter_t(374.0	)},
-{"Goerlitz"		, units::gps_position( 51, 09.533, 'N',	14, 57.017,'E'),	units::length::meter_t(238.0	)},
-{"Goettingen Heiligenstadt"	, units::gps_position( 51, 24.450, 'N',	10, 08.683,'E'),	units::length::meter_t(363.0	)},
-{"Goslar Bollrich"	, units::gps_position( 51, 54.283, 'N',	10, 27.550,'E'),	units::length::meter_t(295.0	)},
-{"Gotha Ost"		, units::gps_position( 50, 58.217, 'N',	10, 43.750,'E'),	units::length::meter_t(305.0	)},
-{"Grabenstaett"		, units::gps_position( 47, 51.167, 'N',	12, 33.067,'E'),	units::length::meter_t(537.0	)},
-{"Grabenstetten"	, units::gps_position( 48, 32.167, 'N',	 9, 26.233,'E'),	units::length::meter_t(710.0	)},
-{"Grafenwoehr Mil"	, units::gps_position( 49, 41.917, 'N',	11, 56.417,'E'),	units::length::meter_t(415.0	)},
-{"Grambeker Heide"	, units::gps_position( 53, 35.000, 'N',	10, 41.917,'E'),	units::length::meter_t(48.0	)},
-{"Gransee"		, units::gps_position( 53, 00.400, 'N',	13, 12.117,'E'),	units::length::meter_t(51.0	)},
-{"Greding"		, units::gps_position( 49, 03.733, 'N',	11, 17.517,'E'),	units::length::meter_t(525.0	)},
-{"Grefrath Niershorst"	, units::gps_position( 51, 20.050, 'N',	06, 21.583,'E'),	units::length::meter_t(31.0	)},
-{"Greiling B Toelz"	, units::gps_position( 47, 45.917, 'N',	11, 35.717,'E'),	units::length::meter_t(713.0	)},
-{"Greiz Obergrochlitz"	, units::gps_position( 50, 38.650, 'N',	12, 10.500,'E'),	units::length::meter_t(387.0	)},
-{"Griesau"		, units::gps_position( 48, 57.250, 'N',	12, 25.283,'E'),	units::length::meter_t(321.0	)},
-{"Grifte Edermuend"	, units::gps_position( 51, 13.267, 'N',	 9, 26.867,'E'),	units::length::meter_t(202.0	)},
-{"Grosse Hoehe Ehlershausen"	, units::gps_position( 52, 32.150, 'N',	10, 01.183,'E'),	units::length::meter_t(45.0	)},
-{"Grosse Hoehe"		, units::gps_position( 52, 59.183, 'N',	 8, 34.333,'E'),	units::length::meter_t(20.0	)},
-{"Grosse Wiese"		, units::gps_position( 52, 08.233, 'N',	10, 34.250,'E'),	units::length::meter_t(78.0	)},
-{"Grossenhain"		, units::gps_position( 51, 18.483, 'N',	13, 33.333,'E'),	units::length::meter_t(128.0	)},
-{"Grossrueckerswalde"	, units::gps_position( 50, 38.650, 'N',	13, 07.717,'E'),	units::length::meter_t(671.0	)},
-{"Grube"		, units::gps_position( 54, 14.667, 'N',	11, 01.433,'E'),	units::length::meter_t(3.0	)},
-{"Gruenstadt Quirnheimer"	, units::gps_position( 49, 35.133, 'N',	 8, 08.367,'E'),	units::length::meter_t(316.0	)},
-{"Gruibingen Nortel"	, units::gps_position( 48, 37.267, 'N',	 9, 39.317,'E'),	units::length::meter_t(706.0	)},
-{"Guestrow"		, units::gps_position( 53, 48.333, 'N',	12, 13.800,'E'),	units::length::meter_t(14.0	)},
-{"Gundelfingen"		, units::gps_position( 48, 34.167, 'N',	10, 21.517,'E'),	units::length::meter_t(440.0	)},
-{"Gunzburg Donauried"	, units::gps_position( 48, 29.183, 'N',	10, 16.950,'E'),	units::length::meter_t(445.0	)},
-{"Gunzenhausen Reutberg"	, units::gps_position( 49, 06.733, 'N',	10, 46.917,'E'),	units::length::meter_t(485.0	)},
-{"Gustorfer Hoehe"	, units::gps_position( 51, 04.617, 'N',	06, 32.867,'E'),	units::length::meter_t(89.0	)},
-{"Hagen Hof"		, units::gps_position( 51, 18.433, 'N',	07, 25.617,'E'),	units::length::meter_t(394.0	)},
-{"Hahnweide"		, units::gps_position( 48, 37.917, 'N',	 9, 25.750,'E'),	units::length::meter_t(352.0	)},
-{"Haiterbach Nagold"	, units::gps_position( 48, 31.917, 'N',	 8, 40.667,'E'),	units::length::meter_t(596.0	)},
-{"Halle Oppin"		, units::gps_position( 51, 33.133, 'N',	12, 03.233,'E'),	units::length::meter_t(107.0	)},
-{"Hallertau"		, units::gps_position( 48, 38.967, 'N',	11, 35.783,'E'),	units::length::meter_t(386.0	)},
-{"Hamburg Finkenwerder"	, units::gps_position( 53, 32.117, 'N',	 9, 50.133,'E'),	units::length::meter_t(6.0	)},
-{"Hamburg Fuhlsbuettel"	, units::gps_position( 53, 37.833, 'N',	 9, 59.300,'E'),	units::length::meter_t(15.0	)},
-{"Hameln Pyrmont"	, units::gps_position( 51, 57.967, 'N',	 9, 17.450,'E'),	units::length::meter_t(360.0	)},
-{"Hamm Lippewiesen"	, units::gps_position( 51, 41.417, 'N',	07, 49.067,'E'),	units::length::meter_t(58.0	)},
-{"Hangensteinerhof"	, units::gps_position( 48, 55.967, 'N',	 8, 48.917,'E'),	units::length::meter_t(299.0	)},
-{"Hannover"		, units::gps_position( 52, 27.617, 'N',	 9, 41.017,'E'),	units::length::meter_t(55.0	)},
-{"Harle"		, units::gps_position( 53, 42.400, 'N',	07, 49.217,'E'),	units::length::meter_t(3.0	)},
-{"Hartenholm"		, units::gps_position( 53, 54.867, 'N',	10, 02.100,'E'),	units::length::meter_t(37.0	)},
-{"Hassfurt Schweinfurt"	, units::gps_position( 50, 01.083, 'N',	10, 31.767,'E'),	units::length::meter_t(220.0	)},
-{"Hassloch Pfalz"	, units::gps_position( 49, 21.317, 'N',	 8, 17.417,'E'),	units::length::meter_t(108.0	)},
-{"Hayingen"		, units::gps_position( 48, 17.083, 'N',	 9, 27.933,'E'),	units::length::meter_t(703.0	)},
-{"Heide Buesum"		, units::gps_position( 54, 09.200, 'N',	 8, 54.100,'E'),	units::length::meter_t(3.0	)},
-{"Heilbronn Boeckingen"	, units::gps_position( 49, 07.300, 'N',	 9, 10.767,'E'),	units::length::meter_t(159.0	)},
-{"Heiligenberg"		, units::gps_position( 47, 50.000, 'N',	 9, 18.067,'E'),	units::length::meter_t(759.0	)},
-{"Helgoland Duene"	, units::gps_position( 54, 11.117, 'N',	07, 54.950,'E'),	units::length::meter_t(3.0	)},
-{"Hellenhagen"		, units::gps_position( 52, 01.517, 'N',	 9, 33.883,'E'),	units::length::meter_t(181.0	)},
-{"Hellingst"		, units::gps_position( 53, 22.500, 'N',	 8, 51.000,'E'),	units::length::meter_t(20.0	)},
-{"Hengsen Opherdicke"	, units::gps_position( 51, 28.400, 'N',	07, 38.700,'E'),	units::length::meter_t(132.0	)},
-{"Heppenheim"		, units::gps_position( 49, 37.283, 'N',	 8, 37.500,'E'),	units::length::meter_t(98.0	)},
-{"Heringsdorf"		, units::gps_position( 53, 52.717, 'N',	14, 09.133,'E'),	units::length::meter_t(28.0	)},
-{"Hermuthausen"		, units::gps_position( 49, 18.867, 'N',	 9, 44.717,'E'),	units::length::meter_t(410.0	)},
-{"Herrenteich"		, units::gps_position( 49, 20.750, 'N',	 8, 29.300,'E'),	units::length::meter_t(91.0	)},
-{"Hersbruck"		, units::gps_position( 49, 30.450, 'N',	11, 26.617,'E'),	units::length::meter_t(335.0	)},
-{"Herten Rheinflden"	, units::gps_position( 47, 33.600, 'N',	07, 44.900,'E'),	units::length::meter_t(284.0	)},
-{"Herzogenaurach"	, units::gps_position( 49, 34.967, 'N',	10, 52.700,'E'),	units::length::meter_t(324.0	)},
-{"Hessisch Lichtenau"	, units::gps_position( 51, 11.333, 'N',	 9, 44.567,'E'),	units::length::meter_t(411.0	)},
-{"Hettstadt"		, units::gps_position( 49, 47.917, 'N',	 9, 50.217,'E'),	units::length::meter_t(320.0	)},
-{"Hetzleser Berg"	, units::gps_position( 49, 38.533, 'N',	11, 09.750,'E'),	units::length::meter_t(528.0	)},
-{"Heubach"		, units::gps_position( 48, 48.183, 'N',	 9, 55.667,'E'),	units::length::meter_t(433.0	)},
-{"Hienheim"		, units::gps_position( 48, 52.683, 'N',	11, 45.633,'E'),	units::length::meter_t(397.0	)},
-{"Hildesheim"		, units::gps_position( 52, 10.783, 'N',	 9, 56.733,'E'),	units::length::meter_t(88.0	)},
-{"Hilzingen"		, units::gps_position( 47, 45.633, 'N',	 8, 46.050,'E'),	units::length::meter_t(459.0	)},
-{"Hirzenhain"		, units::gps_position( 50, 47.267, 'N',	 8, 23.550,'E'),	units::length::meter_t(528.0	)},
-{"Hockenheim"		, units::gps_position( 49, 19.483, 'N',	 8, 31.667,'E'),	units::length::meter_t(93.0	)},
-{"Hodenhagen"		, units::gps_position( 52, 45.750, 'N',	 9, 36.733,'E'),	units::length::meter_t(22.0	)},
-{"Hoelleberg"		, units::gps_position( 51, 36.650, 'N',	 9, 23.917,'E'),	units::length::meter_t(257.0	)},
-{"Hoepen"		, units::gps_position( 53, 08.833, 'N',	 9, 47.800,'E'),	units::length::meter_t(85.0	)},
-{"Hoerbach"		, units::gps_position( 50, 40.100, 'N',	 8, 15.633,'E'),	units::length::meter_t(330.0	)},
-{"Hoexter Holzminden"	, units::gps_position( 51, 48.383, 'N',	 9, 22.700,'E'),	units::length::meter_t(284.0	)},
-{"Hof-Plauen"		, units::gps_position( 50, 17.317, 'N',	11, 51.200,'E'),	units::length::meter_t(598.0	)},
-{"Hohenfels Mil"	, units::gps_position( 49, 13.000, 'N',	11, 50.150,'E'),	units::length::meter_t(445.0	)},
-{"Hoherodskopf"		, units::gps_position( 50, 30.100, 'N',	 9, 13.350,'E'),	units::length::meter_t(674.0	)},
-{"Hohn Mil"		, units::gps_position( 54, 18.733, 'N',	 9, 32.300,'E'),	units::length::meter_t(12.0	)},
-{"Holtorfsloh"		, units::gps_position( 53, 19.333, 'N',	10, 04.467,'E'),	units::length::meter_t(55.0	)},
-{"Holzdorf Mil"		, units::gps_position( 51, 46.083, 'N',	13, 10.050,'E'),	units::length::meter_t(82.0	)},
-{"Homberg Ohm"		, units::gps_position( 50, 44.878, 'N',	 9, 01.274,'E'),	units::length::meter_t(349.0	)},
-{"Hoppstaedten Weiersbach"	, units::gps_position( 49, 36.650, 'N',	07, 11.200,'E'),	units::length::meter_t(332.0	)},
-{"Hornberg"		, units::gps_position( 48, 44.683, 'N',	 9, 51.750,'E'),	units::length::meter_t(682.0	)},
-{"Hoya"		, units::gps_position( 52, 48.717, 'N',	 9, 09.833,'E'),	units::length::meter_t(15.0	)},
-{"Huelben"		, units::gps_position( 48, 31.750, 'N',	 9, 23.867,'E'),	units::length::meter_t(718.0	)},
-{"Huensborn"		, units::gps_position( 50, 55.717, 'N',	07, 53.950,'E'),	units::length::meter_t(421.0	)},
-{"Huetten Hotzenwald"	, units::gps_position( 47, 37.983, 'N',	07, 56.483,'E'),	units::length::meter_t(873.0	)},
-{"Huettenbusch"		, units::gps_position( 53, 17.200, 'N',	 8, 56.900,'E'),	units::length::meter_t(3.0	)},
-{"Huhnrain As"		, units::gps_position( 50, 29.400, 'N',	 9, 50.833,'E'),	units::length::meter_t(434.0	)},
-{"Husum Schwesing"	, units::gps_position( 54, 30.600, 'N',	 9, 08.300,'E'),	units::length::meter_t(18.0	)},
-{"Idar Oberstein"	, units::gps_position( 49, 43.933, 'N',	07, 20.167,'E'),	units::length::meter_t(475.0	)},
-{"Illertissen"		, units::gps_position( 48, 14.117, 'N',	10, 08.267,'E'),	units::length::meter_t(512.0	)},
-{"Illeshe Mil Heli"	, units::gps_position( 49, 28.433, 'N',	10, 23.283,'E'),	units::length::meter_t(329.0	)},
-{"Ingelfingen Buehlhof"	, units::gps_position( 49, 19.300, 'N',	 9, 39.817,'E'),	units::length::meter_t(421.0	)},
-{"Ingolstadt Etting"	, units::gps_position( 48, 48.617, 'N',	11, 25.257,'E'),	units::length::meter_t(380.0	)},
-{"Ingolstadt Manching Mil"	, units::gps_position( 48, 43.250, 'N',	11, 31.814,'E'),	units::length::meter_t(366.0	)},
-{"Irsingen"		, units::gps_position( 49, 02.300, 'N',	10, 30.183,'E'),	units::length::meter_t(466.0	)},
-{"Iserlohn Rheinermark"	, units::gps_position( 51, 25.817, 'N',	07, 38.650,'E'),	units::length::meter_t(191.0	)},
-{"Iserlohn Suemmer"	, units::gps_position( 51, 26.250, 'N',	07, 42.100,'E'),	units::length::meter_t(157.0	)},
-{"Isny Rotmoos"		, units::gps_position( 47, 42.017, 'N',	10, 01.233,'E'),	units::length::meter_t(689.0	)},
-{"Ithwiesen"		, units::gps_position( 51, 57.067, 'N',	 9, 39.767,'E'),	units::length::meter_t(375.0	)},
-{"Itzehoe"		, units::gps_position( 53, 59.667, 'N',	 9, 34.717,'E'),	units::length::meter_t(24.0	)},
-{"Jena Schongleina"	, units::gps_position( 50, 54.933, 'N',	11, 42.850,'E'),	units::length::meter_t(375.0	)},
-{"Jesenwang"		, units::gps_position( 48, 10.467, 'N',	11, 07.517,'E'),	units::length::meter_t(565.0	)},
-{"Jever Mil"		, units::gps_position( 53, 32.017, 'N',	07, 53.317,'E'),	units::length::meter_t(6.0	)},
-{"Johannisau"		, units::gps_position( 50, 32.217, 'N',	 9, 39.750,'E'),	units::length::meter_t(265.0	)},
-{"Juist"		, units::gps_position( 53, 40.883, 'N',	07, 03.400,'E'),	units::length::meter_t(3.0	)},
-{"Kamen Heeren"		, units::gps_position( 51, 35.417, 'N',	07, 42.600,'E'),	units::length::meter_t(63.0	)},
-{"Kamenz"		, units::gps_position( 51, 17.817, 'N',	14, 07.650,'E'),	units::length::meter_t(153.0	)},
-{"Kammermark"		, units::gps_position( 53, 11.717, 'N',	12, 09.850,'E'),	units::length::meter_t(84.0	)},
-{"Kamp-Lintfort"	, units::gps_position( 51, 31.767, 'N',	06, 32.217,'E'),	units::length::meter_t(21.0	)},
-{"Karlshoefen"		, units::gps_position( 53, 19.967, 'N',	 9, 01.717,'E'),	units::length::meter_t(6.0	)},
-{"Karlsruhe Baden"	, units::gps_position( 48, 46.750, 'N',	 8, 04.833,'E'),	units::length::meter_t(125.0	)},
-{"Karlstadt Saupurzel"	, units::gps_position( 49, 58.283, 'N',	 9, 47.483,'E'),	units::length::meter_t(248.0	)},
-{"Kassel Calden"	, units::gps_position( 51, 25.250, 'N',	 9, 23.533,'E'),	units::length::meter_t(250.0	)},
-{"Kaufbeuren"		, units::gps_position( 47, 51.683, 'N',	10, 36.850,'E'),	units::length::meter_t(726.0	)},
-{"Kehl Sundheim"	, units::gps_position( 48, 33.683, 'N',	07, 50.633,'E'),	units::length::meter_t(137.0	)},
-{"Kell"		, units::gps_position( 49, 37.300, 'N',	06, 50.417,'E'),	units::length::meter_t(559.0	)},
-{"Kempten Durach"	, units::gps_position( 47, 41.467, 'N',	10, 20.283,'E'),	units::length::meter_t(710.0	)},
-{"Kiel Holtenau"	, units::gps_position( 54, 22.767, 'N',	10, 08.717,'E'),	units::length::meter_t(31.0	)},
-{"Kirchdorf Inn"	, units::gps_position( 48, 14.300, 'N',	12, 58.617,'E'),	units::length::meter_t(340.0	)},
-{"Kirchzarten"		, units::gps_position( 47, 57.050, 'N',	07, 57.350,'E'),	units::length::meter_t(415.0	)},
-{"Kirn"		, units::gps_position( 49, 46.433, 'N',	07, 31.300,'E'),	units::length::meter_t(429.0	)},
-{"Kisslegg Wangen"	, units::gps_position( 47, 45.218, 'N',	 9, 51.945,'E'),	units::length::meter_t(640.0	)},
-{"Kitzingen"		, units::gps_position( 49, 44.517, 'N',	10, 12.117,'E'),	units::length::meter_t(202.0	)},
-{"Klein Muehlingen"	, units::gps_position( 51, 56.850, 'N',	11, 46.183,'E'),	units::length::meter_t(53.0	)},
-{"Kleve Wisseler Duenen"	, units::gps_position( 51, 46.167, 'N',	06, 17.950,'E'),	units::length::meter_t(18.0	)},
-{"Klietz Scharlibbe"	, units::gps_position( 52, 42.600, 'N',	12, 04.383,'E'),	units::length::meter_t(26.0	)},
-{"Klippeneck"		, units::gps_position( 48, 06.467, 'N',	 8, 45.750,'E'),	units::length::meter_t(962.0	)},
-{"Klix"		, units::gps_position( 51, 16.433, 'N',	14, 30.417,'E'),	units::length::meter_t(145.0	)},
-{"Koblenz Winningen"	, units::gps_position( 50, 19.517, 'N',	07, 31.683,'E'),	units::length::meter_t(195.0	)},
-{"Koenigsdorf"		, units::gps_position( 47, 49.717, 'N',	11, 27.967,'E'),	units::length::meter_t(600.0	)},
-{"Koethen"		, units::gps_position( 51, 43.417, 'N',	11, 56.883,'E'),	units::length::meter_t(93.0	)},
-{"Koln-Bonn"		, units::gps_position( 50, 51.950, 'N',	07, 08.567,'E'),	units::length::meter_t(92.0	)},
-{"Konstanz"		, units::gps_position( 47, 40.900, 'N',	 9, 08.283,'E'),	units::length::meter_t(396.0	)},
-{"Konz Koenen"		, units::gps_position( 49, 40.533, 'N',	06, 32.567,'E'),	units::length::meter_t(217.0	)},
-{"Korbach"		, units::gps_position( 51, 15.150, 'N',	 8, 52.400,'E'),	units::length::meter_t(390.0	)},
-{"Krefeld Egelsberg"	, units::gps_position( 51, 23.083, 'N',	06, 35.267,'E'),	units::length::meter_t(43.0	)},
-{"Kronach"		, units::gps_position( 50, 14.617, 'N',	11, 21.533,'E'),	units::length::meter_t(466.0	)},
-{"Kuehrstedt Bederkesa"	, units::gps_position( 53, 34.083, 'N',	 8, 47.367,'E'),	units::length::meter_t(9.0	)},
-{"Kulmbach"		, units::gps_position( 50, 08.100, 'N',	11, 27.550,'E'),	units::length::meter_t(506.0	)},
-{"Kusel Langenbach"	, units::gps_position( 49, 28.683, 'N',	07, 18.533,'E'),	units::length::meter_t(457.0	)},
-{"Kyritz"		, units::gps_position( 52, 55.133, 'N',	12, 25.517,'E'),	units::length::meter_t(40.0	)},
-{"Laage Mil"		, units::gps_position( 53, 55.083, 'N',	12, 16.700,'E'),	units::length::meter_t(43.0	)},
-{"Lachen Speyerdorf"	, units::gps_position( 49, 19.800, 'N',	 8, 12.767,'E'),	units::length::meter_t(118.0	)},
-{"Lager Hammelburg"	, units::gps_position( 50, 05.917, 'N',	 9, 53.033,'E'),	units::length::meter_t(342.0	)},
-{"Lahr"		, units::gps_position( 48, 22.150, 'N',	07, 49.667,'E'),	units::length::meter_t(156.0	)},
-{"Laichingen"		, units::gps_position( 48, 29.817, 'N',	 9, 38.417,'E'),	units::length::meter_t(746.0	)},
-{"Landau Ebenberg"	, units::gps_position( 49, 10.583, 'N',	 8, 08.167,'E'),	units::length::meter_t(162.0	)},
-{"Landsberg Mil"	, units::gps_position( 48, 04.233, 'N',	10, 54.367,'E'),	units::length::meter_t(622.0	)},
-{"Landshut"		, units::gps_position( 48, 30.700, 'N',	12, 02.000,'E'),	units::length::meter_t(399.0	)},
-{"Langenberg Hatte"	, units::gps_position( 50, 47.850, 'N',	 9, 33.800,'E'),	units::length::meter_t(350.0	)},
-{"Langenberg"		, units::gps_position( 50, 47.617, 'N',	 9, 33.683,'E'),	units::length::meter_t(360.0	)},
-{"Langenfeld Wiescheid"	, units::gps_position( 51, 08.450, 'N',	06, 59.117,'E'),	units::length::meter_t(86.0	)},
-{"Langenfeld Wiescheid"	, units::gps_position( 51, 08.460, 'N',	06, 59.110,'E'),	units::length::meter_t(80.0	)},
-{"Langenlonsheim"	, units::gps_position( 49, 54.500, 'N',	07, 54.467,'E'),	units::length::meter_t(92.0	)},
-{"Langenselbold"	, units::gps_position( 50, 10.617, 'N',	 9, 04.000,'E'),	units::length::meter_t(118.0	)},
-{"Langeoog"		, units::gps_position( 53, 44.567, 'N',	07, 29.917,'E'),	units::length::meter_t(3.0	)},
-{"Langhennersdorf"	, units::gps_position( 50, 56.917, 'N',	13, 15.717,'E'),	units::length::meter_t(390.0	)},
-{"Laucha"		, units::gps_position( 51, 14.767, 'N',	11, 41.617,'E'),	units::length::meter_t(226.0	)},
-{"Lauenbrueck"		, units::gps_position( 53, 12.467, 'N',	 9, 34.400,'E'),	units::length::meter_t(29.0	)},
-{"Lauf Lillinghof"	, units::gps_position( 49, 36.317, 'N',	11, 17.017,'E'),	units::length::meter_t(544.0	)},
-{"Laufenselden"		, units::gps_position( 50, 13.300, 'N',	07, 59.917,'E'),	units::length::meter_t(400.0	)},
-{"Laupheim Mil"		, units::gps_position( 48, 13.200, 'N',	 9, 54.617,'E'),	units::length::meter_t(540.0	)},
-{"Lauterbach"		, units::gps_position( 50, 41.017, 'N',	 9, 24.683,'E'),	units::length::meter_t(364.0	)},
-{"Lechfeld Mil"		, units::gps_position( 48, 11.133, 'N',	10, 51.667,'E'),	units::length::meter_t(555.0	)},
-{"Leck"		, units::gps_position( 54, 47.400, 'N',	 8, 57.683,'E'),	units::length::meter_t(6.0	)},
-{"Leer Papenburg"	, units::gps_position( 53, 16.317, 'N',	07, 26.517,'E'),	units::length::meter_t(1.0	)},
-{"Leibertingen"		, units::gps_position( 48, 02.673, 'N',	 9, 01.873,'E'),	units::length::meter_t(830.0	)},
-{"Leibertingen"		, units::gps_position( 48, 02.683, 'N',	 9, 01.833,'E'),	units::length::meter_t(833.0	)},
-{"Leipzig Halle"	, units::gps_position( 51, 26.033, 'N',	12, 14.386,'E'),	units::length::meter_t(143.0	)},
-{"Leipzig-Altenburg"	, units::gps_position( 50, 58.917, 'N',	12, 30.383,'E'),	units::length::meter_t(195.0	)},
-{"Leutkirch Unterzeil"	, units::gps_position( 47, 51.533, 'N',	10, 00.867,'E'),	units::length::meter_t(640.0	)},
-{"Leuzendorf"		, units::gps_position( 49, 21.100, 'N',	10, 04.467,'E'),	units::length::meter_t(463.0	)},
-{"Leverkusen"		, units::gps_position( 51, 00.917, 'N',	07, 00.367,'E'),	units::length::meter_t(49.0	)},
-{"Lichtenfels"		, units::gps_position( 50, 08.867, 'N',	11, 02.817,'E'),	units::length::meter_t(259.0	)},
-{"Lindlar"		, units::gps_position( 50, 59.817, 'N',	07, 22.600,'E'),	units::length::meter_t(327.0	)},
-{"Linkenheim"		, units::gps_position( 49, 08.500, 'N',	 8, 23.667,'E'),	units::length::meter_t(97.0	)},
-{"Loechgau"		, units::gps_position( 49, 00.067, 'N',	 9, 04.917,'E'),	units::length::meter_t(272.0	)},
-{"Ludwigshafen Dannstadt"	, units::gps_position( 49, 24.717, 'N',	 8, 20.983,'E'),	units::length::meter_t(96.0	)},
-{"Luebeck"		, units::gps_position( 53, 48.317, 'N',	10, 43.150,'E'),	units::length::meter_t(15.0	)},
-{"Luechow Rehbeck"	, units::gps_position( 53, 01.033, 'N',	11, 08.683,'E'),	units::length::meter_t(10.0	)},
-{"Lueneburg"		, units::gps_position( 53, 14.900, 'N',	10, 27.483,'E'),	units::length::meter_t(49.0	)},
-{"Luenen Lippeweiden"	, units::gps_position( 51, 37.017, 'N',	07, 30.083,'E'),	units::length::meter_t(50.0	)},
-{"Luesse"		, units::gps_position( 52, 08.600, 'N',	12, 40.217,'E'),	units::length::meter_t(64.0	)},
-{"Magdeburg Cochstedt"	, units::gps_position( 51, 51.367, 'N',	11, 25.083,'E'),	units::length::meter_t(183.0	)},
-{"Magdeburg-City"	, units::gps_position( 52, 04.417, 'N',	11, 37.617,'E'),	units::length::meter_t(82.0	)},
-{"Mainbullau"		, units::gps_position( 49, 41.700, 'N',	 9, 10.950,'E'),	units::length::meter_t(455.0	)},
-{"Mainz Finthen"	, units::gps_position( 49, 58.150, 'N',	 8, 08.867,'E'),	units::length::meter_t(232.0	)},
-{"Malmsheim"		, units::gps_position( 48, 47.083, 'N',	 8, 55.050,'E'),	units::length::meter_t(451.0	)},
-{"Malsch"		, units::gps_position( 49, 14.250, 'N',	 8, 40.700,'E'),	units::length::meter_t(133.0	)},
-{"Mannheim City"	, units::gps_position( 49, 28.367, 'N',	 8, 30.783,'E'),	units::length::meter_t(95.0	)},
-{"Marburg Schoenstadt"	, units::gps_position( 50, 52.450, 'N',	 8, 48.900,'E'),	units::length::meter_t(251.0	)},
-{"Markdorf"		, units::gps_position( 47, 42.567, 'N',	 9, 23.350,'E'),	units::length::meter_t(431.0	)},
-{"Marl Loemuehle"	, units::gps_position( 51, 38.817, 'N',	07, 09.817,'E'),	units::length::meter_t(73.0	)},
-{"Marpingen"		, units::gps_position( 49, 27.167, 'N',	07, 02.367,'E'),	units::length::meter_t(351.0	)},
-{"Meiersberg"		, units::gps_position( 51, 17.983, 'N',	06, 57.383,'E'),	units::length::meter_t(164.0	)},
-{"Meinerzhagen"		, units::gps_position( 51, 06.000, 'N',	07, 35.967,'E'),	units::length::meter_t(472.0	)},
-{"Melle Groenegau"	, units::gps_position( 52, 12.050, 'N',	 8, 22.833,'E'),	units::length::meter_t(73.0	)},
-{"Memmingen"		, units::gps_position( 47, 59.333, 'N',	10, 14.367,'E'),	units::length::meter_t(628.0	)},
-{"Menden Barge"		, units::gps_position( 51, 27.583, 'N',	07, 50.167,'E'),	units::length::meter_t(207.0	)},
-{"Mendig"		, units::gps_position( 50, 21.950, 'N',	07, 18.917,'E'),	units::length::meter_t(174.0	)},
-{"Mengen Hohentengen"	, units::gps_position( 48, 03.233, 'N',	 9, 22.367,'E'),	units::length::meter_t(555.0	)},
-{"Mengeringhausen"	, units::gps_position( 51, 22.583, 'N',	 8, 58.867,'E'),	units::length::meter_t(363.0	)},
-{"Meppen Mil"		, units::gps_position( 52, 43.400, 'N',	07, 19.583,'E'),	units::length::meter_t(21.0	)},
-{"Merseburg"		, units::gps_position( 51, 21.750, 'N',	11, 56.467,'E'),	units::length::meter_t(104.0	)},
-{"Meschede Schueren"	, units::gps_position( 51, 18.167, 'N',	 8, 14.367,'E'),	units::length::meter_t(439.0	)},
-{"Michelbach"		, units::gps_position( 50, 13.900, 'N',	 8, 04.617,'E'),	units::length::meter_t(301.0	)},
-{"Michelstadt"		, units::gps_position( 49, 40.717, 'N',	 8, 58.300,'E'),	units::length::meter_t(349.0	)},
-{"Mindelheim Mattseis"	, units::gps_position( 48, 06.467, 'N',	10, 31.483,'E'),	units::length::meter_t(567.0	)},
-{"Moeckmuehl Korb"	, units::gps_position( 49, 20.650, 'N',	 9, 24.017,'E'),	units::length::meter_t(354.0	)},
-{"Moenchengladbach"	, units::gps_position( 51, 13.817, 'N',	06, 30.267,'E'),	units::length::meter_t(40.0	)},
-{"Moenchsheide"		, units::gps_position( 50, 30.483, 'N',	07, 15.333,'E'),	units::length::meter_t(213.0	)},
-{"Montabaur"		, units::gps_position( 50, 25.433, 'N',	07, 49.800,'E'),	units::length::meter_t(265.0	)},
-{"Moosburg Auf Kippe"	, units::gps_position( 48, 27.400, 'N',	11, 56.500,'E'),	units::length::meter_t(421.0	)},
-{"Mosbach Lohrbach"	, units::gps_position( 49, 23.967, 'N',	 9, 07.417,'E'),	units::length::meter_t(332.0	)},
-{"Mosenberg"		, units::gps_position( 51, 03.767, 'N',	 9, 25.317,'E'),	units::length::meter_t(402.0	)},
-{"Muehldorf"		, units::gps_position( 48, 16.783, 'N',	12, 30.017,'E'),	units::length::meter_t(406.0	)},
-{"Muehlhausen"		, units::gps_position( 51, 12.783, 'N',	10, 32.967,'E'),	units::length::meter_t(247.0	)},
-{"Muelben"		, units::gps_position( 49, 27.300, 'N',	 9, 06.283,'E'),	units::length::meter_t(519.0	)},
-{"Muellheim"		, units::gps_position( 47, 49.450, 'N',	07, 38.383,'E'),	units::length::meter_t(292.0	)},
-{"Muenster Telgte"	, units::gps_position( 51, 56.667, 'N',	07, 46.417,'E'),	units::length::meter_t(55.0	)},
-{"Mueritz Airpark"	, units::gps_position( 53, 18.383, 'N',	12, 45.150,'E'),	units::length::meter_t(63.0	)},
-{"Munchen"		, units::gps_position( 48, 21.233, 'N',	11, 47.167,'E'),	units::length::meter_t(454.0	)},
-{"Munsingen Eisberg"	, units::gps_position( 48, 24.550, 'N',	 9, 26.550,'E'),	units::length::meter_t(725.0	)},
-{"Musbach"		, units::gps_position( 48, 30.167, 'N',	 8, 28.717,'E'),	units::length::meter_t(697.0	)},
-{"Nabern Teck"		, units::gps_position( 48, 36.750, 'N',	 9, 28.633,'E'),	units::length::meter_t(372.0	)},
-{"Nannhausen"		, units::gps_position( 49, 58.217, 'N',	07, 28.733,'E'),	units::length::meter_t(381.0	)},
-{"Nardt"		, units::gps_position( 51, 27.100, 'N',	14, 12.150,'E'),	units::length::meter_t(117.0	)},
-{"Nastaetten"		, units::gps_position( 50, 11.883, 'N',	07, 53.333,'E'),	units::length::meter_t(363.0	)},
-{"Neresheim"		, units::gps_position( 48, 44.500, 'N',	10, 19.667,'E'),	units::length::meter_t(538.0	)},
-{"Neu Guelze"		, units::gps_position( 53, 22.867, 'N',	10, 48.250,'E'),	units::length::meter_t(12.0	)},
-{"Neubrandenburg"	, units::gps_position( 53, 36.133, 'N',	13, 18.367,'E'),	units::length::meter_t(70.0	)},
-{"Neuburg Egweil"	, units::gps_position( 48, 46.917, 'N',	11, 12.917,'E'),	units::length::meter_t(412.0	)},
-{"Neuburg Mil"		, units::gps_position( 48, 42.667, 'N',	11, 12.700,'E'),	units::length::meter_t(381.0	)},
-{"Neuhardenberg"	, units::gps_position( 52, 36.783, 'N',	14, 14.567,'E'),	units::length::meter_t(12.0	)},
-{"Neuhausen Cottbus"	, units::gps_position( 51, 41.083, 'N',	14, 25.383,'E'),	units::length::meter_t(85.0	)},
-{"Neuhausen ob Eck"	, units::gps_position( 47, 58.600, 'N',	 8, 54.250,'E'),	units::length::meter_t(806.0	)},
-{"Neujellingsdorf"	, units::gps_position( 54, 27.350, 'N',	11, 06.567,'E'),	units::length::meter_t(7.0	)},
-{"Neumagen Dhron"	, units::gps_position( 49, 50.567, 'N',	06, 54.967,'E'),	units::length::meter_t(268.0	)},
-{"Neumarkt Oberpfalz"	, units::gps_position( 49, 17.133, 'N',	11, 26.617,'E'),	units::length::meter_t(424.0	)},
-{"Neumuenster"		, units::gps_position( 54, 04.767, 'N',	 9, 56.517,'E'),	units::length::meter_t(21.0	)},
-{"Neunkirchen Bexbach"	, units::gps_position( 49, 20.400, 'N',	07, 15.200,'E'),	units::length::meter_t(272.0	)},
-{"Neuruppin"		, units::gps_position( 52, 56.567, 'N',	12, 46.767,'E'),	units::length::meter_t(43.0	)},
-{"Neustadt Aisch"	, units::gps_position( 49, 35.250, 'N',	10, 34.667,'E'),	units::length::meter_t(363.0	)},
-{"Neustadt Glewe"	, units::gps_position( 53, 21.717, 'N',	11, 36.867,'E'),	units::length::meter_t(37.0	)},
-{"Nidda A D Helmsberg"	, units::gps_position( 50, 24.317, 'N',	 8, 59.267,'E'),	units::length::meter_t(176.0	)},
-{"Niederrhein Weeze"	, units::gps_position( 51, 36.150, 'N',	06, 08.533,'E'),	units::length::meter_t(34.0	)},
-{"Niederstetten"	, units::gps_position( 49, 23.517, 'N',	 9, 57.500,'E'),	units::length::meter_t(469.0	)},
-{"Nienburg Holzbalge"	, units::gps_position( 52, 42.583, 'N',	 9, 09.733,'E'),	units::length::meter_t(24.0	)},
-{"Noerdlingen"		, units::gps_position( 48, 52.217, 'N',	10, 30.283,'E'),	units::length::meter_t(421.0	)},
-{"Noervenich Mil"	, units::gps_position( 50, 49.867, 'N',	06, 39.483,'E'),	units::length::meter_t(119.0	)},
-{"Norden Nordeich"	, units::gps_position( 53, 37.983, 'N',	07, 11.400,'E'),	units::length::meter_t(1.0	)},
-{"Norderney"		, units::gps_position( 53, 42.400, 'N',	07, 13.800,'E'),	units::length::meter_t(3.0	)},
-{"Nordhausen"		, units::gps_position( 51, 29.567, 'N',	10, 50.267,'E'),	units::length::meter_t(210.0	)},
-{"Nordholz Mil"		, units::gps_position( 53, 46.050, 'N',	 8, 39.500,'E'),	units::length::meter_t(21.0	)},
-{"Nordholz Spieka"	, units::gps_position( 53, 46.148, 'N',	 8, 38.534,'E'),	units::length::meter_t(21.0	)},
-{"Nordhorn Lingen"	, units::gps_position( 52, 27.467, 'N',	07, 10.950,'E'),	units::length::meter_t(28.0	)},
-{"Northeim"		, units::gps_position( 51, 42.383, 'N',	10, 02.383,'E'),	units::length::meter_t(122.0	)},
-{"Nuernberg"		, units::gps_position( 49, 29.933, 'N',	11, 04.633,'E'),	units::length::meter_t(314.0	)},
-{"Ober Moerlen"		, units::gps_position( 50, 21.717, 'N',	 8, 42.683,'E'),	units::length::meter_t(247.0	)},
-{"Oberems"		, units::gps_position( 50, 14.500, 'N',	 8, 23.933,'E'),	units::length::meter_t(403.0	)},
-{"Oberhinkofen"		, units::gps_position( 48, 57.100, 'N',	12, 08.800,'E'),	units::length::meter_t(396.0	)},
-{"Obermehler Schlotheim"	, units::gps_position( 51, 16.067, 'N',	10, 38.083,'E'),	units::length::meter_t(277.0	)},
-{"Oberpfaffenhofen"	, units::gps_position( 48, 04.883, 'N',	11, 16.983,'E'),	units::length::meter_t(594.0	)},
-{"Oberrissdorf"		, units::gps_position( 51, 32.600, 'N',	11, 35.683,'E'),	units::length::meter_t(224.0	)},
-{"Oberschleissheim"	, units::gps_position( 48, 14.350, 'N',	11, 33.550,'E'),	units::length::meter_t(485.0	)},
-{"Ochsenfurt"		, units::gps_position( 49, 40.417, 'N',	10, 04.267,'E'),	units::length::meter_t(248.0	)},
-{"Ochsenhausen"		, units::gps_position( 48, 03.200, 'N',	 9, 54.950,'E'),	units::length::meter_t(650.0	)},
-{"Oehna"		, units::gps_position( 51, 53.983, 'N',	13, 03.183,'E'),	units::length::meter_t(85.0	)},
-{"Oerlinghausen"	, units::gps_position( 51, 55.950, 'N',	 8, 39.717,'E'),	units::length::meter_t(171.0	)},
-{"Oeventrop Ruhrwiesen"	, units::gps_position( 51, 23.767, 'N',	 8, 08.667,'E'),	units::length::meter_t(241.0	)},
-{"Offenburg"		, units::gps_position( 48, 26.883, 'N',	07, 55.417,'E'),	units::length::meter_t(153.0	)},
-{"Ohlstadt Poemetsried"	, units::gps_position( 47, 39.467, 'N',	11, 14.033,'E'),	units::length::meter_t(655.0	)},
-{"Oldenburg Hatten"	, units::gps_position( 53, 04.117, 'N',	 8, 18.750,'E'),	units::length::meter_t(9.0	)},
-{"Oppenheim"		, units::gps_position( 49, 50.467, 'N',	 8, 22.550,'E'),	units::length::meter_t(86.0	)},
-{"Oppershausen"		, units::gps_position( 52, 35.733, 'N',	10, 13.383,'E'),	units::length::meter_t(43.0	)},
-{"Oppingen Au"		, units::gps_position( 48, 33.400, 'N',	 9, 49.333,'E'),	units::length::meter_t(681.0	)},
-{"Oschatz"		, units::gps_position( 51, 17.817, 'N',	13, 04.783,'E'),	units::length::meter_t(156.0	)},
-{"Oschersleben"		, units::gps_position( 52, 02.283, 'N',	11, 12.333,'E'),	units::length::meter_t(104.0	)},
-{"Osnabruck Atterheide"	, units::gps_position( 52, 17.200, 'N',	07, 58.183,'E'),	units::length::meter_t(83.0	)},
-{"Osterholz Scharmbeck"	, units::gps_position( 53, 12.817, 'N',	 8, 48.617,'E'),	units::length::meter_t(2.0	)},
-{"Ottenberg pILSACH"	, units::gps_position( 49, 19.717, 'N',	11, 28.783,'E'),	units::length::meter_t(552.0	)},
-{"Ottengruener Heide"	, units::gps_position( 50, 13.550, 'N',	11, 43.883,'E'),	units::length::meter_t(575.0	)},
-{"Paderborn Haxterberg"	, units::gps_position( 51, 41.317, 'N',	 8, 46.550,'E'),	units::length::meter_t(241.0	)},
-{"Paderborn Lippstadt"	, units::gps_position( 51, 36.833, 'N',	 8, 36.950,'E'),	units::length::meter_t(213.0	)},
-{"Parchim Kl Platz"	, units::gps_position( 53, 25.117, 'N',	11, 48.100,'E'),	units::length::meter_t(44.0	)},
-{"Pasewalk"		, units::gps_position( 53, 30.317, 'N',	13, 56.900,'E'),	units::length::meter_t(23.0	)},
-{"Paterzell"		, units::gps_position( 47, 50.750, 'N',	11, 03.667,'E'),	units::length::meter_t(595.0	)},
-{"Pattonville"		, units::gps_position( 48, 51.850, 'N',	 9, 13.483,'E'),	units::length::meter_t(278.0	)},
-{"Peenemuende"		, units::gps_position( 54, 09.533, 'N',	13, 46.383,'E'),	units::length::meter_t(3.0	)},
-{"Pegnitz Zipser Berg"	, units::gps_position( 49, 45.733, 'N',	11, 34.467,'E'),	units::length::meter_t(543.0	)},
-{"Peine Glindbruchkippe"	, units::gps_position( 52, 19.417, 'N',	10, 10.900,'E'),	units::length::meter_t(68.0	)},
-{"Pellworm"		, units::gps_position( 54, 32.200, 'N',	 8, 40.800,'E'),	units::length::meter_t(1.0	)},
-{"Pennewitz"		, units::gps_position( 50, 40.167, 'N',	11, 03.050,'E'),	units::length::meter_t(457.0	)},
-{"Perleberg"		, units::gps_position( 53, 04.233, 'N',	11, 49.083,'E'),	units::length::meter_t(31.0	)},
-{"Pfarrkirchen"		, units::gps_position( 48, 25.217, 'N',	12, 51.883,'E'),	units::length::meter_t(387.0	)},
-{"Pfullendorf"		, units::gps_position( 47, 54.567, 'N',	 9, 15.050,'E'),	units::length::meter_t(699.0	)},
-{"Pinnow"		, units::gps_position( 53, 36.950, 'N',	11, 33.767,'E'),	units::length::meter_t(43.0	)},
-{"Pirmasens"		, units::gps_position( 49, 15.867, 'N',	07, 29.300,'E'),	units::length::meter_t(381.0	)},
-{"Pirna Pratzschwitz"	, units::gps_position( 50, 58.783, 'N',	13, 54.517,'E'),	units::length::meter_t(122.0	)},
-{"Plaetzer Huenfeld"	, units::gps_position( 50, 42.567, 'N',	 9, 44.350,'E'),	units::length::meter_t(350.0	)},
-{"Pleidelsheim"		, units::gps_position( 48, 57.400, 'N',	 9, 11.517,'E'),	units::length::meter_t(190.0	)},
-{"Plettenberg"		, units::gps_position( 51, 11.533, 'N',	07, 47.383,'E'),	units::length::meter_t(307.0	)},
-{"Pohlheim Viehweide"	, units::gps_position( 50, 31.933, 'N',	 8, 44.033,'E'),	units::length::meter_t(237.0	)},
-{"Poltringen"		, units::gps_position( 48, 32.817, 'N',	 8, 56.750,'E'),	units::length::meter_t(404.0	)},
-{"Porta Westfalica"	, units::gps_position( 52, 13.267, 'N',	 8, 51.583,'E'),	units::length::meter_t(44.0	)},
-{"Pritzwalk Sommersberg"	, units::gps_position( 53, 10.800, 'N',	12, 11.067,'E'),	units::length::meter_t(88.0	)},
-{"Purkshof"		, units::gps_position( 54, 09.717, 'N',	12, 14.867,'E'),	units::length::meter_t(21.0	)},
-{"Quakenbrueck"		, units::gps_position( 52, 39.783, 'N',	07, 55.583,'E'),	units::length::meter_t(24.0	)},
-{"Radevormwald Ley"	, units::gps_position( 51, 12.983, 'N',	07, 22.933,'E'),	units::length::meter_t(390.0	)},
-{"Radolfzell-Stahr"	, units::gps_position( 47, 48.167, 'N',	 8, 58.767,'E'),	units::length::meter_t(421.0	)},
-{"Ramstein Mil"		, units::gps_position( 49, 26.217, 'N',	07, 36.017,'E'),	units::length::meter_t(238.0	)},
-{"Rastatt Baldenau"	, units::gps_position( 48, 52.467, 'N',	 8, 12.783,'E'),	units::length::meter_t(113.0	)},
-{"Regensburg Oberhub"	, units::gps_position( 49, 08.517, 'N',	12, 04.917,'E'),	units::length::meter_t(396.0	)},
-{"Reichelsheim"		, units::gps_position( 50, 20.317, 'N',	 8, 52.717,'E'),	units::length::meter_t(121.0	)},
-{"Reinheim"		, units::gps_position( 49, 50.367, 'N',	 8, 51.033,'E'),	units::length::meter_t(155.0	)},
-{"Reinsdorf"		, units::gps_position( 51, 54.050, 'N',	13, 11.767,'E'),	units::length::meter_t(102.0	)},
-{"Reiselfingen"		, units::gps_position( 47, 51.100, 'N',	 8, 22.283,'E'),	units::length::meter_t(746.0	)},
-{"Rendsburg Schachtholm"	, units::gps_position( 54, 13.267, 'N',	 9, 36.050,'E'),	units::length::meter_t(6.0	)},
-{"Renneritz"		, units::gps_position( 51, 35.683, 'N',	12, 14.250,'E'),	units::length::meter_t(91.0	)},
-{"Rerik Zweedorf"	, units::gps_position( 54, 04.917, 'N',	11, 38.933,'E'),	units::length::meter_t(9.0	)},
-{"Rheine Bentl Mil"	, units::gps_position( 52, 17.467, 'N',	07, 23.233,'E'),	units::length::meter_t(40.0	)},
-{"Rheine Eschendorf"	, units::gps_position( 52, 16.600, 'N',	07, 29.533,'E'),	units::length::meter_t(41.0	)},
-{"Rheinstetten"		, units::gps_position( 48, 58.667, 'N',	 8, 20.550,'E'),	units::length::meter_t(116.0	)},
-{"Riedelbach"		, units::gps_position( 50, 18.133, 'N',	 8, 23.083,'E'),	units::length::meter_t(508.0	)},
-{"Riedlingen"		, units::gps_position( 48, 08.667, 'N',	 9, 28.000,'E'),	units::length::meter_t(529.0	)},
-{"Riesa Canitz"		, units::gps_position( 51, 18.183, 'N',	13, 13.667,'E'),	units::length::meter_t(123.0	)},
-{"Riesa Goehlis"	, units::gps_position( 51, 17.583, 'N',	13, 21.433,'E'),	units::length::meter_t(98.0	)},
-{"Rinteln"		, units::gps_position( 52, 10.517, 'N',	 9, 03.200,'E'),	units::length::meter_t(55.0	)},
-{"Roitzschjora"		, units::gps_position( 51, 34.617, 'N',	12, 29.650,'E'),	units::length::meter_t(88.0	)},
-{"Rosenthal Field Ploessen"	, units::gps_position( 49, 51.800, 'N',	11, 47.283,'E'),	units::length::meter_t(457.0	)},
-{"Rossfeld"		, units::gps_position( 48, 30.817, 'N',	 9, 20.067,'E'),	units::length::meter_t(803.0	)},
-{"Rote Wiese Helmstedt"	, units::gps_position( 52, 14.025, 'N',	10, 58.876,'E'),	units::length::meter_t(111.0	)},
-{"Rotenburg Wuemme"	, units::gps_position( 53, 07.700, 'N',	 9, 20.917,'E'),	units::length::meter_t(27.0	)},
-{"Roth Mil"		, units::gps_position( 49, 13.050, 'N',	11, 06.000,'E'),	units::length::meter_t(387.0	)},
-{"Rothenberg"		, units::gps_position( 49, 29.150, 'N',	 8, 56.167,'E'),	units::length::meter_t(479.0	)},
-{"Rothenburg Goerlitz"	, units::gps_position( 51, 21.833, 'N',	14, 57.067,'E'),	units::length::meter_t(159.0	)},
-{"Rothenburg o d Tauber"	, units::gps_position( 49, 23.300, 'N',	10, 13.100,'E'),	units::length::meter_t(399.0	)},
-{"Rottweil Zepfenhan"	, units::gps_position( 48, 11.200, 'N',	 8, 43.383,'E'),	units::length::meter_t(738.0	)},
-{"Rudolstadt Groschwitz"	, units::gps_position( 50, 43.967, 'N',	11, 14.167,'E'),	units::length::meter_t(470.0	)},
-{"Ruegen"		, units::gps_position( 54, 23.000, 'N',	13, 19.533,'E'),	units::length::meter_t(21.0	)},
-{"Ruppiner Land Fehrbellin"	, units::gps_position( 52, 47.600, 'N',	12, 45.650,'E'),	units::length::meter_t(43.0	)},
-{"Saal Kreuzberg"	, units::gps_position( 50, 18.533, 'N',	10, 22.400,'E'),	units::length::meter_t(266.0	)},
-{"Saarbruecken"		, units::gps_position( 49, 12.883, 'N',	07, 06.567,'E'),	units::length::meter_t(323.0	)},
-{"Saarlouis Dueren"	, units::gps_position( 49, 18.750, 'N',	06, 40.450,'E'),	units::length::meter_t(341.0	)},
-{"Saarmund"		, units::gps_position( 52, 18.500, 'N',	13, 06.033,'E'),	units::length::meter_t(52.0	)},
-{"Salzgitter Drutte"	, units::gps_position( 52, 09.267, 'N',	10, 25.583,'E'),	units::length::meter_t(98.0	)},
-{"Salzgitter Schaeferstuhlf"	, units::gps_position( 52, 01.833, 'N',	10, 21.783,'E'),	units::length::meter_t(203.0	)},
-{"Salzwedel"		, units::gps_position( 52, 49.683, 'N',	11, 18.983,'E'),	units::length::meter_t(33.0	)},
-{"Saulgau"		, units::gps_position( 48, 01.767, 'N',	 9, 30.433,'E'),	units::length::meter_t(582.0	)},
-{"Schaefhalde Steinheim"	, units::gps_position( 48, 41.550, 'N',	10, 06.017,'E'),	units::length::meter_t(628.0	)},
-{"Schameder"		, units::gps_position( 51, 00.017, 'N',	 8, 18.550,'E'),	units::length::meter_t(550.0	)},
-{"Scheuen Celle"	, units::gps_position( 52, 40.167, 'N',	10, 05.333,'E'),	units::length::meter_t(55.0	)},
-{"Schlechtenfeld"	, units::gps_position( 48, 17.083, 'N',	 9, 40.400,'E'),	units::length::meter_t(562.0	)},
-{"Schleswig Kropp"	, units::gps_position( 54, 25.533, 'N',	 9, 32.517,'E'),	units::length::meter_t(15.0	)},
-{"Schleswig Mil"	, units::gps_position( 54, 27.567, 'N',	 9, 30.983,'E'),	units::length::meter_t(21.0	)},
-{"Schlierstadt Seligenberg"	, units::gps_position( 49, 26.567, 'N',	 9, 21.750,'E'),	units::length::meter_t(344.0	)},
-{"Schmallenberg Rennfeld"	, units::gps_position( 51, 09.700, 'N',	 8, 15.700,'E'),	units::length::meter_t(467.0	)},
-{"Schmidgaden"		, units::gps_position( 49, 25.767, 'N',	12, 05.883,'E'),	units::length::meter_t(380.0	)},
-{"Schmoldow"		, units::gps_position( 53, 58.367, 'N',	13, 20.583,'E'),	units::length::meter_t(24.0	)},
-{"Schoenberg"		, units::gps_position( 48, 02.867, 'N',	12, 30.033,'E'),	units::length::meter_t(543.0	)},
-{"Schoenhagen"		, units::gps_position( 52, 12.217, 'N',	13, 09.500,'E'),	units::length::meter_t(40.0	)},
-{"Schonebeck Zackmuende"	, units::gps_position( 51, 59.783, 'N',	11, 47.383,'E'),	units::length::meter_t(52.0	)},
-{"Schotten"		, units::gps_position( 50, 32.083, 'N',	 9, 08.733,'E'),	units::length::meter_t(500.0	)},
-{"Schreckhof Mosbach"	, units::gps_position( 49, 21.050, 'N',	 9, 07.267,'E'),	units::length::meter_t(270.0	)},
-{"Schwabach Buechenbach"	, units::gps_position( 49, 16.117, 'N',	11, 00.600,'E'),	units::length::meter_t(359.0	)},
-{"Schwabmuenchen"	, units::gps_position( 48, 10.750, 'N',	10, 42.183,'E'),	units::length::meter_t(550.0	)},
-{"Schwaebisch Hall"	, units::gps_position( 49, 07.100, 'N',	 9, 47.033,'E'),	units::length::meter_t(399.0	)},
-{"Schwaebisch-H Weckrieden"	, units::gps_position( 49, 07.450, 'N',	 9, 46.867,'E'),	units::length::meter_t(399.0	)},
-{"Schwandorf"		, units::gps_position( 49, 20.433, 'N',	12, 11.083,'E'),	units::length::meter_t(387.0	)},
-{"Schwann Conweil"	, units::gps_position( 48, 50.300, 'N',	 8, 32.583,'E'),	units::length::meter_t(480.0	)},
-{"Schwarzheide"		, units::gps_position( 51, 29.383, 'N',	13, 52.733,'E'),	units::length::meter_t(101.0	)},
-{"Schweighofen"		, units::gps_position( 49, 01.900, 'N',	07, 59.400,'E'),	units::length::meter_t(149.0	)},
-{"Schweinfurt-Sued"	, units::gps_position( 50, 00.633, 'N',	10, 15.083,'E'),	units::length::meter_t(210.0	)},
-{"Schwenningen Neckar"	, units::gps_position( 48, 03.933, 'N',	 8, 34.267,'E'),	units::length::meter_t(667.0	)},
-{"Schwerin Parchim"	, units::gps_position( 53, 25.617, 'N',	11, 47.000,'E'),	units::length::meter_t(52.0	)},
-{"Seedorf"		, units::gps_position( 53, 20.117, 'N',	 9, 15.583,'E'),	units::length::meter_t(17.0	)},
-{"Segeletz"		, units::gps_position( 52, 49.600, 'N',	12, 32.550,'E'),	units::length::meter_t(39.0	)},
-{"Seissen"		, units::gps_position( 48, 24.783, 'N',	 9, 45.983,'E'),	units::length::meter_t(692.0	)},
-{"Siegen Eisernhardt"	, units::gps_position( 50, 50.250, 'N',	 8, 00.850,'E'),	units::length::meter_t(390.0	)},
-{"Siegerland"		, units::gps_position( 50, 42.467, 'N',	 8, 04.983,'E'),	units::length::meter_t(601.0	)},
-{"Sierksdorf Hof Altona"	, units::gps_position( 54, 04.033, 'N',	10, 44.567,'E'),	units::length::meter_t(28.0	)},
-{"Siewisch Ul"		, units::gps_position( 51, 41.250, 'N',	14, 12.517,'E'),	units::length::meter_t(89.0	)},
-{"Singhofen"		, units::gps_position( 50, 16.217, 'N',	07, 51.217,'E'),	units::length::meter_t(302.0	)},
-{"Sinsheim"		, units::gps_position( 49, 14.833, 'N',	 8, 53.633,'E'),	units::length::meter_t(159.0	)},
-{"Soemmerda Dermsdorf"	, units::gps_position( 51, 11.917, 'N',	11, 11.467,'E'),	units::length::meter_t(137.0	)},
-{"Soest Bad Sassendorf"	, units::gps_position( 51, 34.683, 'N',	 8, 12.850,'E'),	units::length::meter_t(120.0	)},
-{"Sonnen"		, units::gps_position( 48, 40.950, 'N',	13, 41.683,'E'),	units::length::meter_t(824.0	)},
-{"Sontra Dornberg"	, units::gps_position( 51, 05.250, 'N',	 9, 54.933,'E'),	units::length::meter_t(403.0	)},
-{"Spangdahlem Mil"	, units::gps_position( 49, 58.567, 'N',	06, 41.867,'E'),	units::length::meter_t(362.0	)},
-{"Speyer"		, units::gps_position( 49, 18.283, 'N',	 8, 27.100,'E'),	units::length::meter_t(95.0	)},
-{"Spremberg Welzow"	, units::gps_position( 51, 34.617, 'N',	14, 08.217,'E'),	units::length::meter_t(116.0	)},
-{"Sprossen"		, units::gps_position( 51, 02.600, 'N',	12, 13.983,'E'),	units::length::meter_t(206.0	)},
-{"St Michaelisdon"	, units::gps_position( 53, 58.700, 'N',	 9, 08.733,'E'),	units::length::meter_t(37.0	)},
-{"St Peter Ording"	, units::gps_position( 54, 18.533, 'N',	 8, 41.200,'E'),	units::length::meter_t(3.0	)},
-{"Stade"		, units::gps_position( 53, 33.667, 'N',	 9, 29.917,'E'),	units::length::meter_t(19.0	)},
-{"Stadtlohn Vreden"	, units::gps_position( 51, 59.750, 'N',	06, 50.433,'E'),	units::length::meter_t(49.0	)},
-{"Stauffenbuehl"	, units::gps_position( 51, 09.550, 'N',	10, 02.833,'E'),	units::length::meter_t(277.0	)},
-{"Stechow Ferchesa"	, units::gps_position( 52, 39.050, 'N',	12, 29.283,'E'),	units::length::meter_t(42.0	)},
-{"Steinberg Surwold"	, units::gps_position( 52, 57.383, 'N',	07, 33.417,'E'),	units::length::meter_t(29.0	)},
-{"Steinberg Wesseln"	, units::gps_position( 52, 05.017, 'N',	10, 01.100,'E'),	units::length::meter_t(180.0	)},
-{"Stendal Borstel"	, units::gps_position( 52, 37.733, 'N',	11, 49.200,'E'),	units::length::meter_t(55.0	)},
-{"Stillberghof"		, units::gps_position( 48, 43.850, 'N',	10, 50.117,'E'),	units::length::meter_t(510.0	)},
-{"Stoelln Rhinow"	, units::gps_position( 52, 44.450, 'N',	12, 23.467,'E'),	units::length::meter_t(40.0	)},
-{"Stolberg Diepenlinchen"	, units::gps_position( 50, 46.233, 'N',	06, 16.917,'E'),	units::length::meter_t(259.0	)},
-{"Stralsund"		, units::gps_position( 54, 20.150, 'N',	13, 02.617,'E'),	units::length::meter_t(15.0	)},
-{"Straubing"		, units::gps_position( 48, 54.050, 'N',	12, 31.033,'E'),	units::length::meter_t(320.0	)},
-{"Strausberg"		, units::gps_position( 52, 34.800, 'N',	13, 54.933,'E'),	units::length::meter_t(78.0	)},
-{"Stuede Bernsteinsee"	, units::gps_position( 52, 33.817, 'N',	10, 41.050,'E'),	units::length::meter_t(73.0	)},
-{"Stuttgart"		, units::gps_position( 48, 41.400, 'N',	 9, 13.317,'E'),	units::length::meter_t(390.0	)},
-{"Suhl Goldlauter"	, units::gps_position( 50, 37.933, 'N',	10, 43.550,'E'),	units::length::meter_t(588.0	)},
-{"Sultmer Berg"		, units::gps_position( 51, 43.767, 'N',	 9, 59.533,'E'),	units::length::meter_t(222.0	)},
-{"Sylt"		, units::gps_position( 54, 54.700, 'N',	 8, 20.550,'E'),	units::length::meter_t(15.0	)},
-{"Tannheim"		, units::gps_position( 48, 00.600, 'N',	10, 05.950,'E'),	units::length::meter_t(561.0	)},
-{"Tarmstedt"		, units::gps_position( 53, 15.083, 'N',	 9, 06.517,'E'),	units::length::meter_t(41.0	)},
-{"Tauberbischofsheim"	, units::gps_position( 49, 38.867, 'N',	 9, 37.967,'E'),	units::length::meter_t(285.0	)},
-{"Taucha"		, units::gps_position( 51, 23.717, 'N',	12, 32.283,'E'),	units::length::meter_t(149.0	)},
-{"Teisendorf Pank"	, units::gps_position( 47, 49.583, 'N',	12, 50.700,'E'),	units::length::meter_t(578.0	)},
-{"Thalmaessing Waizenhofen"	, units::gps_position( 49, 03.850, 'N',	11, 12.567,'E'),	units::length::meter_t(577.0	)},
-{"Thannhausen"		, units::gps_position( 48, 17.400, 'N',	10, 26.517,'E'),	units::length::meter_t(491.0	)},
-{"Tirschenreuth"	, units::gps_position( 49, 52.417, 'N',	12, 19.450,'E'),	units::length::meter_t(499.0	)},
-{"Titschendorf"		, units::gps_position( 50, 23.833, 'N',	11, 31.367,'E'),	units::length::meter_t(650.0	)},
-{"Torgau Beilrode"	, units::gps_position( 51, 34.267, 'N',	13, 03.133,'E'),	units::length::meter_t(82.0	)},
-{"Traben Trarbach"	, units::gps_position( 49, 58.067, 'N',	07, 06.700,'E'),	units::length::meter_t(275.0	)},
-{"Treuchtlingen Bubenheim"	, units::gps_position( 48, 59.750, 'N',	10, 53.100,'E'),	units::length::meter_t(412.0	)},
-{"Trier Foehren"	, units::gps_position( 49, 51.850, 'N',	06, 47.267,'E'),	units::length::meter_t(204.0	)},
-{"Troestau"		, units::gps_position( 50, 01.200, 'N',	11, 55.867,'E'),	units::length::meter_t(561.0	)},
-{"Tutow"		, units::gps_position( 53, 55.317, 'N',	13, 13.133,'E'),	units::length::meter_t(6.0	)},
-{"Uebersberg"		, units::gps_position( 48, 27.483, 'N',	 9, 17.800,'E'),	units::length::meter_t(784.0	)},
-{"Uelzen"		, units::gps_position( 52, 59.017, 'N',	10, 27.933,'E'),	units::length::meter_t(75.0	)},
-{"Uetersen Heist"	, units::gps_position( 53, 38.800, 'N',	 9, 42.233,'E'),	units::length::meter_t(5.0	)},
-{"Ummern"		, units::gps_position( 52, 37.200, 'N',	10, 24.617,'E'),	units::length::meter_t(71.0	)},
-{"Unterschuepf"		, units::gps_position( 49, 30.950, 'N',	 9, 40.150,'E'),	units::length::meter_t(346.0	)},
-{"Unterwoessen"		, units::gps_position( 47, 43.783, 'N',	12, 26.283,'E'),	units::length::meter_t(565.0	)},
-{"Urspring"		, units::gps_position( 48, 33.233, 'N',	 9, 54.167,'E'),	units::length::meter_t(642.0	)},
-{"Uslar"		, units::gps_position( 51, 39.733, 'N',	 9, 36.317,'E'),	units::length::meter_t(260.0	)},
-{"Utscheid"		, units::gps_position( 49, 59.867, 'N',	06, 20.583,'E'),	units::length::meter_t(421.0	)},
-{"Vaihingen"		, units::gps_position( 48, 56.183, 'N',	 8, 58.817,'E'),	units::length::meter_t(312.0	)},
-{"Varrelbusch"		, units::gps_position( 52, 54.500, 'N',	 8, 02.600,'E'),	units::length::meter_t(37.0	)},
-{"Verden Scharnhorst"	, units::gps_position( 52, 57.917, 'N',	 9, 16.967,'E'),	units::length::meter_t(42.0	)},
-{"Vielbrunn"		, units::gps_position( 49, 43.183, 'N',	 9, 04.933,'E'),	units::length::meter_t(459.0	)},
-{"Vilsbiburg"		, units::gps_position( 48, 25.583, 'N',	12, 20.733,'E'),	units::length::meter_t(442.0	)},
-{"Vilseck Mil"		, units::gps_position( 49, 38.017, 'N',	11, 46.033,'E'),	units::length::meter_t(412.0	)},
-{"Vilshofen"		, units::gps_position( 48, 38.083, 'N',	13, 11.800,'E'),	units::length::meter_t(302.0	)},
-{"Vinsebeck Frankenberg"	, units::gps_position( 51, 50.683, 'N',	 9, 00.817,'E'),	units::length::meter_t(247.0	)},
-{"Vogtareuth"		, units::gps_position( 47, 56.767, 'N',	12, 12.283,'E'),	units::length::meter_t(471.0	)},
-{"Volkleshofen Lichtenberg"	, units::gps_position( 49, 00.567, 'N',	 9, 21.267,'E'),	units::length::meter_t(396.0	)},
-{"Wachtersberg Hub"	, units::gps_position( 48, 36.900, 'N',	 8, 45.333,'E'),	units::length::meter_t(591.0	)},
-{"Wahlstedt"		, units::gps_position( 53, 58.167, 'N',	10, 13.300,'E'),	units::length::meter_t(40.0	)},
-{"Waldeck Muehlberg"	, units::gps_position( 51, 13.550, 'N',	 9, 03.317,'E'),	units::length::meter_t(405.0	)},
-{"Walldorf"		, units::gps_position( 49, 18.283, 'N',	 8, 39.550,'E'),	units::length::meter_t(103.0	)},
-{"Wallduern"		, units::gps_position( 49, 34.900, 'N',	 9, 24.133,'E'),	units::length::meter_t(402.0	)},
-{"Walsrode Luisenhoehe"	, units::gps_position( 52, 53.300, 'N',	 9, 36.050,'E'),	units::length::meter_t(57.0	)},
-{"Wangerooge"		, units::gps_position( 53, 46.867, 'N',	07, 55.233,'E'),	units::length::meter_t(3.0	)},
-{"Wanlo Niersquell"	, units::gps_position( 51, 06.052, 'N',	06, 23.637,'E'),	units::length::meter_t(74.0	)},
-{"Warburg Heinberg"	, units::gps_position( 51, 29.833, 'N',	 9, 05.250,'E'),	units::length::meter_t(172.0	)},
-{"Waren Vielist"	, units::gps_position( 53, 34.067, 'N',	12, 39.117,'E'),	units::length::meter_t(85.0	)},
-{"Warngau Tannried"	, units::gps_position( 47, 49.467, 'N',	11, 42.250,'E'),	units::length::meter_t(723.0	)},
-{"Wasserkuppe"		, units::gps_position( 50, 29.933, 'N',	 9, 57.217,'E'),	units::length::meter_t(898.0	)},
-{"Weiden Opf"		, units::gps_position( 49, 40.733, 'N',	12, 07.000,'E'),	units::length::meter_t(405.0	)},
-{"Weimar Umpferstedt"	, units::gps_position( 50, 57.900, 'N',	11, 24.000,'E'),	units::length::meter_t(299.0	)},
-{"Weinheim Bergstrasse"	, units::gps_position( 49, 34.017, 'N',	 8, 36.650,'E'),	units::length::meter_t(96.0	)},
-{"Weipertshofen"	, units::gps_position( 49, 05.183, 'N',	10, 07.483,'E'),	units::length::meter_t(440.0	)},
-{"Weissenburg Wuelzburg"	, units::gps_position( 49, 01.550, 'N',	11, 01.117,'E'),	units::length::meter_t(615.0	)},
-{"Weissenhorn"		, units::gps_position( 48, 17.367, 'N',	10, 08.417,'E'),	units::length::meter_t(500.0	)},
-{"Welzheim"		, units::gps_position( 48, 52.583, 'N',	 9, 39.217,'E'),	units::length::meter_t(518.0	)},
-{"Wenzendorf"		, units::gps_position( 53, 20.183, 'N',	 9, 46.700,'E'),	units::length::meter_t(66.0	)},
-{"Weper"		, units::gps_position( 51, 42.750, 'N',	 9, 48.167,'E'),	units::length::meter_t(360.0	)},
-{"Werdohl Kuentrop"	, units::gps_position( 51, 17.817, 'N',	07, 49.050,'E'),	units::length::meter_t(307.0	)},
-{"Werneuchen"		, units::gps_position( 52, 37.917, 'N',	13, 46.467,'E'),	units::length::meter_t(79.0	)},
-{"Wershofen Eifel"	, units::gps_position( 50, 27.100, 'N',	06, 47.067,'E'),	units::length::meter_t(476.0	)},
-{"Wesel Romerwardt"	, units::gps_position( 51, 39.767, 'N',	06, 35.750,'E'),	units::length::meter_t(21.0	)},
-{"Weser Wuemme"		, units::gps_position( 53, 03.233, 'N',	 9, 12.517,'E'),	units::length::meter_t(18.0	)},
-{"Westerstede Felde"	, units::gps_position( 53, 17.317, 'N',	07, 55.850,'E'),	units::length::meter_t(8.0	)},
-{"Wiefelstede Conneforde"	, units::gps_position( 53, 19.283, 'N',	 8, 04.400,'E'),	units::length::meter_t(7.0	)},
-{"Wiesbaden Mil"	, units::gps_position( 50, 02.983, 'N',	 8, 19.517,'E'),	units::length::meter_t(140.0	)},
-{"Wildberg Bodensee"	, units::gps_position( 47, 36.017, 'N',	 9, 44.517,'E'),	units::length::meter_t(520.0	)},
-{"Wilhelmshaven"	, units::gps_position( 53, 30.133, 'N',	 8, 03.133,'E'),	units::length::meter_t(6.0	)},
-{"Wilsche"		, units::gps_position( 52, 31.483, 'N',	10, 27.683,'E'),	units::length::meter_t(60.0	)},
-{"Winzeln Schramberg"	, units::gps_position( 48, 16.750, 'N',	 8, 25.700,'E'),	units::length::meter_t(670.0	)},
-{"Wipperfuerth Neye"	, units::gps_position( 51, 07.483, 'N',	07, 22.333,'E'),	units::length::meter_t(265.0	)},
-{"Wismar"		, units::gps_position( 53, 54.883, 'N',	11, 30.083,'E'),	units::length::meter_t(12.0	)},
-{"Wittmundhafe Mil"	, units::gps_position( 53, 32.867, 'N',	07, 40.050,'E'),	units::length::meter_t(9.0	)},
-{"Wittstock Berlinchen"	, units::gps_position( 53, 13.550, 'N',	12, 34.067,'E'),	units::length::meter_t(79.0	)},
-{"Woerishofen"		, units::gps_position( 48, 01.617, 'N',	10, 36.133,'E'),	units::length::meter_t(616.0	)},
-{"Wolfhagen Graner Berg"	, units::gps_position( 51, 18.433, 'N',	 9, 10.517,'E'),	units::length::meter_t(314.0	)},
-{"Worms"		, units::gps_position( 49, 36.383, 'N',	 8, 22.100,'E'),	units::length::meter_t(91.0	)},
-{"Wunstorf Mil"		, units::gps_position( 52, 27.433, 'N',	 9, 25.633,'E'),	units::length::meter_t(58.0	)},
-{"Wurzburg"		, units::gps_position( 49, 49.067, 'N',	 9, 53.850,'E'),	units::length::meter_t(297.0	)},
-{"Wyk Auf Foehr"	, units::gps_position( 54, 41.117, 'N',	 8, 31.917,'E'),	units::length::meter_t(9.0	)},
-{"Zell Haidberg"	, units::gps_position( 50, 08.217, 'N',	11, 47.667,'E'),	units::length::meter_t(583.0	)},
-{"Zellhausen"		, units::gps_position( 50, 01.233, 'N',	 8, 59.017,'E'),	units::length::meter_t(113.0	)},
-{"Zerbst"		, units::gps_position( 52, 00.133, 'N',	12, 09.167,'E'),	units::length::meter_t(80.0	)},
-{"Zierenberg Doernberg"	, units::gps_position( 51, 21.750, 'N',	 9, 20.383,'E'),	units::length::meter_t(423.0	)},
-{"Zweibruecken"		, units::gps_position( 49, 12.567, 'N',	07, 24.033,'E'),	units::length::meter_t(345.0	)},
-{"Zwickau"		, units::gps_position( 50, 42.067, 'N',	12, 27.167,'E'),	units::length::meter_t(316.0	)}
-};
+// Built in list, used when no airfield database is loaded. Constructed on
+// first use, so a loaded database saves building it.
+inline const std::vector<airport_t>& builtin_airports() {
+	static const std::vector<airport_t> list {
+		{"Aachen Merzbruck"	, units::gps_position( 50, 49.383, 'N',	06, 11.183,'E'),	units::length::meter_t(189.0	)},
+		{"Aalen Heidenheim"	, units::gps_position( 48, 46.667, 'N',	10, 15.883,'E'),	units::length::meter_t(585.0	)},
+		{"Achmer"		, units::gps_position( 52, 22.633, 'N',	07, 54.800,'E'),	units::length::meter_t(53.0	)},
+		{"Agathazell"		, units::gps_position( 47, 33.300, 'N',	10, 16.367,'E'),	units::length::meter_t(727.0	)},
+		{"Ahlhorn"		, units::gps_position( 52, 53.333, 'N',	 8, 13.950,'E'),	units::length::meter_t(47.0	)},
+		{"Ahrenlohe"		, units::gps_position( 53, 42.000, 'N',	 9, 44.483,'E'),	units::length::meter_t(7.0	)},
+		{"Aichach"		, units::gps_position( 48, 28.400, 'N',	11, 08.133,'E'),	units::length::meter_t(439.0	)},
+		{"Ailertchen"		, units::gps_position( 50, 35.550, 'N',	07, 56.667,'E'),	units::length::meter_t(469.0	)},
+		{"Albstadt Degerfeld"	, units::gps_position( 48, 14.983, 'N',	 9, 03.833,'E'),	units::length::meter_t(891.0	)},
+		{"Allendorf"		, units::gps_position( 51, 02.100, 'N',	 8, 40.850,'E'),	units::length::meter_t(354.0	)},
+		{"Allstedt"		, units::gps_position( 51, 22.833, 'N',	11, 26.800,'E'),	units::length::meter_t(284.0	)},
+		{"Alsfeld"		, units::gps_position( 50, 45.033, 'N',	 9, 14.917,'E'),	units::length::meter_t(292.0	)},
+		{"Altdorf Hagenhausen"	, units::gps_position( 49, 23.217, 'N',	11, 25.267,'E'),	units::length::meter_t(538.0	)},
+		{"Altdorf Wallburg"	, units::gps_position( 48, 16.200, 'N',	07, 50.533,'E'),	units::length::meter_t(194.0	)},
+		{"Alte Ems Herbrum"	, units::gps_position( 53, 01.847, 'N',	07, 18.210,'E'),	units::length::meter_t(1.0	)},
+		{"Altena Hegenscheid"	, units::gps_position( 51, 18.783, 'N',	07, 42.217,'E'),	units::length::meter_t(473.0	)},
+		{"Altenbachtal"		, units::gps_position( 49, 55.367, 'N',	 9, 09.483,'E'),	units::length::meter_t(130.0	)},
+		{"Altenstadt Mil"	, units::gps_position( 47, 50.133, 'N',	10, 52.267,'E'),	units::length::meter_t(737.0	)},
+		{"Altfeld"		, units::gps_position( 49, 49.917, 'N',	 9, 32.233,'E'),	units::length::meter_t(354.0	)},
+		{"Altoetting"		, units::gps_position( 48, 12.967, 'N',	12, 38.900,'E'),	units::length::meter_t(398.0	)},
+		{"Am Kreuzberg"		, units::gps_position( 50, 18.406, 'N',	10, 22.780,'E'),	units::length::meter_t(262.0	)},
+		{"Am Salzgittersee"	, units::gps_position( 52, 10.217, 'N',	10, 18.950,'E'),	units::length::meter_t(81.0	)},
+		{"Am Stauffenberg"	, units::gps_position( 51, 21.717, 'N',	 9, 37.767,'E'),	units::length::meter_t(369.0	)},
+		{"Amberg"		, units::gps_position( 49, 26.350, 'N',	11, 48.383,'E'),	units::length::meter_t(388.0	)},
+		{"Amoeneburg"		, units::gps_position( 50, 47.433, 'N',	 8, 54.483,'E'),	units::length::meter_t(230.0	)},
+		{"Ampfing Waldkraiburg"	, units::gps_position( 48, 15.800, 'N',	12, 24.733,'E'),	units::length::meter_t(415.0	)},
+		{"An Den 7 Bergen"	, units::gps_position( 52, 03.450, 'N',	 9, 48.633,'E'),	units::length::meter_t(135.0	)},
+		{"Anklam"		, units::gps_position( 53, 49.967, 'N',	13, 40.133,'E'),	units::length::meter_t(6.0	)},
+		{"Ansbach Petersdorf"	, units::gps_position( 49, 21.650, 'N',	10, 40.100,'E'),	units::length::meter_t(418.0	)},
+		{"Anspach Taunus"	, units::gps_position( 50, 17.333, 'N',	 8, 32.117,'E'),	units::length::meter_t(335.0	)},
+		{"Antersberg"		, units::gps_position( 47, 57.767, 'N',	11, 59.767,'E'),	units::length::meter_t(498.0	)},
+		{"Arnbruck"		, units::gps_position( 49, 07.533, 'N',	12, 59.117,'E'),	units::length::meter_t(524.0	)},
+		{"Arnsberg-Menden"	, units::gps_position( 51, 29.017, 'N',	07, 53.883,'E'),	units::length::meter_t(241.0	)},
+		{"Arnstadt Alkersleben"	, units::gps_position( 50, 50.517, 'N',	11, 04.200,'E'),	units::length::meter_t(351.0	)},
+		{"Aschaffenburg"	, units::gps_position( 49, 56.333, 'N',	 9, 03.750,'E'),	units::length::meter_t(125.0	)},
+		{"Aschersleben"		, units::gps_position( 51, 46.017, 'N',	11, 29.933,'E'),	units::length::meter_t(162.0	)},
+		{"Asslarer Huette"	, units::gps_position( 50, 35.983, 'N',	 8, 26.633,'E'),	units::length::meter_t(232.0	)},
+		{"Attendorn Finnentrop"	, units::gps_position( 51, 08.750, 'N',	07, 56.183,'E'),	units::length::meter_t(317.0	)},
+		{"Aue bei Hattorf"	, units::gps_position( 51, 38.000, 'N',	10, 15.283,'E'),	units::length::meter_t(190.0	)},
+		{"Auerbach"		, units::gps_position( 50, 29.833, 'N',	12, 22.683,'E'),	units::length::meter_t(573.0	)},
+		{"Augsburg"		, units::gps_position( 48, 25.517, 'N',	10, 55.900,'E'),	units::length::meter_t(463.0	)},
+		{"Aukrug"		, units::gps_position( 54, 03.883, 'N',	 9, 47.900,'E'),	units::length::meter_t(17.0	)},
+		{"Aventoft"		, units::gps_position( 54, 53.767, 'N',	 8, 49.233,'E'),	units::length::meter_t(2.0	)},
+		{"Babenhausen"		, units::gps_position( 49, 57.167, 'N',	 8, 58.150,'E'),	units::length::meter_t(133.0	)},
+		{"Backnang-Heiningen"	, units::gps_position( 48, 55.190, 'N',	 9, 27.320,'E'),	units::length::meter_t(294.0	)},
+		{"Bad Berka"		, units::gps_position( 50, 54.233, 'N',	11, 15.517,'E'),	units::length::meter_t(305.0	)},
+		{"Bad Brueckenau"	, units::gps_position( 50, 16.317, 'N',	 9, 49.417,'E'),	units::length::meter_t(402.0	)},
+		{"Bad Ditzenbach"	, units::gps_position( 48, 33.767, 'N',	 9, 43.733,'E'),	units::length::meter_t(730.0	)},
+		{"Bad Duerkheim"	, units::gps_position( 49, 28.383, 'N',	 8, 11.783,'E'),	units::length::meter_t(107.0	)},
+		{"Bad Endorf Jolling"	, units::gps_position( 47, 55.617, 'N',	12, 17.233,'E'),	units::length::meter_t(514.0	)},
+		{"Bad Frankenhausen"	, units::gps_position( 51, 22.367, 'N',	11, 08.583,'E'),	units::length::meter_t(241.0	)},
+		{"Bad Gandersheim"	, units::gps_position( 51, 51.150, 'N',	10, 01.567,'E'),	units::length::meter_t(239.0	)},
+		{"Bad Hersfeld"		, units::gps_position( 50, 50.667, 'N',	 9, 42.433,'E'),	units::length::meter_t(239.0	)},
+		{"Bad Kissingen"	, units::gps_position( 50, 12.633, 'N',	10, 04.167,'E'),	units::length::meter_t(198.0	)},
+		{"Bad Koenigshofen"	, units::gps_position( 50, 17.250, 'N',	10, 25.317,'E'),	units::length::meter_t(313.0	)},
+		{"Bad Langensalza"	, units::gps_position( 51, 07.750, 'N',	10, 37.300,'E'),	units::length::meter_t(199.0	)},
+		{"Bad Marienberg"	, units::gps_position( 50, 39.650, 'N',	 8, 01.717,'E'),	units::length::meter_t(544.0	)},
+		{"Bad Neuenahr Ahrweiler"	, units::gps_position( 50, 33.467, 'N',	07, 08.233,'E'),	units::length::meter_t(204.0	)},
+		{"Bad Neustadt/Saale"	, units::gps_position( 50, 18.367, 'N',	10, 13.633,'E'),	units::length::meter_t(303.0	)},
+		{"Bad Sobernheim"	, units::gps_position( 49, 47.483, 'N',	07, 40.000,'E'),	units::length::meter_t(244.0	)},
+		{"Bad Waldsee Reute"	, units::gps_position( 47, 54.900, 'N',	 9, 42.600,'E'),	units::length::meter_t(577.0	)},
+		{"Bad Wildungen"	, units::gps_position( 51, 05.633, 'N',	 9, 08.900,'E'),	units::length::meter_t(332.0	)},
+		{"Bad Windsheim"	, units::gps_position( 49, 30.617, 'N',	10, 21.967,'E'),	units::length::meter_t(370.0	)},
+		{"Bad Woerishofen Gld"	, units::gps_position( 48, 01.615, 'N',	10, 36.136,'E'),	units::length::meter_t(619.0	)},
+		{"Bad Woerishofen-Nord"	, units::gps_position( 48, 00.983, 'N',	10, 36.900,'E'),	units::length::meter_t(619.0	)},
+		{"Bad Zwischenahn"	, units::gps_position( 53, 12.617, 'N',	07, 59.317,'E'),	units::length::meter_t(9.0	)},
+		{"Baden Oos"		, units::gps_position( 48, 47.450, 'N',	 8, 11.050,'E'),	units::length::meter_t(125.0	)},
+		{"Ballenstedt"		, units::gps_position( 51, 44.750, 'N',	11, 13.750,'E'),	units::length::meter_t(153.0	)},
+		{"Baltrum"		, units::gps_position( 53, 43.517, 'N',	07, 22.333,'E'),	units::length::meter_t(3.0	)},
+		{"Bamberg"		, units::gps_position( 49, 55.233, 'N',	10, 54.850,'E'),	units::length::meter_t(250.0	)},
+		{"Barssel"		, units::gps_position( 53, 09.867, 'N',	07, 47.650,'E'),	units::length::meter_t(3.0	)},
+		{"Barth"		, units::gps_position( 54, 20.300, 'N',	12, 42.617,'E'),	units::length::meter_t(6.0	)},
+		{"Bartholomae Amalienhof"	, units::gps_position( 48, 44.800, 'N',	10, 00.300,'E'),	units::length::meter_t(637.0	)},
+		{"Baumerlenbach"	, units::gps_position( 49, 13.833, 'N',	 9, 25.150,'E'),	units::length::meter_t(236.0	)},
+		{"Baumholder Mil"	, units::gps_position( 49, 39.100, 'N',	07, 18.433,'E'),	units::length::meter_t(442.0	)},
+		{"Bautzen"		, units::gps_position( 51, 11.617, 'N',	14, 31.183,'E'),	units::length::meter_t(174.0	)},
+		{"Bayreuth"		, units::gps_position( 49, 59.117, 'N',	11, 38.467,'E'),	units::length::meter_t(482.0	)},
+		{"Beelen"		, units::gps_position( 51, 55.900, 'N',	 8, 04.900,'E'),	units::length::meter_t(59.0	)},
+		{"Beilngries"		, units::gps_position( 49, 01.267, 'N',	11, 29.083,'E'),	units::length::meter_t(365.0	)},
+		{"Benediktbeuren"	, units::gps_position( 47, 42.950, 'N',	11, 23.433,'E'),	units::length::meter_t(609.0	)},
+		{"Bensheimer Stadtwiesen"	, units::gps_position( 49, 41.517, 'N',	 8, 34.967,'E'),	units::length::meter_t(93.0	)},
+		{"Bergheim"		, units::gps_position( 50, 58.617, 'N',	06, 36.500,'E'),	units::length::meter_t(70.0	)},
+		{"Bergneustadt"		, units::gps_position( 51, 03.117, 'N',	07, 42.433,'E'),	units::length::meter_t(481.0	)},
+		{"Berlin Schoenefeld"	, units::gps_position( 52, 22.717, 'N',	13, 31.233,'E'),	units::length::meter_t(49.0	)},
+		{"Berlin Tegel"		, units::gps_position( 52, 33.583, 'N',	13, 17.267,'E'),	units::length::meter_t(37.0	)},
+		{"Berliner Heide"	, units::gps_position( 52, 40.183, 'N',	10, 22.233,'E'),	units::length::meter_t(69.0	)},
+		{"Berneck"		, units::gps_position( 48, 34.383, 'N',	 9, 43.783,'E'),	units::length::meter_t(746.0	)},
+		{"Betzdorf Kirchen"	, units::gps_position( 50, 49.017, 'N',	07, 49.817,'E'),	units::length::meter_t(351.0	)},
+		{"Biberach Riss"	, units::gps_position( 48, 06.700, 'N',	 9, 45.800,'E'),	units::length::meter_t(580.0	)},
+		{"Bielefeld"		, units::gps_position( 51, 57.883, 'N',	 8, 32.683,'E'),	units::length::meter_t(137.0	)},
+		{"Bienenfarm"		, units::gps_position( 52, 39.733, 'N',	12, 44.717,'E'),	units::length::meter_t(27.0	)},
+		{"Binningen"		, units::gps_position( 47, 47.967, 'N',	 8, 43.217,'E'),	units::length::meter_t(489.0	)},
+		{"Bischofsberg"		, units::gps_position( 50, 25.933, 'N',	10, 17.000,'E'),	units::length::meter_t(342.0	)},
+		{"Bisperode West"	, units::gps_position( 52, 04.733, 'N',	 9, 28.567,'E'),	units::length::meter_t(194.0	)},
+		{"Bitburg"		, units::gps_position( 49, 56.717, 'N',	06, 33.900,'E'),	units::length::meter_t(372.0	)},
+		{"Blaubeuren"		, units::gps_position( 48, 25.183, 'N',	 9, 47.850,'E'),	units::length::meter_t(677.0	)},
+		{"Blexen"		, units::gps_position( 53, 32.350, 'N',	 8, 32.367,'E'),	units::length::meter_t(3.0	)},
+		{"Blomberg Borkhausen"	, units::gps_position( 51, 55.033, 'N',	 9, 06.667,'E'),	units::length::meter_t(182.0	)},
+		{"Blumberg"		, units::gps_position( 47, 50.667, 'N',	 8, 33.917,'E'),	units::length::meter_t(701.0	)},
+		{"Boberg"		, units::gps_position( 53, 30.883, 'N',	10, 08.650,'E'),	units::length::meter_t(2.0	)},
+		{"Boehlen"		, units::gps_position( 51, 12.967, 'N',	12, 22.100,'E'),	units::length::meter_t(131.0	)},
+		{"Bohlenberger Feld"	, units::gps_position( 53, 25.100, 'N',	07, 54.250,'E'),	units::length::meter_t(6.0	)},
+		{"Bohlhof"		, units::gps_position( 47, 39.050, 'N',	 8, 23.200,'E'),	units::length::meter_t(558.0	)},
+		{"Bohmte Bad Essen"	, units::gps_position( 52, 21.067, 'N',	 8, 19.683,'E'),	units::length::meter_t(45.0	)},
+		{"Bonn Hangelar"	, units::gps_position( 50, 46.133, 'N',	07, 09.767,'E'),	units::length::meter_t(61.0	)},
+		{"Bopfingen"		, units::gps_position( 48, 50.900, 'N',	10, 20.050,'E'),	units::length::meter_t(619.0	)},
+		{"Borghorst Fuechten"	, units::gps_position( 52, 09.017, 'N',	07, 27.117,'E'),	units::length::meter_t(47.0	)},
+		{"Borken Hoxfeld"	, units::gps_position( 51, 51.183, 'N',	06, 48.917,'E'),	units::length::meter_t(49.0	)},
+		{"Borkenberge"		, units::gps_position( 51, 46.800, 'N',	07, 17.283,'E'),	units::length::meter_t(49.0	)},
+		{"Borkum"		, units::gps_position( 53, 35.650, 'N',	06, 42.967,'E'),	units::length::meter_t(1.0	)},
+		{"Bottenhorn"		, units::gps_position( 50, 47.683, 'N',	 8, 27.650,'E'),	units::length::meter_t(516.0	)},
+		{"Brandenburg Muehlenfeld"	, units::gps_position( 52, 26.217, 'N',	12, 35.583,'E'),	units::length::meter_t(28.0	)},
+		{"Brannenburg"		, units::gps_position( 47, 44.333, 'N',	12, 06.967,'E'),	units::length::meter_t(467.0	)},
+		{"Braunfels"		, units::gps_position( 50, 31.533, 'N',	 8, 23.583,'E'),	units::length::meter_t(240.0	)},
+		{"Braunschweig"		, units::gps_position( 52, 19.150, 'N',	10, 33.267,'E'),	units::length::meter_t(92.0	)},
+		{"Breitscheid"		, units::gps_position( 50, 40.617, 'N',	 8, 10.183,'E'),	units::length::meter_t(562.0	)},
+		{"Bremen"		, units::gps_position( 53, 02.850, 'N',	 8, 47.217,'E'),	units::length::meter_t(3.0	)},
+		{"Bremgarten"		, units::gps_position( 47, 54.200, 'N',	07, 37.050,'E'),	units::length::meter_t(213.0	)},
+		{"Brilon"		, units::gps_position( 51, 24.150, 'N',	 8, 38.517,'E'),	units::length::meter_t(460.0	)},
+		{"Brockzetel"		, units::gps_position( 53, 28.883, 'N',	07, 39.100,'E'),	units::length::meter_t(9.0	)},
+		{"Bronkow"		, units::gps_position( 51, 40.317, 'N',	13, 57.817,'E'),	units::length::meter_t(128.0	)},
+		{"Bruchsal"		, units::gps_position( 49, 08.117, 'N',	 8, 33.817,'E'),	units::length::meter_t(113.0	)},
+		{"Buechel Mil"		, units::gps_position( 50, 10.433, 'N',	07, 03.800,'E'),	units::length::meter_t(479.0	)},
+		{"Buechig Ostheim"	, units::gps_position( 50, 26.900, 'N',	10, 15.150,'E'),	units::length::meter_t(388.0	)},
+		{"Bueckeburg Achum Mil"	, units::gps_position( 52, 16.700, 'N',	 9, 04.933,'E'),	units::length::meter_t(70.0	)},
+		{"Bueckeburg Wein"	, units::gps_position( 52, 15.050, 'N',	 9, 01.067,'E'),	units::length::meter_t(77.0	)},
+		{"Bueren Schwalenberg"	, units::gps_position( 51, 32.567, 'N',	 8, 34.833,'E'),	units::length::meter_t(265.0	)},
+		{"Bundenthal Rumbach"	, units::gps_position( 49, 05.633, 'N',	07, 47.633,'E'),	units::length::meter_t(308.0	)},
+		{"Burg Feuerstein"	, units::gps_position( 49, 47.650, 'N',	11, 08.033,'E'),	units::length::meter_t(501.0	)},
+		{"Burg"		, units::gps_position( 52, 14.500, 'N',	11, 51.367,'E'),	units::length::meter_t(52.0	)},
+		{"Burgberg Witzenhausen"	, units::gps_position( 51, 20.984, 'N',	 9, 49.489,'E'),	units::length::meter_t(198.0	)},
+		{"Burgheim"		, units::gps_position( 48, 41.517, 'N',	11, 02.017,'E'),	units::length::meter_t(406.0	)},
+		{"Butzbach Pfingstweide"	, units::gps_position( 50, 26.150, 'N',	 8, 37.167,'E'),	units::length::meter_t(340.0	)},
+		{"Celle Arloh"		, units::gps_position( 52, 41.267, 'N',	10, 06.733,'E'),	units::length::meter_t(64.0	)},
+		{"Celle Mil"		, units::gps_position( 52, 35.467, 'N',	10, 01.333,'E'),	units::length::meter_t(40.0	)},
+		{"Cham Janahof"		, units::gps_position( 49, 12.700, 'N',	12, 39.400,'E'),	units::length::meter_t(364.0	)},
+		{"Chemnitz Jahnsdorf"	, units::gps_position( 50, 44.850, 'N',	12, 50.233,'E'),	units::length::meter_t(370.0	)},
+		{"Coburg Brandensteinsebene"	, units::gps_position( 50, 15.750, 'N',	10, 59.750,'E'),	units::length::meter_t(449.0	)},
+		{"Coburg Steinruecken"	, units::gps_position( 50, 13.833, 'N',	10, 59.717,'E'),	units::length::meter_t(356.0	)},
+		{"Cottbus Drewitz"	, units::gps_position( 51, 53.367, 'N',	14, 31.917,'E'),	units::length::meter_t(82.0	)},
+		{"Dachau Groebenried"	, units::gps_position( 48, 13.717, 'N',	11, 25.367,'E'),	units::length::meter_t(489.0	)},
+		{"Dahlemer Binz"	, units::gps_position( 50, 24.333, 'N',	06, 31.733,'E'),	units::length::meter_t(579.0	)},
+		{"Damme"		, units::gps_position( 52, 29.250, 'N',	 8, 11.100,'E'),	units::length::meter_t(46.0	)},
+		{"Dauborn"		, units::gps_position( 50, 19.300, 'N',	 8, 11.633,'E'),	units::length::meter_t(164.0	)},
+		{"Daun Senheld"		, units::gps_position( 50, 10.550, 'N',	06, 51.467,'E'),	units::length::meter_t(526.0	)},
+		{"Deckenpfronn Egelsee"	, units::gps_position( 48, 38.300, 'N',	 8, 49.050,'E'),	units::length::meter_t(578.0	)},
+		{"Deggendorf"		, units::gps_position( 48, 49.817, 'N',	12, 52.783,'E'),	units::length::meter_t(314.0	)},
+		{"Degmarn"		, units::gps_position( 49, 15.467, 'N',	 9, 16.467,'E'),	units::length::meter_t(169.0	)},
+		{"Dehausen Diemelstadt"	, units::gps_position( 51, 27.800, 'N',	 9, 02.967,'E'),	units::length::meter_t(305.0	)},
+		{"Der Dingel Huemme"	, units::gps_position( 51, 32.167, 'N',	 9, 22.783,'E'),	units::length::meter_t(220.0	)},
+		{"Der Ring Schwalmstadt"	, units::gps_position( 50, 54.183, 'N',	 9, 14.433,'E'),	units::length::meter_t(212.0	)},
+		{"Dessau"		, units::gps_position( 51, 49.900, 'N',	12, 11.067,'E'),	units::length::meter_t(56.0	)},
+		{"Detmold"		, units::gps_position( 51, 56.450, 'N',	 8, 54.250,'E'),	units::length::meter_t(189.0	)},
+		{"Dettingen Teck"	, units::gps_position( 48, 36.500, 'N',	 9, 28.533,'E'),	units::length::meter_t(386.0	)},
+		{"Diepholz Mil"		, units::gps_position( 52, 35.133, 'N',	 8, 20.467,'E'),	units::length::meter_t(40.0	)},
+		{"Dierdorf Wienau"	, units::gps_position( 50, 33.950, 'N',	07, 39.150,'E'),	units::length::meter_t(291.0	)},
+		{"Dillingen"		, units::gps_position( 49, 23.167, 'N',	06, 44.917,'E'),	units::length::meter_t(239.0	)},
+		{"Dingolfing"		, units::gps_position( 48, 39.400, 'N',	12, 29.933,'E'),	units::length::meter_t(352.0	)},
+		{"Dinkelsbuehl"		, units::gps_position( 49, 03.900, 'N',	10, 24.150,'E'),	units::length::meter_t(488.0	)},
+		{"Dinslaken Schwarze Heide"	, units::gps_position( 51, 36.967, 'N',	06, 51.933,'E'),	units::length::meter_t(65.0	)},
+		{"Dobenreuth"		, units::gps_position( 49, 41.817, 'N',	11, 08.600,'E'),	units::length::meter_t(338.0	)},
+		{"Donaueschingen"	, units::gps_position( 47, 58.417, 'N',	 8, 31.333,'E'),	units::length::meter_t(680.0	)},
+		{"Donauwoerth Genderkirchen"	, units::gps_position( 48, 42.183, 'N',	10, 51.133,'E'),	units::length::meter_t(399.0	)},
+		{"Donzdorf Messelberg"	, units::gps_position( 48, 40.717, 'N',	 9, 50.750,'E'),	units::length::meter_t(690.0	)},
+		{"Dorsten Kanal"	, units::gps_position( 51, 39.733, 'N',	06, 59.100,'E'),	units::length::meter_t(32.0	)},
+		{"Dortmund Wickede"	, units::gps_position( 51, 31.150, 'N',	07, 36.867,'E'),	units::length::meter_t(128.0	)},
+		{"Dresden"		, units::gps_position( 51, 08.067, 'N',	13, 46.083,'E'),	units::length::meter_t(229.0	)},
+		{"Dueren Huertgenwald"	, units::gps_position( 50, 41.633, 'N',	06, 25.100,'E'),	units::length::meter_t(360.0	)},
+		{"Duesseldorf Wolfsaap"	, units::gps_position( 51, 15.883, 'N',	06, 51.217,'E'),	units::length::meter_t(113.0	)},
+		{"Duesseldorf"		, units::gps_position( 51, 17.267, 'N',	06, 46.150,'E'),	units::length::meter_t(37.0	)},
+		{"Ebern Sendelbach"	, units::gps_position( 50, 02.383, 'N',	10, 49.367,'E'),	units::length::meter_t(253.0	)},
+		{"Eberswalde Finow"	, units::gps_position( 52, 49.633, 'N',	13, 41.617,'E'),	units::length::meter_t(37.0	)},
+		{"Egelsbach"		, units::gps_position( 49, 57.650, 'N',	 8, 38.483,'E'),	units::length::meter_t(119.0	)},
+		{"Eggenfelden"		, units::gps_position( 48, 23.767, 'N',	12, 43.283,'E'),	units::length::meter_t(407.0	)},
+		{"Eggersdorf"		, units::gps_position( 52, 28.967, 'N',	14, 05.450,'E'),	units::length::meter_t(67.0	)},
+		{"Eibinger Forstwiesen "	, units::gps_position( 50, 01.082, 'N',	07, 53.608,'E'),	units::length::meter_t(392.0	)},
+		{"Eichstaett"		, units::gps_position( 48, 52.617, 'N',	11, 10.900,'E'),	units::length::meter_t(524.0	)},
+		{"Eisenach Kindel"	, units::gps_position( 50, 59.533, 'N',	10, 28.567,'E'),	units::length::meter_t(335.0	)},
+		{"Eisenhuettenstadt"	, units::gps_position( 52, 11.833, 'N',	14, 35.133,'E'),	units::length::meter_t(46.0	)},
+		{"Ellwangen"		, units::gps_position( 48, 57.683, 'N',	10, 14.083,'E'),	units::length::meter_t(503.0	)},
+		{"Elsenthal Grafenau"	, units::gps_position( 48, 49.350, 'N',	13, 22.050,'E'),	units::length::meter_t(485.0	)},
+		{"Elz"		, units::gps_position( 50, 25.600, 'N',	 8, 00.600,'E'),	units::length::meter_t(213.0	)},
+		{"Emden"		, units::gps_position( 53, 23.467, 'N',	07, 13.533,'E'),	units::length::meter_t(1.0	)},
+		{"Emmerich"		, units::gps_position( 51, 49.333, 'N',	06, 16.467,'E'),	units::length::meter_t(13.0	)},
+		{"Erbach"		, units::gps_position( 48, 20.517, 'N',	 9, 55.000,'E'),	units::length::meter_t(476.0	)},
+		{"Erbendorf Schweisslohe"	, units::gps_position( 49, 50.633, 'N',	12, 04.017,'E'),	units::length::meter_t(494.0	)},
+		{"Erding Mil"		, units::gps_position( 48, 19.333, 'N',	11, 56.917,'E'),	units::length::meter_t(463.0	)},
+		{"Erfurt"		, units::gps_position( 50, 58.783, 'N',	10, 57.483,'E'),	units::length::meter_t(317.0	)},
+		{"Essen Muelheim"	, units::gps_position( 51, 24.133, 'N',	06, 56.233,'E'),	units::length::meter_t(128.0	)},
+		{"Esslingen Jaegerhaus"	, units::gps_position( 48, 45.733, 'N',	 9, 20.033,'E'),	units::length::meter_t(496.0	)},
+		{"Essweiler"		, units::gps_position( 49, 33.733, 'N',	07, 34.800,'E'),	units::length::meter_t(409.0	)},
+		{"Eudenbach"		, units::gps_position( 50, 40.333, 'N',	07, 21.917,'E'),	units::length::meter_t(300.0	)},
+		{"Eutingen Gaeu"	, units::gps_position( 48, 29.133, 'N',	 8, 46.700,'E'),	units::length::meter_t(497.0	)},
+		{"Falkenberg Loennewitz"	, units::gps_position( 51, 32.867, 'N',	13, 13.683,'E'),	units::length::meter_t(85.0	)},
+		{"Farrenberg"		, units::gps_position( 48, 23.133, 'N',	 9, 04.600,'E'),	units::length::meter_t(794.0	)},
+		{"Fassberg Mil"		, units::gps_position( 52, 55.150, 'N',	10, 11.033,'E'),	units::length::meter_t(70.0	)},
+		{"Fichtelbrunn"		, units::gps_position( 49, 29.883, 'N',	11, 39.567,'E'),	units::length::meter_t(498.0	)},
+		{"Finsterw Heinrichsruh"	, units::gps_position( 51, 38.067, 'N',	13, 40.317,'E'),	units::length::meter_t(127.0	)},
+		{"Finsterwalde Schacksdorf"	, units::gps_position( 51, 36.450, 'N',	13, 44.283,'E'),	units::length::meter_t(122.0	)},
+		{"Fischbek"		, units::gps_position( 53, 27.350, 'N',	 9, 49.783,'E'),	units::length::meter_t(64.0	)},
+		{"Flensburg"		, units::gps_position( 54, 46.400, 'N',	 9, 22.733,'E'),	units::length::meter_t(40.0	)},
+		{"Frankfurt Engelsbach"	, units::gps_position( 49, 57.633, 'N',	 8, 38.483,'E'),	units::length::meter_t(115.0	)},
+		{"Frankfurt Hahn"	, units::gps_position( 49, 56.917, 'N',	07, 15.833,'E'),	units::length::meter_t(503.0	)},
+		{"Frankfurt Main"	, units::gps_position( 50, 02.000, 'N',	 8, 34.233,'E'),	units::length::meter_t(110.0	)},
+		{"Freiburg i.Br."	, units::gps_position( 48, 01.367, 'N',	07, 49.967,'E'),	units::length::meter_t(242.0	)},
+		{"Friedersdorf"		, units::gps_position( 52, 16.917, 'N',	13, 48.133,'E'),	units::length::meter_t(33.0	)},
+		{"Friedrichshafen"	, units::gps_position( 47, 40.283, 'N',	 9, 30.683,'E'),	units::length::meter_t(418.0	)},
+		{"Friesener Warte"	, units::gps_position( 49, 50.183, 'N',	11, 02.800,'E'),	units::length::meter_t(517.0	)},
+		{"Fritzlar Mil"		, units::gps_position( 51, 06.883, 'N',	 9, 17.150,'E'),	units::length::meter_t(174.0	)},
+		{"Fuerstenzell"		, units::gps_position( 48, 31.083, 'N',	13, 20.767,'E'),	units::length::meter_t(412.0	)},
+		{"Fuerth Seckendorf"	, units::gps_position( 49, 28.883, 'N',	10, 51.517,'E'),	units::length::meter_t(334.0	)},
+		{"Fuessen"		, units::gps_position( 47, 35.000, 'N',	10, 41.450,'E'),	units::length::meter_t(787.0	)},
+		{"Fulda Jossa"		, units::gps_position( 50, 28.517, 'N',	 9, 26.533,'E'),	units::length::meter_t(471.0	)},
+		{"Gammelsdorf"		, units::gps_position( 48, 34.067, 'N',	11, 55.950,'E'),	units::length::meter_t(495.0	)},
+		{"Ganderkesee Atlas"	, units::gps_position( 53, 02.167, 'N',	 8, 30.317,'E'),	units::length::meter_t(31.0	)},
+		{"Garbenheimer Wiesen"	, units::gps_position( 50, 34.500, 'N',	 8, 31.917,'E'),	units::length::meter_t(151.0	)},
+		{"Gardelegen"		, units::gps_position( 52, 31.833, 'N',	11, 21.217,'E'),	units::length::meter_t(73.0	)},
+		{"Gedern"		, units::gps_position( 50, 25.950, 'N',	 9, 11.667,'E'),	units::length::meter_t(371.0	)},
+		{"Geilenkirchen Mil"	, units::gps_position( 50, 57.650, 'N',	06, 02.550,'E'),	units::length::meter_t(92.0	)},
+		{"Geitau"		, units::gps_position( 47, 40.767, 'N',	11, 57.733,'E'),	units::length::meter_t(818.0	)},
+		{"Gelnhausen"		, units::gps_position( 50, 11.783, 'N',	 9, 10.067,'E'),	units::length::meter_t(126.0	)},
+		{"Gera Leumnitz"	, units::gps_position( 50, 52.883, 'N',	12, 08.133,'E'),	units::length::meter_t(307.0	)},
+		{"Geratshof"		, units::gps_position( 47, 59.583, 'N',	10, 50.617,'E'),	units::length::meter_t(634.0	)},
+		{"Gerstetten"		, units::gps_position( 48, 37.233, 'N',	10, 03.667,'E'),	units::length::meter_t(599.0	)},
+		{"Giebelstadt"		, units::gps_position( 49, 38.900, 'N',	 9, 57.983,'E'),	units::length::meter_t(299.0	)},
+		{"Giengen Brenz"	, units::gps_position( 48, 38.033, 'N',	10, 13.000,'E'),	units::length::meter_t(518.0	)},
+		{"Giessen Lutzellinden"	, units::gps_position( 50, 32.667, 'N',	 8, 35.450,'E'),	units::length::meter_t(232.0	)},
+		{"Giessen Reiskirchen"	, units::gps_position( 50, 34.000, 'N',	 8, 52.183,'E'),	units::length::meter_t(213.0	)},
+		{"Giessen Wieseck"	, units::gps_position( 50, 36.250, 'N',	 8, 43.717,'E'),	units::length::meter_t(165.0	)},
+		{"Goch Asperden"	, units::gps_position( 51, 41.450, 'N',	06, 06.233,'E'),	units::length::meter_t(16.0	)},
+		{"Goeppingen Betzg"	, units::gps_position( 48, 39.517, 'N',	 9, 37.450,'E'),	units::length::meter_t(374.0	)},
+		{"Goerlitz"		, units::gps_position( 51, 09.533, 'N',	14, 57.017,'E'),	units::length::meter_t(238.0	)},
+		{"Goettingen Heiligenstadt"	, units::gps_position( 51, 24.450, 'N',	10, 08.683,'E'),	units::length::meter_t(363.0	)},
+		{"Goslar Bollrich"	, units::gps_position( 51, 54.283, 'N',	10, 27.550,'E'),	units::length::meter_t(295.0	)},
+		{"Gotha Ost"		, units::gps_position( 50, 58.217, 'N',	10, 43.750,'E'),	units::length::meter_t(305.0	)},
+		{"Grabenstaett"		, units::gps_position( 47, 51.167, 'N',	12, 33.067,'E'),	units::length::meter_t(537.0	)},
+		{"Grabenstetten"	, units::gps_position( 48, 32.167, 'N',	 9, 26.233,'E'),	units::length::meter_t(710.0	)},
+		{"Grafenwoehr Mil"	, units::gps_position( 49, 41.917, 'N',	11, 56.417,'E'),	units::length::meter_t(415.0	)},
+		{"Grambeker Heide"	, units::gps_position( 53, 35.000, 'N',	10, 41.917,'E'),	units::length::meter_t(48.0	)},
+		{"Gransee"		, units::gps_position( 53, 00.400, 'N',	13, 12.117,'E'),	units::length::meter_t(51.0	)},
+		{"Greding"		, units::gps_position( 49, 03.733, 'N',	11, 17.517,'E'),	units::length::meter_t(525.0	)},
+		{"Grefrath Niershorst"	, units::gps_position( 51, 20.050, 'N',	06, 21.583,'E'),	units::length::meter_t(31.0	)},
+		{"Greiling B Toelz"	, units::gps_position( 47, 45.917, 'N',	11, 35.717,'E'),	units::length::meter_t(713.0	)},
+		{"Greiz Obergrochlitz"	, units::gps_position( 50, 38.650, 'N',	12, 10.500,'E'),	units::length::meter_t(387.0	)},
+		{"Griesau"		, units::gps_position( 48, 57.250, 'N',	12, 25.283,'E'),	units::length::meter_t(321.0	)},
+		{"Grifte Edermuend"	, units::gps_position( 51, 13.267, 'N',	 9, 26.867,'E'),	units::length::meter_t(202.0	)},
+		{"Grosse Hoehe Ehlershausen"	, units::gps_position( 52, 32.150, 'N',	10, 01.183,'E'),	units::length::meter_t(45.0	)},
+		{"Grosse Hoehe"		, units::gps_position( 52, 59.183, 'N',	 8, 34.333,'E'),	units::length::meter_t(20.0	)},
+		{"Grosse Wiese"		, units::gps_position( 52, 08.233, 'N',	10, 34.250,'E'),	units::length::meter_t(78.0	)},
+		{"Grossenhain"		, units::gps_position( 51, 18.483, 'N',	13, 33.333,'E'),	units::length::meter_t(128.0	)},
+		{"Grossrueckerswalde"	, units::gps_position( 50, 38.650, 'N',	13, 07.717,'E'),	units::length::meter_t(671.0	)},
+		{"Grube"		, units::gps_position( 54, 14.667, 'N',	11, 01.433,'E'),	units::length::meter_t(3.0	)},
+		{"Gruenstadt Quirnheimer"	, units::gps_position( 49, 35.133, 'N',	 8, 08.367,'E'),	units::length::meter_t(316.0	)},
+		{"Gruibingen Nortel"	, units::gps_position( 48, 37.267, 'N',	 9, 39.317,'E'),	units::length::meter_t(706.0	)},
+		{"Guestrow"		, units::gps_position( 53, 48.333, 'N',	12, 13.800,'E'),	units::length::meter_t(14.0	)},
+		{"Gundelfingen"		, units::gps_position( 48, 34.167, 'N',	10, 21.517,'E'),	units::length::meter_t(440.0	)},
+		{"Gunzburg Donauried"	, units::gps_position( 48, 29.183, 'N',	10, 16.950,'E'),	units::length::meter_t(445.0	)},
+		{"Gunzenhausen Reutberg"	, units::gps_position( 49, 06.733, 'N',	10, 46.917,'E'),	units::length::meter_t(485.0	)},
+		{"Gustorfer Hoehe"	, units::gps_position( 51, 04.617, 'N',	06, 32.867,'E'),	units::length::meter_t(89.0	)},
+		{"Hagen Hof"		, units::gps_position( 51, 18.433, 'N',	07, 25.617,'E'),	units::length::meter_t(394.0	)},
+		{"Hahnweide"		, units::gps_position( 48, 37.917, 'N',	 9, 25.750,'E'),	units::length::meter_t(352.0	)},
+		{"Haiterbach Nagold"	, units::gps_position( 48, 31.917, 'N',	 8, 40.667,'E'),	units::length::meter_t(596.0	)},
+		{"Halle Oppin"		, units::gps_position( 51, 33.133, 'N',	12, 03.233,'E'),	units::length::meter_t(107.0	)},
+		{"Hallertau"		, units::gps_position( 48, 38.967, 'N',	11, 35.783,'E'),	units::length::meter_t(386.0	)},
+		{"Hamburg Finkenwerder"	, units::gps_position( 53, 32.117, 'N',	 9, 50.133,'E'),	units::length::meter_t(6.0	)},
+		{"Hamburg Fuhlsbuettel"	, units::gps_position( 53, 37.833, 'N',	 9, 59.300,'E'),	units::length::meter_t(15.0	)},
+		{"Hameln Pyrmont"	, units::gps_position( 51, 57.967, 'N',	 9, 17.450,'E'),	units::length::meter_t(360.0	)},
+		{"Hamm Lippewiesen"	, units::gps_position( 51, 41.417, 'N',	07, 49.067,'E'),	units::length::meter_t(58.0	)},
+		{"Hangensteinerhof"	, units::gps_position( 48, 55.967, 'N',	 8, 48.917,'E'),	units::length::meter_t(299.0	)},
+		{"Hannover"		, units::gps_position( 52, 27.617, 'N',	 9, 41.017,'E'),	units::length::meter_t(55.0	)},
+		{"Harle"		, units::gps_position( 53, 42.400, 'N',	07, 49.217,'E'),	units::length::meter_t(3.0	)},
+		{"Hartenholm"		, units::gps_position( 53, 54.867, 'N',	10, 02.100,'E'),	units::length::meter_t(37.0	)},
+		{"Hassfurt Schweinfurt"	, units::gps_position( 50, 01.083, 'N',	10, 31.767,'E'),	units::length::meter_t(220.0	)},
+		{"Hassloch Pfalz"	, units::gps_position( 49, 21.317, 'N',	 8, 17.417,'E'),	units::length::meter_t(108.0	)},
+		{"Hayingen"		, units::gps_position( 48, 17.083, 'N',	 9, 27.933,'E'),	units::length::meter_t(703.0	)},
+		{"Heide Buesum"		, units::gps_position( 54, 09.200, 'N',	 8, 54.100,'E'),	units::length::meter_t(3.0	)},
+		{"Heilbronn Boeckingen"	, units::gps_position( 49, 07.300, 'N',	 9, 10.767,'E'),	units::length::meter_t(159.0	)},
+		{"Heiligenberg"		, units::gps_position( 47, 50.000, 'N',	 9, 18.067,'E'),	units::length::meter_t(759.0	)},
+		{"Helgoland Duene"	, units::gps_position( 54, 11.117, 'N',	07, 54.950,'E'),	units::length::meter_t(3.0	)},
+		{"Hellenhagen"		, units::gps_position( 52, 01.517, 'N',	 9, 33.883,'E'),	units::length::meter_t(181.0	)},
+		{"Hellingst"		, units::gps_position( 53, 22.500, 'N',	 8, 51.000,'E'),	units::length::meter_t(20.0	)},
+		{"Hengsen Opherdicke"	, units::gps_position( 51, 28.400, 'N',	07, 38.700,'E'),	units::length::meter_t(132.0	)},
+		{"Heppenheim"		, units::gps_position( 49, 37.283, 'N',	 8, 37.500,'E'),	units::length::meter_t(98.0	)},
+		{"Heringsdorf"		, units::gps_position( 53, 52.717, 'N',	14, 09.133,'E'),	units::length::meter_t(28.0	)},
+		{"Hermuthausen"		, units::gps_position( 49, 18.867, 'N',	 9, 44.717,'E'),	units::length::meter_t(410.0	)},
+		{"Herrenteich"		, units::gps_position( 49, 20.750, 'N',	 8, 29.300,'E'),	units::length::meter_t(91.0	)},
+		{"Hersbruck"		, units::gps_position( 49, 30.450, 'N',	11, 26.617,'E'),	units::length::meter_t(335.0	)},
+		{"Herten Rheinflden"	, units::gps_position( 47, 33.600, 'N',	07, 44.900,'E'),	units::length::meter_t(284.0	)},
+		{"Herzogenaurach"	, units::gps_position( 49, 34.967, 'N',	10, 52.700,'E'),	units::length::meter_t(324.0	)},
+		{"Hessisch Lichtenau"	, units::gps_position( 51, 11.333, 'N',	 9, 44.567,'E'),	units::length::meter_t(411.0	)},
+		{"Hettstadt"		, units::gps_position( 49, 47.917, 'N',	 9, 50.217,'E'),	units::length::meter_t(320.0	)},
+		{"Hetzleser Berg"	, units::gps_position( 49, 38.533, 'N',	11, 09.750,'E'),	units::length::meter_t(528.0	)},
+		{"Heubach"		, units::gps_position( 48, 48.183, 'N',	 9, 55.667,'E'),	units::length::meter_t(433.0	)},
+		{"Hienheim"		, units::gps_position( 48, 52.683, 'N',	11, 45.633,'E'),	units::length::meter_t(397.0	)},
+		{"Hildesheim"		, units::gps_position( 52, 10.783, 'N',	 9, 56.733,'E'),	units::length::meter_t(88.0	)},
+		{"Hilzingen"		, units::gps_position( 47, 45.633, 'N',	 8, 46.050,'E'),	units::length::meter_t(459.0	)},
+		{"Hirzenhain"		, units::gps_position( 50, 47.267, 'N',	 8, 23.550,'E'),	units::length::meter_t(528.0	)},
+		{"Hockenheim"		, units::gps_position( 49, 19.483, 'N',	 8, 31.667,'E'),	units::length::meter_t(93.0	)},
+		{"Hodenhagen"		, units::gps_position( 52, 45.750, 'N',	 9, 36.733,'E'),	units::length::meter_t(22.0	)},
+		{"Hoelleberg"		, units::gps_position( 51, 36.650, 'N',	 9, 23.917,'E'),	units::length::meter_t(257.0	)},
+		{"Hoepen"		, units::gps_position( 53, 08.833, 'N',	 9, 47.800,'E'),	units::length::meter_t(85.0	)},
+		{"Hoerbach"		, units::gps_position( 50, 40.100, 'N',	 8, 15.633,'E'),	units::length::meter_t(330.0	)},
+		{"Hoexter Holzminden"	, units::gps_position( 51, 48.383, 'N',	 9, 22.700,'E'),	units::length::meter_t(284.0	)},
+		{"Hof-Plauen"		, units::gps_position( 50, 17.317, 'N',	11, 51.200,'E'),	units::length::meter_t(598.0	)},
+		{"Hohenfels Mil"	, units::gps_position( 49, 13.000, 'N',	11, 50.150,'E'),	units::length::meter_t(445.0	)},
+		{"Hoherodskopf"		, units::gps_position( 50, 30.100, 'N',	 9, 13.350,'E'),	units::length::meter_t(674.0	)},
+		{"Hohn Mil"		, units::gps_position( 54, 18.733, 'N',	 9, 32.300,'E'),	units::length::meter_t(12.0	)},
+		{"Holtorfsloh"		, units::gps_position( 53, 19.333, 'N',	10, 04.467,'E'),	units::length::meter_t(55.0	)},
+		{"Holzdorf Mil"		, units::gps_position( 51, 46.083, 'N',	13, 10.050,'E'),	units::length::meter_t(82.0	)},
+		{"Homberg Ohm"		, units::gps_position( 50, 44.878, 'N',	 9, 01.274,'E'),	units::length::meter_t(349.0	)},
+		{"Hoppstaedten Weiersbach"	, units::gps_position( 49, 36.650, 'N',	07, 11.200,'E'),	units::length::meter_t(332.0	)},
+		{"Hornberg"		, units::gps_position( 48, 44.683, 'N',	 9, 51.750,'E'),	units::length::meter_t(682.0	)},
+		{"Hoya"		, units::gps_position( 52, 48.717, 'N',	 9, 09.833,'E'),	units::length::meter_t(15.0	)},
+		{"Huelben"		, units::gps_position( 48, 31.750, 'N',	 9, 23.867,'E'),	units::length::meter_t(718.0	)},
+		{"Huensborn"		, units::gps_position( 50, 55.717, 'N',	07, 53.950,'E'),	units::length::meter_t(421.0	)},
+		{"Huetten Hotzenwald"	, units::gps_position( 47, 37.983, 'N',	07, 56.483,'E'),	units::length::meter_t(873.0	)},
+		{"Huettenbusch"		, units::gps_position( 53, 17.200, 'N',	 8, 56.900,'E'),	units::length::meter_t(3.0	)},
+		{"Huhnrain As"		, units::gps_position( 50, 29.400, 'N',	 9, 50.833,'E'),	units::length::meter_t(434.0	)},
+		{"Husum Schwesing"	, units::gps_position( 54, 30.600, 'N',	 9, 08.300,'E'),	units::length::meter_t(18.0	)},
+		{"Idar Oberstein"	, units::gps_position( 49, 43.933, 'N',	07, 20.167,'E'),	units::length::meter_t(475.0	)},
+		{"Illertissen"		, units::gps_position( 48, 14.117, 'N',	10, 08.267,'E'),	units::length::meter_t(512.0	)},
+		{"Illeshe Mil Heli"	, units::gps_position( 49, 28.433, 'N',	10, 23.283,'E'),	units::length::meter_t(329.0	)},
+		{"Ingelfingen Buehlhof"	, units::gps_position( 49, 19.300, 'N',	 9, 39.817,'E'),	units::length::meter_t(421.0	)},
+		{"Ingolstadt Etting"	, units::gps_position( 48, 48.617, 'N',	11, 25.257,'E'),	units::length::meter_t(380.0	)},
+		{"Ingolstadt Manching Mil"	, units::gps_position( 48, 43.250, 'N',	11, 31.814,'E'),	units::length::meter_t(366.0	)},
+		{"Irsingen"		, units::gps_position( 49, 02.300, 'N',	10, 30.183,'E'),	units::length::meter_t(466.0	)},
+		{"Iserlohn Rheinermark"	, units::gps_position( 51, 25.817, 'N',	07, 38.650,'E'),	units::length::meter_t(191.0	)},
+		{"Iserlohn Suemmer"	, units::gps_position( 51, 26.250, 'N',	07, 42.100,'E'),	units::length::meter_t(157.0	)},
+		{"Isny Rotmoos"		, units::gps_position( 47, 42.017, 'N',	10, 01.233,'E'),	units::length::meter_t(689.0	)},
+		{"Ithwiesen"		, units::gps_position( 51, 57.067, 'N',	 9, 39.767,'E'),	units::length::meter_t(375.0	)},
+		{"Itzehoe"		, units::gps_position( 53, 59.667, 'N',	 9, 34.717,'E'),	units::length::meter_t(24.0	)},
+		{"Jena Schongleina"	, units::gps_position( 50, 54.933, 'N',	11, 42.850,'E'),	units::length::meter_t(375.0	)},
+		{"Jesenwang"		, units::gps_position( 48, 10.467, 'N',	11, 07.517,'E'),	units::length::meter_t(565.0	)},
+		{"Jever Mil"		, units::gps_position( 53, 32.017, 'N',	07, 53.317,'E'),	units::length::meter_t(6.0	)},
+		{"Johannisau"		, units::gps_position( 50, 32.217, 'N',	 9, 39.750,'E'),	units::length::meter_t(265.0	)},
+		{"Juist"		, units::gps_position( 53, 40.883, 'N',	07, 03.400,'E'),	units::length::meter_t(3.0	)},
+		{"Kamen Heeren"		, units::gps_position( 51, 35.417, 'N',	07, 42.600,'E'),	units::length::meter_t(63.0	)},
+		{"Kamenz"		, units::gps_position( 51, 17.817, 'N',	14, 07.650,'E'),	units::length::meter_t(153.0	)},
+		{"Kammermark"		, units::gps_position( 53, 11.717, 'N',	12, 09.850,'E'),	units::length::meter_t(84.0	)},
+		{"Kamp-Lintfort"	, units::gps_position( 51, 31.767, 'N',	06, 32.217,'E'),	units::length::meter_t(21.0	)},
+		{"Karlshoefen"		, units::gps_position( 53, 19.967, 'N',	 9, 01.717,'E'),	units::length::meter_t(6.0	)},
+		{"Karlsruhe Baden"	, units::gps_position( 48, 46.750, 'N',	 8, 04.833,'E'),	units::length::meter_t(125.0	)},
+		{"Karlstadt Saupurzel"	, units::gps_position( 49, 58.283, 'N',	 9, 47.483,'E'),	units::length::meter_t(248.0	)},
+		{"Kassel Calden"	, units::gps_position( 51, 25.250, 'N',	 9, 23.533,'E'),	units::length::meter_t(250.0	)},
+		{"Kaufbeuren"		, units::gps_position( 47, 51.683, 'N',	10, 36.850,'E'),	units::length::meter_t(726.0	)},
+		{"Kehl Sundheim"	, units::gps_position( 48, 33.683, 'N',	07, 50.633,'E'),	units::length::meter_t(137.0	)},
+		{"Kell"		, units::gps_position( 49, 37.300, 'N',	06, 50.417,'E'),	units::length::meter_t(559.0	)},
+		{"Kempten Durach"	, units::gps_position( 47, 41.467, 'N',	10, 20.283,'E'),	units::length::meter_t(710.0	)},
+		{"Kiel Holtenau"	, units::gps_position( 54, 22.767, 'N',	10, 08.717,'E'),	units::length::meter_t(31.0	)},
+		{"Kirchdorf Inn"	, units::gps_position( 48, 14.300, 'N',	12, 58.617,'E'),	units::length::meter_t(340.0	)},
+		{"Kirchzarten"		, units::gps_position( 47, 57.050, 'N',	07, 57.350,'E'),	units::length::meter_t(415.0	)},
+		{"Kirn"		, units::gps_position( 49, 46.433, 'N',	07, 31.300,'E'),	units::length::meter_t(429.0	)},
+		{"Kisslegg Wangen"	, units::gps_position( 47, 45.218, 'N',	 9, 51.945,'E'),	units::length::meter_t(640.0	)},
+		{"Kitzingen"		, units::gps_position( 49, 44.517, 'N',	10, 12.117,'E'),	units::length::meter_t(202.0	)},
+		{"Klein Muehlingen"	, units::gps_position( 51, 56.850, 'N',	11, 46.183,'E'),	units::length::meter_t(53.0	)},
+		{"Kleve Wisseler Duenen"	, units::gps_position( 51, 46.167, 'N',	06, 17.950,'E'),	units::length::meter_t(18.0	)},
+		{"Klietz Scharlibbe"	, units::gps_position( 52, 42.600, 'N',	12, 04.383,'E'),	units::length::meter_t(26.0	)},
+		{"Klippeneck"		, units::gps_position( 48, 06.467, 'N',	 8, 45.750,'E'),	units::length::meter_t(962.0	)},
+		{"Klix"		, units::gps_position( 51, 16.433, 'N',	14, 30.417,'E'),	units::length::meter_t(145.0	)},
+		{"Koblenz Winningen"	, units::gps_position( 50, 19.517, 'N',	07, 31.683,'E'),	units::length::meter_t(195.0	)},
+		{"Koenigsdorf"		, units::gps_position( 47, 49.717, 'N',	11, 27.967,'E'),	units::length::meter_t(600.0	)},
+		{"Koethen"		, units::gps_position( 51, 43.417, 'N',	11, 56.883,'E'),	units::length::meter_t(93.0	)},
+		{"Koln-Bonn"		, units::gps_position( 50, 51.950, 'N',	07, 08.567,'E'),	units::length::meter_t(92.0	)},
+		{"Konstanz"		, units::gps_position( 47, 40.900, 'N',	 9, 08.283,'E'),	units::length::meter_t(396.0	)},
+		{"Konz Koenen"		, units::gps_position( 49, 40.533, 'N',	06, 32.567,'E'),	units::length::meter_t(217.0	)},
+		{"Korbach"		, units::gps_position( 51, 15.150, 'N',	 8, 52.400,'E'),	units::length::meter_t(390.0	)},
+		{"Krefeld Egelsberg"	, units::gps_position( 51, 23.083, 'N',	06, 35.267,'E'),	units::length::meter_t(43.0	)},
+		{"Kronach"		, units::gps_position( 50, 14.617, 'N',	11, 21.533,'E'),	units::length::meter_t(466.0	)},
+		{"Kuehrstedt Bederkesa"	, units::gps_position( 53, 34.083, 'N',	 8, 47.367,'E'),	units::length::meter_t(9.0	)},
+		{"Kulmbach"		, units::gps_position( 50, 08.100, 'N',	11, 27.550,'E'),	units::length::meter_t(506.0	)},
+		{"Kusel Langenbach"	, units::gps_position( 49, 28.683, 'N',	07, 18.533,'E'),	units::length::meter_t(457.0	)},
+		{"Kyritz"		, units::gps_position( 52, 55.133, 'N',	12, 25.517,'E'),	units::length::meter_t(40.0	)},
+		{"Laage Mil"		, units::gps_position( 53, 55.083, 'N',	12, 16.700,'E'),	units::length::meter_t(43.0	)},
+		{"Lachen Speyerdorf"	, units::gps_position( 49, 19.800, 'N',	 8, 12.767,'E'),	units::length::meter_t(118.0	)},
+		{"Lager Hammelburg"	, units::gps_position( 50, 05.917, 'N',	 9, 53.033,'E'),	units::length::meter_t(342.0	)},
+		{"Lahr"		, units::gps_position( 48, 22.150, 'N',	07, 49.667,'E'),	units::length::meter_t(156.0	)},
+		{"Laichingen"		, units::gps_position( 48, 29.817, 'N',	 9, 38.417,'E'),	units::length::meter_t(746.0	)},
+		{"Landau Ebenberg"	, units::gps_position( 49, 10.583, 'N',	 8, 08.167,'E'),	units::length::meter_t(162.0	)},
+		{"Landsberg Mil"	, units::gps_position( 48, 04.233, 'N',	10, 54.367,'E'),	units::length::meter_t(622.0	)},
+		{"Landshut"		, units::gps_position( 48, 30.700, 'N',	12, 02.000,'E'),	units::length::meter_t(399.0	)},
+		{"Langenberg Hatte"	, units::gps_position( 50, 47.850, 'N',	 9, 33.800,'E'),	units::length::meter_t(350.0	)},
+		{"Langenberg"		, units::gps_position( 50, 47.617, 'N',	 9, 33.683,'E'),	units::length::meter_t(360.0	)},
+		{"Langenfeld Wiescheid"	, units::gps_position( 51, 08.450, 'N',	06, 59.117,'E'),	units::length::meter_t(86.0	)},
+		{"Langenfeld Wiescheid"	, units::gps_position( 51, 08.460, 'N',	06, 59.110,'E'),	units::length::meter_t(80.0	)},
+		{"Langenlonsheim"	, units::gps_position( 49, 54.500, 'N',	07, 54.467,'E'),	units::length::meter_t(92.0	)},
+		{"Langenselbold"	, units::gps_position( 50, 10.617, 'N',	 9, 04.000,'E'),	units::length::meter_t(118.0	)},
+		{"Langeoog"		, units::gps_position( 53, 44.567, 'N',	07, 29.917,'E'),	units::length::meter_t(3.0	)},
+		{"Langhennersdorf"	, units::gps_position( 50, 56.917, 'N',	13, 15.717,'E'),	units::length::meter_t(390.0	)},
+		{"Laucha"		, units::gps_position( 51, 14.767, 'N',	11, 41.617,'E'),	units::length::meter_t(226.0	)},
+		{"Lauenbrueck"		, units::gps_position( 53, 12.467, 'N',	 9, 34.400,'E'),	units::length::meter_t(29.0	)},
+		{"Lauf Lillinghof"	, units::gps_position( 49, 36.317, 'N',	11, 17.017,'E'),	units::length::meter_t(544.0	)},
+		{"Laufenselden"		, units::gps_position( 50, 13.300, 'N',	07, 59.917,'E'),	units::length::meter_t(400.0	)},
+		{"Laupheim Mil"		, units::gps_position( 48, 13.200, 'N',	 9, 54.617,'E'),	units::length::meter_t(540.0	)},
+		{"Lauterbach"		, units::gps_position( 50, 41.017, 'N',	 9, 24.683,'E'),	units::length::meter_t(364.0	)},
+		{"Lechfeld Mil"		, units::gps_position( 48, 11.133, 'N',	10, 51.667,'E'),	units::length::meter_t(555.0	)},
+		{"Leck"		, units::gps_position( 54, 47.400, 'N',	 8, 57.683,'E'),	units::length::meter_t(6.0	)},
+		{"Leer Papenburg"	, units::gps_position( 53, 16.317, 'N',	07, 26.517,'E'),	units::length::meter_t(1.0	)},
+		{"Leibertingen"		, units::gps_position( 48, 02.673, 'N',	 9, 01.873,'E'),	units::length::meter_t(830.0	)},
+		{"Leibertingen"		, units::gps_position( 48, 02.683, 'N',	 9, 01.833,'E'),	units::length::meter_t(833.0	)},
+		{"Leipzig Halle"	, units::gps_position( 51, 26.033, 'N',	12, 14.386,'E'),	units::length::meter_t(143.0	)},
+		{"Leipzig-Altenburg"	, units::gps_position( 50, 58.917, 'N',	12, 30.383,'E'),	units::length::meter_t(195.0	)},
+		{"Leutkirch Unterzeil"	, units::gps_position( 47, 51.533, 'N',	10, 00.867,'E'),	units::length::meter_t(640.0	)},
+		{"Leuzendorf"		, units::gps_position( 49, 21.100, 'N',	10, 04.467,'E'),	units::length::meter_t(463.0	)},
+		{"Leverkusen"		, units::gps_position( 51, 00.917, 'N',	07, 00.367,'E'),	units::length::meter_t(49.0	)},
+		{"Lichtenfels"		, units::gps_position( 50, 08.867, 'N',	11, 02.817,'E'),	units::length::meter_t(259.0	)},
+		{"Lindlar"		, units::gps_position( 50, 59.817, 'N',	07, 22.600,'E'),	units::length::meter_t(327.0	)},
+		{"Linkenheim"		, units::gps_position( 49, 08.500, 'N',	 8, 23.667,'E'),	units::length::meter_t(97.0	)},
+		{"Loechgau"		, units::gps_position( 49, 00.067, 'N',	 9, 04.917,'E'),	units::length::meter_t(272.0	)},
+		{"Ludwigshafen Dannstadt"	, units::gps_position( 49, 24.717, 'N',	 8, 20.983,'E'),	units::length::meter_t(96.0	)},
+		{"Luebeck"		, units::gps_position( 53, 48.317, 'N',	10, 43.150,'E'),	units::length::meter_t(15.0	)},
+		{"Luechow Rehbeck"	, units::gps_position( 53, 01.033, 'N',	11, 08.683,'E'),	units::length::meter_t(10.0	)},
+		{"Lueneburg"		, units::gps_position( 53, 14.900, 'N',	10, 27.483,'E'),	units::length::meter_t(49.0	)},
+		{"Luenen Lippeweiden"	, units::gps_position( 51, 37.017, 'N',	07, 30.083,'E'),	units::length::meter_t(50.0	)},
+		{"Luesse"		, units::gps_position( 52, 08.600, 'N',	12, 40.217,'E'),	units::length::meter_t(64.0	)},
+		{"Magdeburg Cochstedt"	, units::gps_position( 51, 51.367, 'N',	11, 25.083,'E'),	units::length::meter_t(183.0	)},
+		{"Magdeburg-City"	, units::gps_position( 52, 04.417, 'N',	11, 37.617,'E'),	units::length::meter_t(82.0	)},
+		{"Mainbullau"		, units::gps_position( 49, 41.700, 'N',	 9, 10.950,'E'),	units::length::meter_t(455.0	)},
+		{"Mainz Finthen"	, units::gps_position( 49, 58.150, 'N',	 8, 08.867,'E'),	units::length::meter_t(232.0	)},
+		{"Malmsheim"		, units::gps_position( 48, 47.083, 'N',	 8, 55.050,'E'),	units::length::meter_t(451.0	)},
+		{"Malsch"		, units::gps_position( 49, 14.250, 'N',	 8, 40.700,'E'),	units::length::meter_t(133.0	)},
+		{"Mannheim City"	, units::gps_position( 49, 28.367, 'N',	 8, 30.783,'E'),	units::length::meter_t(95.0	)},
+		{"Marburg Schoenstadt"	, units::gps_position( 50, 52.450, 'N',	 8, 48.900,'E'),	units::length::meter_t(251.0	)},
+		{"Markdorf"		, units::gps_position( 47, 42.567, 'N',	 9, 23.350,'E'),	units::length::meter_t(431.0	)},
+		{"Marl Loemuehle"	, units::gps_position( 51, 38.817, 'N',	07, 09.817,'E'),	units::length::meter_t(73.0	)},
+		{"Marpingen"		, units::gps_position( 49, 27.167, 'N',	07, 02.367,'E'),	units::length::meter_t(351.0	)},
+		{"Meiersberg"		, units::gps_position( 51, 17.983, 'N',	06, 57.383,'E'),	units::length::meter_t(164.0	)},
+		{"Meinerzhagen"		, units::gps_position( 51, 06.000, 'N',	07, 35.967,'E'),	units::length::meter_t(472.0	)},
+		{"Melle Groenegau"	, units::gps_position( 52, 12.050, 'N',	 8, 22.833,'E'),	units::length::meter_t(73.0	)},
+		{"Memmingen"		, units::gps_position( 47, 59.333, 'N',	10, 14.367,'E'),	units::length::meter_t(628.0	)},
+		{"Menden Barge"		, units::gps_position( 51, 27.583, 'N',	07, 50.167,'E'),	units::length::meter_t(207.0	)},
+		{"Mendig"		, units::gps_position( 50, 21.950, 'N',	07, 18.917,'E'),	units::length::meter_t(174.0	)},
+		{"Mengen Hohentengen"	, units::gps_position( 48, 03.233, 'N',	 9, 22.367,'E'),	units::length::meter_t(555.0	)},
+		{"Mengeringhausen"	, units::gps_position( 51, 22.583, 'N',	 8, 58.867,'E'),	units::length::meter_t(363.0	)},
+		{"Meppen Mil"		, units::gps_position( 52, 43.400, 'N',	07, 19.583,'E'),	units::length::meter_t(21.0	)},
+		{"Merseburg"		, units::gps_position( 51, 21.750, 'N',	11, 56.467,'E'),	units::length::meter_t(104.0	)},
+		{"Meschede Schueren"	, units::gps_position( 51, 18.167, 'N',	 8, 14.367,'E'),	units::length::meter_t(439.0	)},
+		{"Michelbach"		, units::gps_position( 50, 13.900, 'N',	 8, 04.617,'E'),	units::length::meter_t(301.0	)},
+		{"Michelstadt"		, units::gps_position( 49, 40.717, 'N',	 8, 58.300,'E'),	units::length::meter_t(349.0	)},
+		{"Mindelheim Mattseis"	, units::gps_position( 48, 06.467, 'N',	10, 31.483,'E'),	units::length::meter_t(567.0	)},
+		{"Moeckmuehl Korb"	, units::gps_position( 49, 20.650, 'N',	 9, 24.017,'E'),	units::length::meter_t(354.0	)},
+		{"Moenchengladbach"	, units::gps_position( 51, 13.817, 'N',	06, 30.267,'E'),	units::length::meter_t(40.0	)},
+		{"Moenchsheide"		, units::gps_position( 50, 30.483, 'N',	07, 15.333,'E'),	units::length::meter_t(213.0	)},
+		{"Montabaur"		, units::gps_position( 50, 25.433, 'N',	07, 49.800,'E'),	units::length::meter_t(265.0	)},
+		{"Moosburg Auf Kippe"	, units::gps_position( 48, 27.400, 'N',	11, 56.500,'E'),	units::length::meter_t(421.0	)},
+		{"Mosbach Lohrbach"	, units::gps_position( 49, 23.967, 'N',	 9, 07.417,'E'),	units::length::meter_t(332.0	)},
+		{"Mosenberg"		, units::gps_position( 51, 03.767, 'N',	 9, 25.317,'E'),	units::length::meter_t(402.0	)},
+		{"Muehldorf"		, units::gps_position( 48, 16.783, 'N',	12, 30.017,'E'),	units::length::meter_t(406.0	)},
+		{"Muehlhausen"		, units::gps_position( 51, 12.783, 'N',	10, 32.967,'E'),	units::length::meter_t(247.0	)},
+		{"Muelben"		, units::gps_position( 49, 27.300, 'N',	 9, 06.283,'E'),	units::length::meter_t(519.0	)},
+		{"Muellheim"		, units::gps_position( 47, 49.450, 'N',	07, 38.383,'E'),	units::length::meter_t(292.0	)},
+		{"Muenster Telgte"	, units::gps_position( 51, 56.667, 'N',	07, 46.417,'E'),	units::length::meter_t(55.0	)},
+		{"Mueritz Airpark"	, units::gps_position( 53, 18.383, 'N',	12, 45.150,'E'),	units::length::meter_t(63.0	)},
+		{"Munchen"		, units::gps_position( 48, 21.233, 'N',	11, 47.167,'E'),	units::length::meter_t(454.0	)},
+		{"Munsingen Eisberg"	, units::gps_position( 48, 24.550, 'N',	 9, 26.550,'E'),	units::length::meter_t(725.0	)},
+		{"Musbach"		, units::gps_position( 48, 30.167, 'N',	 8, 28.717,'E'),	units::length::meter_t(697.0	)},
+		{"Nabern Teck"		, units::gps_position( 48, 36.750, 'N',	 9, 28.633,'E'),	units::length::meter_t(372.0	)},
+		{"Nannhausen"		, units::gps_position( 49, 58.217, 'N',	07, 28.733,'E'),	units::length::meter_t(381.0	)},
+		{"Nardt"		, units::gps_position( 51, 27.100, 'N',	14, 12.150,'E'),	units::length::meter_t(117.0	)},
+		{"Nastaetten"		, units::gps_position( 50, 11.883, 'N',	07, 53.333,'E'),	units::length::meter_t(363.0	)},
+		{"Neresheim"		, units::gps_position( 48, 44.500, 'N',	10, 19.667,'E'),	units::length::meter_t(538.0	)},
+		{"Neu Guelze"		, units::gps_position( 53, 22.867, 'N',	10, 48.250,'E'),	units::length::meter_t(12.0	)},
+		{"Neubrandenburg"	, units::gps_position( 53, 36.133, 'N',	13, 18.367,'E'),	units::length::meter_t(70.0	)},
+		{"Neuburg Egweil"	, units::gps_position( 48, 46.917, 'N',	11, 12.917,'E'),	units::length::meter_t(412.0	)},
+		{"Neuburg Mil"		, units::gps_position( 48, 42.667, 'N',	11, 12.700,'E'),	units::length::meter_t(381.0	)},
+		{"Neuhardenberg"	, units::gps_position( 52, 36.783, 'N',	14, 14.567,'E'),	units::length::meter_t(12.0	)},
+		{"Neuhausen Cottbus"	, units::gps_position( 51, 41.083, 'N',	14, 25.383,'E'),	units::length::meter_t(85.0	)},
+		{"Neuhausen ob Eck"	, units::gps_position( 47, 58.600, 'N',	 8, 54.250,'E'),	units::length::meter_t(806.0	)},
+		{"Neujellingsdorf"	, units::gps_position( 54, 27.350, 'N',	11, 06.567,'E'),	units::length::meter_t(7.0	)},
+		{"Neumagen Dhron"	, units::gps_position( 49, 50.567, 'N',	06, 54.967,'E'),	units::length::meter_t(268.0	)},
+		{"Neumarkt Oberpfalz"	, units::gps_position( 49, 17.133, 'N',	11, 26.617,'E'),	units::length::meter_t(424.0	)},
+		{"Neumuenster"		, units::gps_position( 54, 04.767, 'N',	 9, 56.517,'E'),	units::length::meter_t(21.0	)},
+		{"Neunkirchen Bexbach"	, units::gps_position( 49, 20.400, 'N',	07, 15.200,'E'),	units::length::meter_t(272.0	)},
+		{"Neuruppin"		, units::gps_position( 52, 56.567, 'N',	12, 46.767,'E'),	units::length::meter_t(43.0	)},
+		{"Neustadt Aisch"	, units::gps_position( 49, 35.250, 'N',	10, 34.667,'E'),	units::length::meter_t(363.0	)},
+		{"Neustadt Glewe"	, units::gps_position( 53, 21.717, 'N',	11, 36.867,'E'),	units::length::meter_t(37.0	)},
+		{"Nidda A D Helmsberg"	, units::gps_position( 50, 24.317, 'N',	 8, 59.267,'E'),	units::length::meter_t(176.0	)},
+		{"Niederrhein Weeze"	, units::gps_position( 51, 36.150, 'N',	06, 08.533,'E'),	units::length::meter_t(34.0	)},
+		{"Niederstetten"	, units::gps_position( 49, 23.517, 'N',	 9, 57.500,'E'),	units::length::meter_t(469.0	)},
+		{"Nienburg Holzbalge"	, units::gps_position( 52, 42.583, 'N',	 9, 09.733,'E'),	units::length::meter_t(24.0	)},
+		{"Noerdlingen"		, units::gps_position( 48, 52.217, 'N',	10, 30.283,'E'),	units::length::meter_t(421.0	)},
+		{"Noervenich Mil"	, units::gps_position( 50, 49.867, 'N',	06, 39.483,'E'),	units::length::meter_t(119.0	)},
+		{"Norden Nordeich"	, units::gps_position( 53, 37.983, 'N',	07, 11.400,'E'),	units::length::meter_t(1.0	)},
+		{"Norderney"		, units::gps_position( 53, 42.400, 'N',	07, 13.800,'E'),	units::length::meter_t(3.0	)},
+		{"Nordhausen"		, units::gps_position( 51, 29.567, 'N',	10, 50.267,'E'),	units::length::meter_t(210.0	)},
+		{"Nordholz Mil"		, units::gps_position( 53, 46.050, 'N',	 8, 39.500,'E'),	units::length::meter_t(21.0	)},
+		{"Nordholz Spieka"	, units::gps_position( 53, 46.148, 'N',	 8, 38.534,'E'),	units::length::meter_t(21.0	)},
+		{"Nordhorn Lingen"	, units::gps_position( 52, 27.467, 'N',	07, 10.950,'E'),	units::length::meter_t(28.0	)},
+		{"Northeim"		, units::gps_position( 51, 42.383, 'N',	10, 02.383,'E'),	units::length::meter_t(122.0	)},
+		{"Nuernberg"		, units::gps_position( 49, 29.933, 'N',	11, 04.633,'E'),	units::length::meter_t(314.0	)},
+		{"Ober Moerlen"		, units::gps_position( 50, 21.717, 'N',	 8, 42.683,'E'),	units::length::meter_t(247.0	)},
+		{"Oberems"		, units::gps_position( 50, 14.500, 'N',	 8, 23.933,'E'),	units::length::meter_t(403.0	)},
+		{"Oberhinkofen"		, units::gps_position( 48, 57.100, 'N',	12, 08.800,'E'),	units::length::meter_t(396.0	)},
+		{"Obermehler Schlotheim"	, units::gps_position( 51, 16.067, 'N',	10, 38.083,'E'),	units::length::meter_t(277.0	)},
+		{"Oberpfaffenhofen"	, units::gps_position( 48, 04.883, 'N',	11, 16.983,'E'),	units::length::meter_t(594.0	)},
+		{"Oberrissdorf"		, units::gps_position( 51, 32.600, 'N',	11, 35.683,'E'),	units::length::meter_t(224.0	)},
+		{"Oberschleissheim"	, units::gps_position( 48, 14.350, 'N',	11, 33.550,'E'),	units::length::meter_t(485.0	)},
+		{"Ochsenfurt"		, units::gps_position( 49, 40.417, 'N',	10, 04.267,'E'),	units::length::meter_t(248.0	)},
+		{"Ochsenhausen"		, units::gps_position( 48, 03.200, 'N',	 9, 54.950,'E'),	units::length::meter_t(650.0	)},
+		{"Oehna"		, units::gps_position( 51, 53.983, 'N',	13, 03.183,'E'),	units::length::meter_t(85.0	)},
+		{"Oerlinghausen"	, units::gps_position( 51, 55.950, 'N',	 8, 39.717,'E'),	units::length::meter_t(171.0	)},
+		{"Oeventrop Ruhrwiesen"	, units::gps_position( 51, 23.767, 'N',	 8, 08.667,'E'),	units::length::meter_t(241.0	)},
+		{"Offenburg"		, units::gps_position( 48, 26.883, 'N',	07, 55.417,'E'),	units::length::meter_t(153.0	)},
+		{"Ohlstadt Poemetsried"	, units::gps_position( 47, 39.467, 'N',	11, 14.033,'E'),	units::length::meter_t(655.0	)},
+		{"Oldenburg Hatten"	, units::gps_position( 53, 04.117, 'N',	 8, 18.750,'E'),	units::length::meter_t(9.0	)},
+		{"Oppenheim"		, units::gps_position( 49, 50.467, 'N',	 8, 22.550,'E'),	units::length::meter_t(86.0	)},
+		{"Oppershausen"		, units::gps_position( 52, 35.733, 'N',	10, 13.383,'E'),	units::length::meter_t(43.0	)},
+		{"Oppingen Au"		, units::gps_position( 48, 33.400, 'N',	 9, 49.333,'E'),	units::length::meter_t(681.0	)},
+		{"Oschatz"		, units::gps_position( 51, 17.817, 'N',	13, 04.783,'E'),	units::length::meter_t(156.0	)},
+		{"Oschersleben"		, units::gps_position( 52, 02.283, 'N',	11, 12.333,'E'),	units::length::meter_t(104.0	)},
+		{"Osnabruck Atterheide"	, units::gps_position( 52, 17.200, 'N',	07, 58.183,'E'),	units::length::meter_t(83.0	)},
+		{"Osterholz Scharmbeck"	, units::gps_position( 53, 12.817, 'N',	 8, 48.617,'E'),	units::length::meter_t(2.0	)},
+		{"Ottenberg pILSACH"	, units::gps_position( 49, 19.717, 'N',	11, 28.783,'E'),	units::length::meter_t(552.0	)},
+		{"Ottengruener Heide"	, units::gps_position( 50, 13.550, 'N',	11, 43.883,'E'),	units::length::meter_t(575.0	)},
+		{"Paderborn Haxterberg"	, units::gps_position( 51, 41.317, 'N',	 8, 46.550,'E'),	units::length::meter_t(241.0	)},
+		{"Paderborn Lippstadt"	, units::gps_position( 51, 36.833, 'N',	 8, 36.950,'E'),	units::length::meter_t(213.0	)},
+		{"Parchim Kl Platz"	, units::gps_position( 53, 25.117, 'N',	11, 48.100,'E'),	units::length::meter_t(44.0	)},
+		{"Pasewalk"		, units::gps_position( 53, 30.317, 'N',	13, 56.900,'E'),	units::length::meter_t(23.0	)},
+		{"Paterzell"		, units::gps_position( 47, 50.750, 'N',	11, 03.667,'E'),	units::length::meter_t(595.0	)},
+		{"Pattonville"		, units::gps_position( 48, 51.850, 'N',	 9, 13.483,'E'),	units::length::meter_t(278.0	)},
+		{"Peenemuende"		, units::gps_position( 54, 09.533, 'N',	13, 46.383,'E'),	units::length::meter_t(3.0	)},
+		{"Pegnitz Zipser Berg"	, units::gps_position( 49, 45.733, 'N',	11, 34.467,'E'),	units::length::meter_t(543.0	)},
+		{"Peine Glindbruchkippe"	, units::gps_position( 52, 19.417, 'N',	10, 10.900,'E'),	units::length::meter_t(68.0	)},
+		{"Pellworm"		, units::gps_position( 54, 32.200, 'N',	 8, 40.800,'E'),	units::length::meter_t(1.0	)},
+		{"Pennewitz"		, units::gps_position( 50, 40.167, 'N',	11, 03.050,'E'),	units::length::meter_t(457.0	)},
+		{"Perleberg"		, units::gps_position( 53, 04.233, 'N',	11, 49.083,'E'),	units::length::meter_t(31.0	)},
+		{"Pfarrkirchen"		, units::gps_position( 48, 25.217, 'N',	12, 51.883,'E'),	units::length::meter_t(387.0	)},
+		{"Pfullendorf"		, units::gps_position( 47, 54.567, 'N',	 9, 15.050,'E'),	units::length::meter_t(699.0	)},
+		{"Pinnow"		, units::gps_position( 53, 36.950, 'N',	11, 33.767,'E'),	units::length::meter_t(43.0	)},
+		{"Pirmasens"		, units::gps_position( 49, 15.867, 'N',	07, 29.300,'E'),	units::length::meter_t(381.0	)},
+		{"Pirna Pratzschwitz"	, units::gps_position( 50, 58.783, 'N',	13, 54.517,'E'),	units::length::meter_t(122.0	)},
+		{"Plaetzer Huenfeld"	, units::gps_position( 50, 42.567, 'N',	 9, 44.350,'E'),	units::length::meter_t(350.0	)},
+		{"Pleidelsheim"		, units::gps_position( 48, 57.400, 'N',	 9, 11.517,'E'),	units::length::meter_t(190.0	)},
+		{"Plettenberg"		, units::gps_position( 51, 11.533, 'N',	07, 47.383,'E'),	units::length::meter_t(307.0	)},
+		{"Pohlheim Viehweide"	, units::gps_position( 50, 31.933, 'N',	 8, 44.033,'E'),	units::length::meter_t(237.0	)},
+		{"Poltringen"		, units::gps_position( 48, 32.817, 'N',	 8, 56.750,'E'),	units::length::meter_t(404.0	)},
+		{"Porta Westfalica"	, units::gps_position( 52, 13.267, 'N',	 8, 51.583,'E'),	units::length::meter_t(44.0	)},
+		{"Pritzwalk Sommersberg"	, units::gps_position( 53, 10.800, 'N',	12, 11.067,'E'),	units::length::meter_t(88.0	)},
+		{"Purkshof"		, units::gps_position( 54, 09.717, 'N',	12, 14.867,'E'),	units::length::meter_t(21.0	)},
+		{"Quakenbrueck"		, units::gps_position( 52, 39.783, 'N',	07, 55.583,'E'),	units::length::meter_t(24.0	)},
+		{"Radevormwald Ley"	, units::gps_position( 51, 12.983, 'N',	07, 22.933,'E'),	units::length::meter_t(390.0	)},
+		{"Radolfzell-Stahr"	, units::gps_position( 47, 48.167, 'N',	 8, 58.767,'E'),	units::length::meter_t(421.0	)},
+		{"Ramstein Mil"		, units::gps_position( 49, 26.217, 'N',	07, 36.017,'E'),	units::length::meter_t(238.0	)},
+		{"Rastatt Baldenau"	, units::gps_position( 48, 52.467, 'N',	 8, 12.783,'E'),	units::length::meter_t(113.0	)},
+		{"Regensburg Oberhub"	, units::gps_position( 49, 08.517, 'N',	12, 04.917,'E'),	units::length::meter_t(396.0	)},
+		{"Reichelsheim"		, units::gps_position( 50, 20.317, 'N',	 8, 52.717,'E'),	units::length::meter_t(121.0	)},
+		{"Reinheim"		, units::gps_position( 49, 50.367, 'N',	 8, 51.033,'E'),	units::length::meter_t(155.0	)},
+		{"Reinsdorf"		, units::gps_position( 51, 54.050, 'N',	13, 11.767,'E'),	units::length::meter_t(102.0	)},
+		{"Reiselfingen"		, units::gps_position( 47, 51.100, 'N',	 8, 22.283,'E'),	units::length::meter_t(746.0	)},
+		{"Rendsburg Schachtholm"	, units::gps_position( 54, 13.267, 'N',	 9, 36.050,'E'),	units::length::meter_t(6.0	)},
+		{"Renneritz"		, units::gps_position( 51, 35.683, 'N',	12, 14.250,'E'),	units::length::meter_t(91.0	)},
+		{"Rerik Zweedorf"	, units::gps_position( 54, 04.917, 'N',	11, 38.933,'E'),	units::length::meter_t(9.0	)},
+		{"Rheine Bentl Mil"	, units::gps_position( 52, 17.467, 'N',	07, 23.233,'E'),	units::length::meter_t(40.0	)},
+		{"Rheine Eschendorf"	, units::gps_position( 52, 16.600, 'N',	07, 29.533,'E'),	units::length::meter_t(41.0	)},
+		{"Rheinstetten"		, units::gps_position( 48, 58.667, 'N',	 8, 20.550,'E'),	units::length::meter_t(116.0	)},
+		{"Riedelbach"		, units::gps_position( 50, 18.133, 'N',	 8, 23.083,'E'),	units::length::meter_t(508.0	)},
+		{"Riedlingen"		, units::gps_position( 48, 08.667, 'N',	 9, 28.000,'E'),	units::length::meter_t(529.0	)},
+		{"Riesa Canitz"		, units::gps_position( 51, 18.183, 'N',	13, 13.667,'E'),	units::length::meter_t(123.0	)},
+		{"Riesa Goehlis"	, units::gps_position( 51, 17.583, 'N',	13, 21.433,'E'),	units::length::meter_t(98.0	)},
+		{"Rinteln"		, units::gps_position( 52, 10.517, 'N',	 9, 03.200,'E'),	units::length::meter_t(55.0	)},
+		{"Roitzschjora"		, units::gps_position( 51, 34.617, 'N',	12, 29.650,'E'),	units::length::meter_t(88.0	)},
+		{"Rosenthal Field Ploessen"	, units::gps_position( 49, 51.800, 'N',	11, 47.283,'E'),	units::length::meter_t(457.0	)},
+		{"Rossfeld"		, units::gps_position( 48, 30.817, 'N',	 9, 20.067,'E'),	units::length::meter_t(803.0	)},
+		{"Rote Wiese Helmstedt"	, units::gps_position( 52, 14.025, 'N',	10, 58.876,'E'),	units::length::meter_t(111.0	)},
+		{"Rotenburg Wuemme"	, units::gps_position( 53, 07.700, 'N',	 9, 20.917,'E'),	units::length::meter_t(27.0	)},
+		{"Roth Mil"		, units::gps_position( 49, 13.050, 'N',	11, 06.000,'E'),	units::length::meter_t(387.0	)},
+		{"Rothenberg"		, units::gps_position( 49, 29.150, 'N',	 8, 56.167,'E'),	units::length::meter_t(479.0	)},
+		{"Rothenburg Goerlitz"	, units::gps_position( 51, 21.833, 'N',	14, 57.067,'E'),	units::length::meter_t(159.0	)},
+		{"Rothenburg o d Tauber"	, units::gps_position( 49, 23.300, 'N',	10, 13.100,'E'),	units::length::meter_t(399.0	)},
+		{"Rottweil Zepfenhan"	, units::gps_position( 48, 11.200, 'N',	 8, 43.383,'E'),	units::length::meter_t(738.0	)},
+		{"Rudolstadt Groschwitz"	, units::gps_position( 50, 43.967, 'N',	11, 14.167,'E'),	units::length::meter_t(470.0	)},
+		{"Ruegen"		, units::gps_position( 54, 23.000, 'N',	13, 19.533,'E'),	units::length::meter_t(21.0	)},
+		{"Ruppiner Land Fehrbellin"	, units::gps_position( 52, 47.600, 'N',	12, 45.650,'E'),	units::length::meter_t(43.0	)},
+		{"Saal Kreuzberg"	, units::gps_position( 50, 18.533, 'N',	10, 22.400,'E'),	units::length::meter_t(266.0	)},
+		{"Saarbruecken"		, units::gps_position( 49, 12.883, 'N',	07, 06.567,'E'),	units::length::meter_t(323.0	)},
+		{"Saarlouis Dueren"	, units::gps_position( 49, 18.750, 'N',	06, 40.450,'E'),	units::length::meter_t(341.0	)},
+		{"Saarmund"		, units::gps_position( 52, 18.500, 'N',	13, 06.033,'E'),	units::length::meter_t(52.0	)},
+		{"Salzgitter Drutte"	, units::gps_position( 52, 09.267, 'N',	10, 25.583,'E'),	units::length::meter_t(98.0	)},
+		{"Salzgitter Schaeferstuhlf"	, units::gps_position( 52, 01.833, 'N',	10, 21.783,'E'),	units::length::meter_t(203.0	)},
+		{"Salzwedel"		, units::gps_position( 52, 49.683, 'N',	11, 18.983,'E'),	units::length::meter_t(33.0	)},
+		{"Saulgau"		, units::gps_position( 48, 01.767, 'N',	 9, 30.433,'E'),	units::length::meter_t(582.0	)},
+		{"Schaefhalde Steinheim"	, units::gps_position( 48, 41.550, 'N',	10, 06.017,'E'),	units::length::meter_t(628.0	)},
+		{"Schameder"		, units::gps_position( 51, 00.017, 'N',	 8, 18.550,'E'),	units::length::meter_t(550.0	)},
+		{"Scheuen Celle"	, units::gps_position( 52, 40.167, 'N',	10, 05.333,'E'),	units::length::meter_t(55.0	)},
+		{"Schlechtenfeld"	, units::gps_position( 48, 17.083, 'N',	 9, 40.400,'E'),	units::length::meter_t(562.0	)},
+		{"Schleswig Kropp"	, units::gps_position( 54, 25.533, 'N',	 9, 32.517,'E'),	units::length::meter_t(15.0	)},
+		{"Schleswig Mil"	, units::gps_position( 54, 27.567, 'N',	 9, 30.983,'E'),	units::length::meter_t(21.0	)},
+		{"Schlierstadt Seligenberg"	, units::gps_position( 49, 26.567, 'N',	 9, 21.750,'E'),	units::length::meter_t(344.0	)},
+		{"Schmallenberg Rennfeld"	, units::gps_position( 51, 09.700, 'N',	 8, 15.700,'E'),	units::length::meter_t(467.0	)},
+		{"Schmidgaden"		, units::gps_position( 49, 25.767, 'N',	12, 05.883,'E'),	units::length::meter_t(380.0	)},
+		{"Schmoldow"		, units::gps_position( 53, 58.367, 'N',	13, 20.583,'E'),	units::length::meter_t(24.0	)},
+		{"Schoenberg"		, units::gps_position( 48, 02.867, 'N',	12, 30.033,'E'),	units::length::meter_t(543.0	)},
+		{"Schoenhagen"		, units::gps_position( 52, 12.217, 'N',	13, 09.500,'E'),	units::length::meter_t(40.0	)},
+		{"Schonebeck Zackmuende"	, units::gps_position( 51, 59.783, 'N',	11, 47.383,'E'),	units::length::meter_t(52.0	)},
+		{"Schotten"		, units::gps_position( 50, 32.083, 'N',	 9, 08.733,'E'),	units::length::meter_t(500.0	)},
+		{"Schreckhof Mosbach"	, units::gps_position( 49, 21.050, 'N',	 9, 07.267,'E'),	units::length::meter_t(270.0	)},
+		{"Schwabach Buechenbach"	, units::gps_position( 49, 16.117, 'N',	11, 00.600,'E'),	units::length::meter_t(359.0	)},
+		{"Schwabmuenchen"	, units::gps_position( 48, 10.750, 'N',	10, 42.183,'E'),	units::length::meter_t(550.0	)},
+		{"Schwaebisch Hall"	, units::gps_position( 49, 07.100, 'N',	 9, 47.033,'E'),	units::length::meter_t(399.0	)},
+		{"Schwaebisch-H Weckrieden"	, units::gps_position( 49, 07.450, 'N',	 9, 46.867,'E'),	units::length::meter_t(399.0	)},
+		{"Schwandorf"		, units::gps_position( 49, 20.433, 'N',	12, 11.083,'E'),	units::length::meter_t(387.0	)},
+		{"Schwann Conweil"	, units::gps_position( 48, 50.300, 'N',	 8, 32.583,'E'),	units::length::meter_t(480.0	)},
+		{"Schwarzheide"		, units::gps_position( 51, 29.383, 'N',	13, 52.733,'E'),	units::length::meter_t(101.0	)},
+		{"Schweighofen"		, units::gps_position( 49, 01.900, 'N',	07, 59.400,'E'),	units::length::meter_t(149.0	)},
+		{"Schweinfurt-Sued"	, units::gps_position( 50, 00.633, 'N',	10, 15.083,'E'),	units::length::meter_t(210.0	)},
+		{"Schwenningen Neckar"	, units::gps_position( 48, 03.933, 'N',	 8, 34.267,'E'),	units::length::meter_t(667.0	)},
+		{"Schwerin Parchim"	, units::gps_position( 53, 25.617, 'N',	11, 47.000,'E'),	units::length::meter_t(52.0	)},
+		{"Seedorf"		, units::gps_position( 53, 20.117, 'N',	 9, 15.583,'E'),	units::length::meter_t(17.0	)},
+		{"Segeletz"		, units::gps_position( 52, 49.600, 'N',	12, 32.550,'E'),	units::length::meter_t(39.0	)},
+		{"Seissen"		, units::gps_position( 48, 24.783, 'N',	 9, 45.983,'E'),	units::length::meter_t(692.0	)},
+		{"Siegen Eisernhardt"	, units::gps_position( 50, 50.250, 'N',	 8, 00.850,'E'),	units::length::meter_t(390.0	)},
+		{"Siegerland"		, units::gps_position( 50, 42.467, 'N',	 8, 04.983,'E'),	units::length::meter_t(601.0	)},
+		{"Sierksdorf Hof Altona"	, units::gps_position( 54, 04.033, 'N',	10, 44.567,'E'),	units::length::meter_t(28.0	)},
+		{"Siewisch Ul"		, units::gps_position( 51, 41.250, 'N',	14, 12.517,'E'),	units::length::meter_t(89.0	)},
+		{"Singhofen"		, units::gps_position( 50, 16.217, 'N',	07, 51.217,'E'),	units::length::meter_t(302.0	)},
+		{"Sinsheim"		, units::gps_position( 49, 14.833, 'N',	 8, 53.633,'E'),	units::length::meter_t(159.0	)},
+		{"Soemmerda Dermsdorf"	, units::gps_position( 51, 11.917, 'N',	11, 11.467,'E'),	units::length::meter_t(137.0	)},
+		{"Soest Bad Sassendorf"	, units::gps_position( 51, 34.683, 'N',	 8, 12.850,'E'),	units::length::meter_t(120.0	)},
+		{"Sonnen"		, units::gps_position( 48, 40.950, 'N',	13, 41.683,'E'),	units::length::meter_t(824.0	)},
+		{"Sontra Dornberg"	, units::gps_position( 51, 05.250, 'N',	 9, 54.933,'E'),	units::length::meter_t(403.0	)},
+		{"Spangdahlem Mil"	, units::gps_position( 49, 58.567, 'N',	06, 41.867,'E'),	units::length::meter_t(362.0	)},
+		{"Speyer"		, units::gps_position( 49, 18.283, 'N',	 8, 27.100,'E'),	units::length::meter_t(95.0	)},
+		{"Spremberg Welzow"	, units::gps_position( 51, 34.617, 'N',	14, 08.217,'E'),	units::length::meter_t(116.0	)},
+		{"Sprossen"		, units::gps_position( 51, 02.600, 'N',	12, 13.983,'E'),	units::length::meter_t(206.0	)},
+		{"St Michaelisdon"	, units::gps_position( 53, 58.700, 'N',	 9, 08.733,'E'),	units::length::meter_t(37.0	)},
+		{"St Peter Ording"	, units::gps_position( 54, 18.533, 'N',	 8, 41.200,'E'),	units::length::meter_t(3.0	)},
+		{"Stade"		, units::gps_position( 53, 33.667, 'N',	 9, 29.917,'E'),	units::length::meter_t(19.0	)},
+		{"Stadtlohn Vreden"	, units::gps_position( 51, 59.750, 'N',	06, 50.433,'E'),	units::length::meter_t(49.0	)},
+		{"Stauffenbuehl"	, units::gps_position( 51, 09.550, 'N',	10, 02.833,'E'),	units::length::meter_t(277.0	)},
+		{"Stechow Ferchesa"	, units::gps_position( 52, 39.050, 'N',	12, 29.283,'E'),	units::length::meter_t(42.0	)},
+		{"Steinberg Surwold"	, units::gps_position( 52, 57.383, 'N',	07, 33.417,'E'),	units::length::meter_t(29.0	)},
+		{"Steinberg Wesseln"	, units::gps_position( 52, 05.017, 'N',	10, 01.100,'E'),	units::length::meter_t(180.0	)},
+		{"Stendal Borstel"	, units::gps_position( 52, 37.733, 'N',	11, 49.200,'E'),	units::length::meter_t(55.0	)},
+		{"Stillberghof"		, units::gps_position( 48, 43.850, 'N',	10, 50.117,'E'),	units::length::meter_t(510.0	)},
+		{"Stoelln Rhinow"	, units::gps_position( 52, 44.450, 'N',	12, 23.467,'E'),	units::length::meter_t(40.0	)},
+		{"Stolberg Diepenlinchen"	, units::gps_position( 50, 46.233, 'N',	06, 16.917,'E'),	units::length::meter_t(259.0	)},
+		{"Stralsund"		, units::gps_position( 54, 20.150, 'N',	13, 02.617,'E'),	units::length::meter_t(15.0	)},
+		{"Straubing"		, units::gps_position( 48, 54.050, 'N',	12, 31.033,'E'),	units::length::meter_t(320.0	)},
+		{"Strausberg"		, units::gps_position( 52, 34.800, 'N',	13, 54.933,'E'),	units::length::meter_t(78.0	)},
+		{"Stuede Bernsteinsee"	, units::gps_position( 52, 33.817, 'N',	10, 41.050,'E'),	units::length::meter_t(73.0	)},
+		{"Stuttgart"		, units::gps_position( 48, 41.400, 'N',	 9, 13.317,'E'),	units::length::meter_t(390.0	)},
+		{"Suhl Goldlauter"	, units::gps_position( 50, 37.933, 'N',	10, 43.550,'E'),	units::length::meter_t(588.0	)},
+		{"Sultmer Berg"		, units::gps_position( 51, 43.767, 'N',	 9, 59.533,'E'),	units::length::meter_t(222.0	)},
+		{"Sylt"		, units::gps_position( 54, 54.700, 'N',	 8, 20.550,'E'),	units::length::meter_t(15.0	)},
+		{"Tannheim"		, units::gps_position( 48, 00.600, 'N',	10, 05.950,'E'),	units::length::meter_t(561.0	)},
+		{"Tarmstedt"		, units::gps_position( 53, 15.083, 'N',	 9, 06.517,'E'),	units::length::meter_t(41.0	)},
+		{"Tauberbischofsheim"	, units::gps_position( 49, 38.867, 'N',	 9, 37.967,'E'),	units::length::meter_t(285.0	)},
+		{"Taucha"		, units::gps_position( 51, 23.717, 'N',	12, 32.283,'E'),	units::length::meter_t(149.0	)},
+		{"Teisendorf Pank"	, units::gps_position( 47, 49.583, 'N',	12, 50.700,'E'),	units::length::meter_t(578.0	)},
+		{"Thalmaessing Waizenhofen"	, units::gps_position( 49, 03.850, 'N',	11, 12.567,'E'),	units::length::meter_t(577.0	)},
+		{"Thannhausen"		, units::gps_position( 48, 17.400, 'N',	10, 26.517,'E'),	units::length::meter_t(491.0	)},
+		{"Tirschenreuth"	, units::gps_position( 49, 52.417, 'N',	12, 19.450,'E'),	units::length::meter_t(499.0	)},
+		{"Titschendorf"		, units::gps_position( 50, 23.833, 'N',	11, 31.367,'E'),	units::length::meter_t(650.0	)},
+		{"Torgau Beilrode"	, units::gps_position( 51, 34.267, 'N',	13, 03.133,'E'),	units::length::meter_t(82.0	)},
+		{"Traben Trarbach"	, units::gps_position( 49, 58.067, 'N',	07, 06.700,'E'),	units::length::meter_t(275.0	)},
+		{"Treuchtlingen Bubenheim"	, units::gps_position( 48, 59.750, 'N',	10, 53.100,'E'),	units::length::meter_t(412.0	)},
+		{"Trier Foehren"	, units::gps_position( 49, 51.850, 'N',	06, 47.267,'E'),	units::length::meter_t(204.0	)},
+		{"Troestau"		, units::gps_position( 50, 01.200, 'N',	11, 55.867,'E'),	units::length::meter_t(561.0	)},
+		{"Tutow"		, units::gps_position( 53, 55.317, 'N',	13, 13.133,'E'),	units::length::meter_t(6.0	)},
+		{"Uebersberg"		, units::gps_position( 48, 27.483, 'N',	 9, 17.800,'E'),	units::length::meter_t(784.0	)},
+		{"Uelzen"		, units::gps_position( 52, 59.017, 'N',	10, 27.933,'E'),	units::length::meter_t(75.0	)},
+		{"Uetersen Heist"	, units::gps_position( 53, 38.800, 'N',	 9, 42.233,'E'),	units::length::meter_t(5.0	)},
+		{"Ummern"		, units::gps_position( 52, 37.200, 'N',	10, 24.617,'E'),	units::length::meter_t(71.0	)},
+		{"Unterschuepf"		, units::gps_position( 49, 30.950, 'N',	 9, 40.150,'E'),	units::length::meter_t(346.0	)},
+		{"Unterwoessen"		, units::gps_position( 47, 43.783, 'N',	12, 26.283,'E'),	units::length::meter_t(565.0	)},
+		{"Urspring"		, units::gps_position( 48, 33.233, 'N',	 9, 54.167,'E'),	units::length::meter_t(642.0	)},
+		{"Uslar"		, units::gps_position( 51, 39.733, 'N',	 9, 36.317,'E'),	units::length::meter_t(260.0	)},
+		{"Utscheid"		, units::gps_position( 49, 59.867, 'N',	06, 20.583,'E'),	units::length::meter_t(421.0	)},
+		{"Vaihingen"		, units::gps_position( 48, 56.183, 'N',	 8, 58.817,'E'),	units::length::meter_t(312.0	)},
+		{"Varrelbusch"		, units::gps_position( 52, 54.500, 'N',	 8, 02.600,'E'),	units::length::meter_t(37.0	)},
+		{"Verden Scharnhorst"	, units::gps_position( 52, 57.917, 'N',	 9, 16.967,'E'),	units::length::meter_t(42.0	)},
+		{"Vielbrunn"		, units::gps_position( 49, 43.183, 'N',	 9, 04.933,'E'),	units::length::meter_t(459.0	)},
+		{"Vilsbiburg"		, units::gps_position( 48, 25.583, 'N',	12, 20.733,'E'),	units::length::meter_t(442.0	)},
+		{"Vilseck Mil"		, units::gps_position( 49, 38.017, 'N',	11, 46.033,'E'),	units::length::meter_t(412.0	)},
+		{"Vilshofen"		, units::gps_position( 48, 38.083, 'N',	13, 11.800,'E'),	units::length::meter_t(302.0	)},
+		{"Vinsebeck Frankenberg"	, units::gps_position( 51, 50.683, 'N',	 9, 00.817,'E'),	units::length::meter_t(247.0	)},
+		{"Vogtareuth"		, units::gps_position( 47, 56.767, 'N',	12, 12.283,'E'),	units::length::meter_t(471.0	)},
+		{"Volkleshofen Lichtenberg"	, units::gps_position( 49, 00.567, 'N',	 9, 21.267,'E'),	units::length::meter_t(396.0	)},
+		{"Wachtersberg Hub"	, units::gps_position( 48, 36.900, 'N',	 8, 45.333,'E'),	units::length::meter_t(591.0	)},
+		{"Wahlstedt"		, units::gps_position( 53, 58.167, 'N',	10, 13.300,'E'),	units::length::meter_t(40.0	)},
+		{"Waldeck Muehlberg"	, units::gps_position( 51, 13.550, 'N',	 9, 03.317,'E'),	units::length::meter_t(405.0	)},
+		{"Walldorf"		, units::gps_position( 49, 18.283, 'N',	 8, 39.550,'E'),	units::length::meter_t(103.0	)},
+		{"Wallduern"		, units::gps_position( 49, 34.900, 'N',	 9, 24.133,'E'),	units::length::meter_t(402.0	)},
+		{"Walsrode Luisenhoehe"	, units::gps_position( 52, 53.300, 'N',	 9, 36.050,'E'),	units::length::meter_t(57.0	)},
+		{"Wangerooge"		, units::gps_position( 53, 46.867, 'N',	07, 55.233,'E'),	units::length::meter_t(3.0	)},
+		{"Wanlo Niersquell"	, units::gps_position( 51, 06.052, 'N',	06, 23.637,'E'),	units::length::meter_t(74.0	)},
+		{"Warburg Heinberg"	, units::gps_position( 51, 29.833, 'N',	 9, 05.250,'E'),	units::length::meter_t(172.0	)},
+		{"Waren Vielist"	, units::gps_position( 53, 34.067, 'N',	12, 39.117,'E'),	units::length::meter_t(85.0	)},
+		{"Warngau Tannried"	, units::gps_position( 47, 49.467, 'N',	11, 42.250,'E'),	units::length::meter_t(723.0	)},
+		{"Wasserkuppe"		, units::gps_position( 50, 29.933, 'N',	 9, 57.217,'E'),	units::length::meter_t(898.0	)},
+		{"Weiden Opf"		, units::gps_position( 49, 40.733, 'N',	12, 07.000,'E'),	units::length::meter_t(405.0	)},
+		{"Weimar Umpferstedt"	, units::gps_position( 50, 57.900, 'N',	11, 24.000,'E'),	units::length::meter_t(299.0	)},
+		{"Weinheim Bergstrasse"	, units::gps_position( 49, 34.017, 'N',	 8, 36.650,'E'),	units::length::meter_t(96.0	)},
+		{"Weipertshofen"	, units::gps_position( 49, 05.183, 'N',	10, 07.483,'E'),	units::length::meter_t(440.0	)},
+		{"Weissenburg Wuelzburg"	, units::gps_position( 49, 01.550, 'N',	11, 01.117,'E'),	units::length::meter_t(615.0	)},
+		{"Weissenhorn"		, units::gps_position( 48, 17.367, 'N',	10, 08.417,'E'),	units::length::meter_t(500.0	)},
+		{"Welzheim"		, units::gps_position( 48, 52.583, 'N',	 9, 39.217,'E'),	units::length::meter_t(518.0	)},
+		{"Wenzendorf"		, units::gps_position( 53, 20.183, 'N',	 9, 46.700,'E'),	units::length::meter_t(66.0	)},
+		{"Weper"		, units::gps_position( 51, 42.750, 'N',	 9, 48.167,'E'),	units::length::meter_t(360.0	)},
+		{"Werdohl Kuentrop"	, units::gps_position( 51, 17.817, 'N',	07, 49.050,'E'),	units::length::meter_t(307.0	)},
+		{"Werneuchen"		, units::gps_position( 52, 37.917, 'N',	13, 46.467,'E'),	units::length::meter_t(79.0	)},
+		{"Wershofen Eifel"	, units::gps_position( 50, 27.100, 'N',	06, 47.067,'E'),	units::length::meter_t(476.0	)},
+		{"Wesel Romerwardt"	, units::gps_position( 51, 39.767, 'N',	06, 35.750,'E'),	units::length::meter_t(21.0	)},
+		{"Weser Wuemme"		, units::gps_position( 53, 03.233, 'N',	 9, 12.517,'E'),	units::length::meter_t(18.0	)},
+		{"Westerstede Felde"	, units::gps_position( 53, 17.317, 'N',	07, 55.850,'E'),	units::length::meter_t(8.0	)},
+		{"Wiefelstede Conneforde"	, units::gps_position( 53, 19.283, 'N',	 8, 04.400,'E'),	units::length::meter_t(7.0	)},
+		{"Wiesbaden Mil"	, units::gps_position( 50, 02.983, 'N',	 8, 19.517,'E'),	units::length::meter_t(140.0	)},
+		{"Wildberg Bodensee"	, units::gps_position( 47, 36.017, 'N',	 9, 44.517,'E'),	units::length::meter_t(520.0	)},
+		{"Wilhelmshaven"	, units::gps_position( 53, 30.133, 'N',	 8, 03.133,'E'),	units::length::meter_t(6.0	)},
+		{"Wilsche"		, units::gps_position( 52, 31.483, 'N',	10, 27.683,'E'),	units::length::meter_t(60.0	)},
+		{"Winzeln Schramberg"	, units::gps_position( 48, 16.750, 'N',	 8, 25.700,'E'),	units::length::meter_t(670.0	)},
+		{"Wipperfuerth Neye"	, units::gps_position( 51, 07.483, 'N',	07, 22.333,'E'),	units::length::meter_t(265.0	)},
+		{"Wismar"		, units::gps_position( 53, 54.883, 'N',	11, 30.083,'E'),	units::length::meter_t(12.0	)},
+		{"Wittmundhafe Mil"	, units::gps_position( 53, 32.867, 'N',	07, 40.050,'E'),	units::length::meter_t(9.0	)},
+		{"Wittstock Berlinchen"	, units::gps_position( 53, 13.550, 'N',	12, 34.067,'E'),	units::length::meter_t(79.0	)},
+		{"Woerishofen"		, units::gps_position( 48, 01.617, 'N',	10, 36.133,'E'),	units::length::meter_t(616.0	)},
+		{"Wolfhagen Graner Berg"	, units::gps_position( 51, 18.433, 'N',	 9, 10.517,'E'),	units::length::meter_t(314.0	)},
+		{"Worms"		, units::gps_position( 49, 36.383, 'N',	 8, 22.100,'E'),	units::length::meter_t(91.0	)},
+		{"Wunstorf Mil"		, units::gps_position( 52, 27.433, 'N',	 9, 25.633,'E'),	units::length::meter_t(58.0	)},
+		{"Wurzburg"		, units::gps_position( 49, 49.067, 'N',	 9, 53.850,'E'),	units::length::meter_t(297.0	)},
+		{"Wyk Auf Foehr"	, units::gps_position( 54, 41.117, 'N',	 8, 31.917,'E'),	units::length::meter_t(9.0	)},
+		{"Zell Haidberg"	, units::gps_position( 50, 08.217, 'N',	11, 47.667,'E'),	units::length::meter_t(583.0	)},
+		{"Zellhausen"		, units::gps_position( 50, 01.233, 'N',	 8, 59.017,'E'),	units::length::meter_t(113.0	)},
+		{"Zerbst"		, units::gps_position( 52, 00.133, 'N',	12, 09.167,'E'),	units::length::meter_t(80.0	)},
+		{"Zierenberg Doernberg"	, units::gps_position( 51, 21.750, 'N',	 9, 20.383,'E'),	units::length::meter_t(423.0	)},
+		{"Zweibruecken"		, units::gps_position( 49, 12.567, 'N',	07, 24.033,'E'),	units::length::meter_t(345.0	)},
+		{"Zwickau"		, units::gps_position( 50, 42.067, 'N',	12, 27.167,'E'),	units::length::meter_t(316.0	)}
+	};
+	return list;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "airports.hpp"
+#include "arena.hpp"
+#include "parser.hpp"
+#include "pipeline.hpp"
+#include "ruleset.hpp"
+#include "scoring.hpp"
+#include "stream.hpp"
+
+// Scoring of whole flights for programs embedding the analysis instead of
+// running thermik_challenge. A context keeps the memory of one flight and
+// reuses it for the next, its results stay valid until the next call.
+namespace analysis {
+
+	struct sample_t : parser::record<parser::field::true_air_speed> {};
+
+	enum class status_t : std::uint8_t {
+		ok,
+		// The context was made for a ruleset that does not exist.
+		unknown_rules,
+		// Compressed in a way this build can not read, or a bundle of flights.
+		unsupported,
+		// The compressed data is corrupt or ends early.
+		damaged,
+		// Reading stopped before the first fix, see flight_t::parse.
+		invalid,
+		// The file holds no usable fix.
+		no_fixes
+	};
+
+	const char* describe(status_t status);
+
+	// One scored flight as the emitters and the streaming scorer report it.
+	struct flight_t {
+		parser::result_t parse;
+		const airport_t* start_airport = nullptr;
+		// In order of time, with the classes of each.
+		std::pmr::vector<stream::record_t> thermals;
+		stream::ranking_t local;
+		stream::ranking_t remote;
+
+		explicit flight_t(std::pmr::memory_resource* memory) :
+			thermals(memory)
+		{}
+	};
+
+	namespace detail {
+
+		// Strongest thermal of a class and its best scoring window.
+		template <class thermals_t, class indices_t, class records_t>
+		stream::ranking_t ranking(const thermals_t& thermals, const indices_t& indices, const records_t& records, units::time::second_t scoring_window) {
+			stream::ranking_t result;
+			for(auto i : indices) {
+				if(!result.strongest || records[i].points > result.strongest->points) {
+					result.strongest = records[i];
+				}
+			}
+			const auto max_hour = find_max_hour(thermals.begin(), thermals.end(), scoring_window);
+			if(max_hour.points > 0) {
+				result.max_points = max_hour.points;
+				result.max_window.emplace(max_hour.begin->begin->time, max_hour.end->end->time);
+			}
+			return result;
+		}
+
+	}
+
+	// Fills flight from a pipeline result: every optimized thermal with its
+	// classes, then the ranking of each class.
+	template <class rules, class iterator_t>
+	void summarize(const pipeline::score_t<iterator_t>& score, flight_t& flight) {
+		flight.start_airport = score.start_airport;
+		flight.thermals.clear();
+		flight.thermals.reserve(score.thermals.size());
+		for(const auto& t : score.thermals) {
+			flight.thermals.push_back(stream::record_t{ t.begin->time, t.end->time, t.gain_te, t.average, t.points, false, false });
+		}
+		for(auto i : score.local) flight.thermals[i].local = true;
+		for(auto i : score.remote) flight.thermals[i].remote = true;
+
+		flight.local = detail::ranking(score.local_thermals(), score.local, flight.thermals, rules::scoring_window);
+		flight.remote = detail::ranking(score.remote_thermals(), score.remote, flight.thermals, rules::scoring_window);
+	}
+
+	class context_t {
+
+		std::string rules;
+		unsigned int threads;
+		arena_t arena;
+		// Allocates from arena, so it is destroyed before every reset.
+		std::optional<flight_t> flight;
+
+	public:
+
+		explicit context_t(std::string rules = ruleset::akaflieg_dresden::name, unsigned int threads = std::thread::hardware_concurrency());
+		context_t(const context_t&) = delete;
+		context_t& operator=(const context_t&) = delete;
+
+		// Scores one plain or compressed IGC file held in memory. Records that
+		// can not be decoded are skipped and listed in result().parse.
+		status_t analyse(std::string_view data);
+
+		// The flight of the last analyse, partially filled if it failed.
+		const flight_t& result() const {
+			return *flight;
+		}
+
+	};
+
+}
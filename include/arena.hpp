@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+// Memory of one flight's analysis. Every pipeline container allocates from it,
+// reset() drops all of it at once. The buffer grows to the largest flight seen,
+// after that no allocation of a flight reaches the heap and reset() is O(1).
+class arena_t {
+
+	// Upstream of the monotonic resource, counts what did not fit into the buffer.
+	class overflow_t : public std::pmr::memory_resource {
+	public:
+		std::size_t bytes = 0;
+	private:
+		void* do_allocate(std::size_t size, std::size_t alignment) override;
+		void do_deallocate(void* p, std::size_t size, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	};
+
+	std::unique_ptr<std::byte[]> buffer;
+	std::size_t capacity;
+	overflow_t overflow;
+	std::optional<std::pmr::monotonic_buffer_resource> resource;
+
+public:
+
+	explicit arena_t(std::size_t initial_capacity = 1 << 20);
+	arena_t(const arena_t&) = delete;
+	arena_t& operator=(const arena_t&) = delete;
+
+	std::pmr::memory_resource* get() {
+		return &*resource;
+	}
+
+	// Size of the preallocated buffer.
+	std::size_t size() const {
+		return capacity;
+	}
+
+	// Invalidates everything allocated from the arena.
+	void reset();
+
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Snapshots of scoring in progress, so a restarted run resumes where the last
+// one stopped instead of reading every flight from its beginning. Parts of the
+// state write themselves field by field to a writer_t and read themselves back
+// from a reader_t, iterators as fix numbers. Values are stored as they are in
+// memory, a snapshot is only read by the same build on the same machine, which
+// the header of the file checks.
+namespace checkpoint {
+
+	// Raised whenever the layout of any saved state changes.
+	constexpr std::uint8_t version = 1;
+
+	class writer_t {
+
+		std::string bytes;
+
+	public:
+
+		template <class T>
+		void put(const T& value) {
+			static_assert(std::is_trivially_copyable_v<T>, "only plain values are stored as they are");
+			bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		void put(std::string_view text) {
+			put(static_cast<std::uint64_t>(text.size()));
+			bytes.append(text);
+		}
+
+		void put(const std::string& text) {
+			put(std::string_view(text));
+		}
+
+		template <class T>
+		void put(const std::vector<T>& values) {
+			put(static_cast<std::uint64_t>(values.size()));
+			for(const auto& v : values) put(v);
+		}
+
+		template <class T, class U>
+		void put(const std::pair<T, U>& value) {
+			put(value.first);
+			put(value.second);
+		}
+
+		template <class T>
+		void put(const std::optional<T>& value) {
+			put(value.has_value());
+			if(value) put(*value);
+		}
+
+		const std::string& data() const {
+			return bytes;
+		}
+
+	};
+
+	// Every get returns false once the snapshot ends early, and so do all
+	// following ones.
+	class reader_t {
+
+		std::string_view bytes;
+		bool ok = true;
+
+	public:
+
+		explicit reader_t(std::string_view bytes) :
+			bytes(bytes)
+		{}
+
+		template <class T>
+		bool get(T& value) {
+			static_assert(std::is_trivially_copyable_v<T>, "only plain values are stored as they are");
+			if(!ok || bytes.size() < sizeof(value)) return ok = false;
+			std::memcpy(&value, bytes.data(), sizeof(value));
+			bytes.remove_prefix(sizeof(value));
+			return true;
+		}
+
+		bool get(std::string& text) {
+			std::uint64_t size;
+			if(!get(size) || bytes.size() < size) return ok = false;
+			text.assign(bytes.data(), size);
+			bytes.remove_prefix(size);
+			return true;
+		}
+
+		template <class T>
+		bool get(std::vector<T>& values) {
+			std::uint64_t size;
+			if(!get(size)) return false;
+			values.clear();
+			for(std::uint64_t i = 0; i < size; ++i) {
+				T v;
+				if(!get(v)) return false;
+				values.push_back(std::move(v));
+			}
+			return true;
+		}
+
+		template <class T, class U>
+		bool get(std::pair<T, U>& value) {
+			return get(value.first) && get(value.second);
+		}
+
+		template <class T>
+		bool get(std::optional<T>& value) {
+			bool present;
+			if(!get(present)) return false;
+			value.reset();
+			if(!present) return true;
+			T v;
+			if(!get(v)) return false;
+			value = std::move(v);
+			return true;
+		}
+
+		bool good() const {
+			return ok;
+		}
+
+		bool empty() const {
+			return bytes.empty();
+		}
+
+	};
+
+	// Writes the snapshot beside the file and renames it over, so a run
+	// stopped while writing keeps the previous one.
+	bool save(const std::string& path, const writer_t& snapshot);
+
+	// The snapshot saved to path, none if there is none or it was written by
+	// another build. error tells which, it is empty if the file is missing.
+	std::optional<std::string> load(const std::string& path, std::string& error);
+
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <units.h>
+#include <units/fixed.hpp>
+#include <units/gps.hpp>
+
+#include "parser.hpp"
+
+// Circles flown in thermals. The detector hands every fix with its turn to a
+// tracker_t, which adds up the turns and the sums of a least squares circle
+// fit in constant time per fix. It is only given the fixes the detector decides
+// are circling, so it costs nothing in between. Each full turn gives one circle_t: its centre,
+// radius and how evenly it was flown. The drift of the centres over a thermal
+// is the wind.
+namespace circling {
+
+	// As units::distance.
+	constexpr double earth_radius = 6371000;
+
+	constexpr double radians_per_milliminute = M_PI / (180 * 60000.0);
+
+	struct circle_t {
+		// Fix numbers of the first and the last fix of the circle.
+		std::size_t first, last;
+		units::timestamp begin, end;
+		units::gps_position centre;
+		units::length::meter_t radius;
+		// Root mean square of the distances of the fixes from the circle.
+		units::length::meter_t deviation;
+		bool right;
+	};
+
+	// Running sums of the fit of x² + y² + D x + E y + F = 0 (Kåsa), on a plane
+	// in meters around a reference fix.
+	class fit_t {
+
+		// The sum of z = x² + y² is xx + yy.
+		std::size_t n = 0;
+		double x = 0, y = 0;
+		double xx = 0, yy = 0, xy = 0;
+		double xz = 0, yz = 0, zz = 0;
+
+	public:
+
+		void add(double px, double py) {
+			const double pxx = px * px, pyy = py * py, pz = pxx + pyy;
+			++n;
+			x += px; y += py;
+			xx += pxx; yy += pyy; xy += px * py;
+			xz += px * pz; yz += py * pz; zz += pz * pz;
+		}
+
+		std::size_t size() const {
+			return n;
+		}
+
+		// Centre, radius and deviation, false if the points are on a line.
+		bool solve(double& cx, double& cy, double& radius, double& deviation) const {
+			const double n = static_cast<double>(this->n);
+			const double z = xx + yy;
+			// Normal equations, solved by Cramer's rule.
+			const double a[3][3] = { { xx, xy, x }, { xy, yy, y }, { x, y, n } };
+			const double b[3] = { -xz, -yz, -z };
+			auto det = [](const double m[3][3]) {
+				return
+					m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+					m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+					m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+			};
+			const double d = det(a);
+			if(!(std::abs(d) > 0)) return false;
+
+			double s[3];
+			for(int c = 0; c < 3; ++c) {
+				double m[3][3];
+				for(int r = 0; r < 3; ++r) {
+					for(int k = 0; k < 3; ++k) m[r][k] = k == c ? b[r] : a[r][k];
+				}
+				s[c] = det(m) / d;
+			}
+			const double D = s[0], E = s[1], F = s[2];
+			cx = -D / 2;
+			cy = -E / 2;
+			const double r2 = cx * cx + cy * cy - F;
+			if(!(r2 > 0)) return false;
+			radius = std::sqrt(r2);
+
+			// Sum of the squared algebraic residuals, each about 2 r times the
+			// distance of the fix from the circle.
+			const double rss =
+				zz + D * D * xx + E * E * yy + n * F * F +
+				2 * (D * xz + E * yz + F * z + D * E * xy + D * F * x + E * F * y);
+			deviation = std::sqrt(std::max(rss, 0.0) / n) / (2 * radius);
+			return true;
+		}
+
+	};
+
+	// Follows the track fix by fix and collects every full turn flown while
+	// circling.
+	class tracker_t {
+
+		// A turn taking longer is no circle: 360° at 6°/s, the turn rate of §3.3.
+		static constexpr std::int32_t max_duration = 60;
+
+		std::vector<circle_t> circles;
+
+		// Circle being flown, once a fix was given. A fix not right after the
+		// last one given starts a new one.
+		bool following = false;
+		std::size_t last = 0;
+		fit_t fit;
+		std::size_t first = 0;
+		units::timestamp begin;
+		// Longitude and latitude of the reference fix, in milliminutes.
+		std::int32_t x0 = 0, y0 = 0;
+		// Meters per milliminute of longitude and latitude at the reference.
+		double mx = 0;
+		static constexpr double my = radians_per_milliminute * earth_radius;
+		double turned = 0;
+
+		void restart(std::size_t number, const units::gps_position& position, units::timestamp time) {
+			fit = fit_t();
+			first = number;
+			begin = time;
+			x0 = position.longitude_milliminutes();
+			y0 = position.latitude_milliminutes();
+			mx = my * std::cos(y0 * radians_per_milliminute);
+			turned = 0;
+			add(position);
+		}
+
+		void add(const units::gps_position& position) {
+			fit.add(
+				(position.longitude_milliminutes() - x0) * mx,
+				(position.latitude_milliminutes() - y0) * my
+			);
+		}
+
+		void close(std::size_t number, units::timestamp time) {
+			double cx, cy, radius, deviation;
+			if(fit.size() >= 5 && fit.solve(cx, cy, radius, deviation)) {
+				const double lat = y0 + cy / my;
+				const double lon = x0 + cx / mx;
+				circles.push_back(circle_t{
+					first,
+					number,
+					begin,
+					time,
+					units::gps_position::from_milliminutes(static_cast<std::int32_t>(std::lround(lat)), static_cast<std::int32_t>(std::lround(lon))),
+					units::length::meter_t(radius),
+					units::length::meter_t(deviation),
+					turned < 0
+				});
+			}
+		}
+
+	public:
+
+		// A circling fix, its number and the angle the track turns there,
+		// positive to the left, as detection::detector_t tells its observer.
+		// A circle goes on only over consecutive fixes.
+		void push(std::size_t number, const units::gps_position& position, units::timestamp time, units::angle::degree_t turn) {
+			if(!following || number != last + 1) {
+				following = true;
+				restart(number, position, time);
+			} else {
+				add(position);
+				turned += turn.to<double>();
+				if(std::abs(turned) >= 360) {
+					close(number, time);
+					restart(number, position, time);
+				} else if(delta(begin, time) > max_duration) {
+					restart(number, position, time);
+				}
+			}
+			last = number;
+		}
+
+		// Every full turn so far, in order of time.
+		const std::vector<circle_t>& result() const {
+			return circles;
+		}
+
+	};
+
+	// The circles of one thermal.
+	struct summary_t {
+		std::size_t circles = 0;
+		std::size_t right = 0;
+		// Means over the circles.
+		units::length::meter_t radius{0};
+		units::length::meter_t deviation{0};
+		// From the drift of the centres, with two circles or more.
+		bool has_wind = false;
+		// Direction the wind blows from.
+		units::angle::degree_t wind_direction{0};
+		units::velocity::kilometers_per_hour_t wind_speed{0};
+	};
+
+	// Summary of the circles lying within fixes first to last.
+	inline summary_t summarize(const std::vector<circle_t>& circles, std::size_t first, std::size_t last) {
+		summary_t result;
+		auto it = std::lower_bound(circles.begin(), circles.end(), first, [](const circle_t& c, std::size_t f) {
+			return c.first < f;
+		});
+		auto end = it;
+		while(end != circles.end() && end->last <= last) ++end;
+		if(it == end) return result;
+
+		result.circles = end - it;
+		// Centres in meters from the first one, against seconds since it began.
+		const auto& origin = *it;
+		const double scale = std::cos(origin.centre.latitude_milliminutes() * radians_per_milliminute);
+		double st = 0, sx = 0, sy = 0, stt = 0, stx = 0, sty = 0;
+		for(auto c = it; c != end; ++c) {
+			result.right += c->right;
+			result.radius += c->radius;
+			result.deviation += c->deviation;
+
+			const double t = delta(origin.begin, c->begin) + delta(c->begin, c->end) / 2.0;
+			const double x = (c->centre.longitude_milliminutes() - origin.centre.longitude_milliminutes()) * radians_per_milliminute * earth_radius * scale;
+			const double y = (c->centre.latitude_milliminutes() - origin.centre.latitude_milliminutes()) * radians_per_milliminute * earth_radius;
+			st += t; sx += x; sy += y;
+			stt += t * t; stx += t * x; sty += t * y;
+		}
+		const double n = static_cast<double>(result.circles);
+		result.radius = result.radius / n;
+		result.deviation = result.deviation / n;
+
+		const double var = stt - st * st / n;
+		if(result.circles >= 2 && var > 0) {
+			// Velocity of the air in m/s, east and north.
+			const double vx = (stx - st * sx / n) / var;
+			const double vy = (sty - st * sy / n) / var;
+			result.has_wind = true;
+			result.wind_speed = units::velocity::meters_per_second_t(std::hypot(vx, vy));
+			double from = std::atan2(-vx, -vy) * 180 / M_PI;
+			if(from < 0) from += 360;
+			result.wind_direction = units::angle::degree_t(from);
+		}
+		return result;
+	}
+
+	// Last wind the logger recorded within begin to end, null if none.
+	inline const parser::wind_t* logged(const std::vector<parser::wind_t>& wind, units::timestamp begin, units::timestamp end) {
+		const parser::wind_t* result = nullptr;
+		for(const auto& w : wind) {
+			if(delta(begin, w.time) >= 0 && delta(w.time, end) >= 0) result = &w;
+		}
+		return result;
+	}
+
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+#include <units.h>
+#include <units/gps.hpp>
+
+#include "airports.hpp"
+#include "parallel.hpp"
+
+// Class membership of every fix of a flight, computed once. Whether a thermal
+// belongs to a class is then answered in O(1) from running counts.
+namespace classification {
+
+	enum : std::uint8_t {
+		// §4.1: within the cylinder around the start airport.
+		in_cylinder = 1,
+		// §4.2: within the glide cone of the start airport.
+		in_cone = 2
+	};
+
+	// Fixes per thread below which a per fix pass is not worth splitting.
+	constexpr std::size_t min_block = 4096;
+
+	// Distance of every fix to the airport. Depends on no rule, so analyses
+	// trying several radii or glide ratios share it.
+	template <class iterator_t>
+	std::pmr::vector<units::length::meter_t> distances(iterator_t begin, iterator_t end, const airport_t& ap, std::pmr::memory_resource* memory, unsigned int threads = 1) {
+		std::pmr::vector<units::length::meter_t> result(std::distance(begin, end), memory);
+		parallel::for_each_block(result.size(), threads, min_block, [&](std::size_t first, std::size_t last) {
+			auto it = std::next(begin, first);
+			for(std::size_t i = first; i < last; ++i, ++it) {
+				result[i] = units::distance(it->position, ap.position);
+			}
+		});
+		return result;
+	}
+
+	class classes_t {
+
+		std::pmr::vector<std::uint8_t> mask;
+		// Number of fixes outside the cylinder before each fix.
+		std::pmr::vector<std::uint32_t> outside_cylinder;
+
+	public:
+
+		// No fixes.
+		explicit classes_t(std::pmr::memory_resource* memory) :
+			mask(memory),
+			outside_cylinder(1, memory)
+		{}
+
+		template <class iterator_t>
+		classes_t(
+			iterator_t begin,
+			const std::pmr::vector<units::length::meter_t>& distance,
+			const airport_t& ap,
+			units::length::meter_t radius,
+			double glide_ratio,
+			std::pmr::memory_resource* memory,
+			unsigned int threads = 1
+		) :
+			mask(distance.size(), memory),
+			outside_cylinder(distance.size() + 1, memory)
+		{
+			const std::size_t n = distance.size();
+			const double r = radius.template to<double>();
+			const double elevation = ap.elevation.template to<double>();
+
+			std::pmr::vector<double> d(n, memory);
+			std::pmr::vector<double> height(n, memory);
+			parallel::for_each_block(n, threads, min_block, [&](std::size_t first, std::size_t last) {
+				auto it = std::next(begin, first);
+				for(std::size_t i = first; i < last; ++i, ++it) {
+					d[i] = distance[i].template to<double>();
+					height[i] = it->altitude.count() - elevation;
+				}
+
+				// Branch free, so the compiler can vectorize it.
+				for(std::size_t i = first; i < last; ++i) {
+					mask[i] =
+						(d[i] <= r) * in_cylinder |
+						(height[i] * glide_ratio > d[i]) * in_cone;
+				}
+			});
+
+			outside_cylinder[0] = 0;
+			for(std::size_t i = 0; i < n; ++i) {
+				outside_cylinder[i + 1] = outside_cylinder[i] + !(mask[i] & in_cylinder);
+			}
+		}
+
+		std::uint8_t operator[](std::size_t fix) const {
+			return mask[fix];
+		}
+
+		// §4.1: every fix from first to last, both included, lies within the cylinder.
+		bool local(std::size_t first, std::size_t last) const {
+			return outside_cylinder[last + 1] == outside_cylinder[first];
+		}
+
+		// §4.2: the thermal began outside the glide cone.
+		bool remote(std::size_t first) const {
+			return !(mask[first] & in_cone);
+		}
+
+	};
+
+	// Thermals of one class, as indices into the array of all thermals.
+	template <class thermal_it>
+	class view_t {
+
+		thermal_it base;
+		const std::uint32_t* first;
+		const std::uint32_t* last;
+
+	public:
+
+		class iterator {
+
+			thermal_it base;
+			const std::uint32_t* index;
+
+		public:
+
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = typename std::iterator_traits<thermal_it>::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = typename std::iterator_traits<thermal_it>::pointer;
+			using reference = typename std::iterator_traits<thermal_it>::reference;
+
+			iterator(thermal_it base, const std::uint32_t* index) :
+				base(base),
+				index(index)
+			{}
+
+			reference operator*() const { return base[*index]; }
+			pointer operator->() const { return &base[*index]; }
+			iterator& operator++() { ++index; return *this; }
+			iterator operator+(difference_type n) const { return iterator(base, index + n); }
+			difference_type operator-(const iterator& other) const { return index - other.index; }
+			bool operator==(const iterator& other) const { return index == other.index; }
+			bool operator!=(const iterator& other) const { return index != other.index; }
+
+		};
+
+		template <class index_container_t>
+		view_t(thermal_it base, const index_container_t& indices) :
+			base(base),
+			first(indices.data()),
+			last(indices.data() + indices.size())
+		{}
+
+		iterator begin() const { return iterator(base, first); }
+		iterator end() const { return iterator(base, last); }
+		std::size_t size() const { return last - first; }
+		bool empty() const { return first == last; }
+		auto& front() const { return base[*first]; }
+
+	};
+
+}
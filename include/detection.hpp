@@ -0,0 +1,299 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+#include <units.h>
+#include <units/fixed.hpp>
+#include <units/gps.hpp>
+
+#include "parallel.hpp"
+#include "thermal.hpp"
+
+namespace detection {
+
+	// Per fix intermediates of the detector, only kept when asked for.
+	struct trace_t {
+		units::angle::degree_t gps_track;
+		units::angular_velocity::degrees_per_second_t angularspeed;
+		units::angular_velocity::degrees_per_second_t floating_average_angularspeed;
+	};
+
+	inline units::angle::degree_t normalize(units::angle::degree_t a) {
+		a += units::angle::degree_t(360);
+		a = units::math::fmod(a, units::angle::degree_t(360));
+		if(a > units::angle::degree_t(180)) a -= units::angle::degree_t(360);
+		return a;
+	}
+
+	// Turn rate at a fix from the track arriving at it and the track leaving it.
+	inline units::angular_velocity::degrees_per_second_t turn_rate(units::angle::degree_t previous_track, units::angle::degree_t track, units::time::second_t dt) {
+		return normalize(previous_track - track) / dt;
+	}
+
+	// Observer of detector_t that is told nothing. An observer is given every
+	// fix the detector decides is circling, in order, with its number counted
+	// from the first fix of the track and the angle the track turns there,
+	// positive to the left and zero at the first fix.
+	struct no_observer_t {
+		void push(std::size_t, const units::gps_position&, units::timestamp, units::angle::degree_t) {}
+	};
+
+	// Streaming thermal detection. Fixes are pushed one by one, track, turn rate,
+	// the centered floating average over rules::window fixes and the thermal decisions
+	// are all made in the same step. Only the last window of turn rates is kept.
+	// Thermals are handed out once the following one is known not to be merged with them.
+	// An observer is given every circling fix in the step that decides it.
+	template <class rules, class iterator_t, class observer_t = no_observer_t>
+	class detector_t {
+
+		static constexpr std::size_t N = rules::window;
+
+		struct slot_t {
+			iterator_t fix;
+			units::angular_velocity::degrees_per_second_t angularspeed;
+			// For the observer.
+			units::angle::degree_t turn;
+		};
+
+		std::array<slot_t, N> window;
+		std::size_t count = 0;
+		units::angular_velocity::degrees_per_second_t rolling_sum{0};
+
+		std::optional<iterator_t> previous;
+		units::angle::degree_t previous_track;
+
+		std::optional<iterator_t> open;
+		std::optional<iterator_t> last_decided;
+		std::optional<thermal_t<iterator_t>> pending;
+
+		std::vector<trace_t>* trace;
+		observer_t* observer;
+
+	public:
+
+		explicit detector_t(std::vector<trace_t>* trace = nullptr, observer_t* observer = nullptr) :
+			trace(trace),
+			observer(observer)
+		{}
+
+		template <class inserter_t>
+		void push(iterator_t it, inserter_t& thermals) {
+			if(trace) trace->emplace_back();
+
+			if(!previous) {
+				previous = it;
+				return;
+			}
+
+			// Track of the previous fix is known now, and with it its turn rate.
+			const auto prev = *previous;
+			const auto track = units::forward_azimuth(prev->position, it->position);
+			units::angle::degree_t turn{0};
+			units::angular_velocity::degrees_per_second_t angularspeed{0};
+			if(count > 0) {
+				const auto& before = window[(count - 1) % N].fix;
+				// As turn_rate, keeping the angle for the observer.
+				turn = normalize(previous_track - track);
+				angularspeed = turn / (prev->time - before->time);
+			}
+			if(trace) {
+				(*trace)[count].gps_track = track;
+				(*trace)[count].angularspeed = angularspeed;
+			}
+
+			if(count >= N) {
+				rolling_sum = rolling_sum - window[count % N].angularspeed;
+			}
+			rolling_sum = rolling_sum + angularspeed;
+			window[count % N] = slot_t{ prev, angularspeed, turn };
+			++count;
+
+			previous = it;
+			previous_track = track;
+
+			if(count >= N) {
+				const auto& middle = window[(count - N + N / 2) % N].fix;
+				const auto average = rolling_sum / N;
+				if(trace) {
+					(*trace)[count - N + N / 2].floating_average_angularspeed = average;
+				}
+				if(decide(middle, average, thermals) && observer) tell(count - N + N / 2);
+			}
+		}
+
+		// Closes a thermal still open at the end of the track and hands out the last one.
+		template <class inserter_t>
+		void finish(inserter_t& thermals) {
+			if(observer && open) {
+				// Fixes no average reached belong to the thermal still open.
+				for(std::size_t number = count - N + N / 2 + 1; number < count; ++number) tell(number);
+			}
+			if(open && last_decided) {
+				close(std::next(*last_decided), thermals);
+			}
+			if(pending) {
+				thermals = std::move(*pending);
+				pending.reset();
+			}
+		}
+
+		// The state as it is after the last push, iterators written as
+		// number(iterator).
+		template <class archive_t, class number_t>
+		void save(archive_t& out, number_t number) const {
+			auto fix = [&](const std::optional<iterator_t>& it) {
+				out.put(it.has_value());
+				if(it) out.put(static_cast<std::uint64_t>(number(*it)));
+			};
+			out.put(static_cast<std::uint64_t>(count));
+			for(std::size_t i = 0; i < std::min(count, N); ++i) {
+				out.put(static_cast<std::uint64_t>(number(window[i].fix)));
+				out.put(window[i].angularspeed);
+			}
+			out.put(rolling_sum);
+			fix(previous);
+			out.put(previous_track);
+			fix(open);
+			fix(last_decided);
+			fix(pending ? std::optional<iterator_t>(pending->begin) : std::nullopt);
+			fix(pending ? std::optional<iterator_t>(pending->end) : std::nullopt);
+		}
+
+		// Continues from a saved detector, in place of one that has been given
+		// no fix. Iterators are made by iterator(number), the fixes they point
+		// to must be there already. Turns are not saved, a restored detector
+		// has no observer.
+		template <class archive_t, class iterator_of_t>
+		bool restore(archive_t& in, iterator_of_t iterator_of) {
+			auto fix = [&](std::optional<iterator_t>& it) {
+				bool present;
+				std::uint64_t number = 0;
+				if(!in.get(present) || (present && !in.get(number))) return false;
+				it.reset();
+				if(present) it = iterator_of(number);
+				return true;
+			};
+			std::uint64_t n;
+			if(!in.get(n)) return false;
+			count = n;
+			for(std::size_t i = 0; i < std::min(count, N); ++i) {
+				std::uint64_t number;
+				if(!in.get(number) || !in.get(window[i].angularspeed)) return false;
+				window[i].fix = iterator_of(number);
+			}
+			std::optional<iterator_t> begin, end;
+			if(!(in.get(rolling_sum) && fix(previous) && in.get(previous_track) && fix(open) && fix(last_decided) && fix(begin) && fix(end))) {
+				return false;
+			}
+			pending.reset();
+			if(begin && end) pending = thermal_t<iterator_t>(*begin, *end);
+			return true;
+		}
+
+		// Earliest fix the detector still refers to. Everything before it may be
+		// discarded by a caller that streams fixes through a bounded buffer.
+		std::optional<iterator_t> oldest() const {
+			std::optional<iterator_t> result = previous;
+			auto consider = [&](const iterator_t& it) {
+				if(!result || it < *result) result = it;
+			};
+			if(count > 0) consider(window[count < N ? 0 : count % N].fix);
+			if(open) consider(*open);
+			if(pending) consider(pending->begin);
+			return result;
+		}
+
+	private:
+
+		// Fix number, still in the window.
+		void tell(std::size_t number) {
+			const auto& slot = window[number % N];
+			observer->push(number, slot.fix->position, slot.fix->time, slot.turn);
+		}
+
+		// Whether fix is circling.
+		template <class inserter_t>
+		bool decide(iterator_t fix, units::angular_velocity::degrees_per_second_t average, inserter_t& thermals) {
+			last_decided = fix;
+			const bool circling = units::math::abs(average) >= rules::turn_rate;
+			if(circling && !open) {
+				open = fix;
+			} else if(!circling && open) {
+				close(fix, thermals);
+			}
+			return circling;
+		}
+
+		template <class inserter_t>
+		void close(iterator_t end, inserter_t& thermals) {
+			thermal_t<iterator_t> thermal(*open, end);
+			open.reset();
+			if(thermal.points <= 0) return;
+
+			if(pending && thermal.begin->time - pending->end->time <= rules::merge_gap) {
+				pending = thermal_t<iterator_t>(pending->begin, thermal.end);
+			} else {
+				if(pending) thermals = std::move(*pending);
+				pending = thermal;
+			}
+		}
+
+	};
+
+	// Turn rate of every fix as the detector computes it, zero at both ends of the
+	// track. For analyses that evaluate several windows on the same track. Blocks
+	// of fixes are computed on up to `threads` threads, each starting from the
+	// track arriving at its first fix.
+	template <class iterator_t>
+	std::vector<units::angular_velocity::degrees_per_second_t> turn_rates(iterator_t begin, iterator_t end, unsigned int threads = 1) {
+		constexpr std::size_t min_block = 4096;
+		std::vector<units::angular_velocity::degrees_per_second_t> result(std::distance(begin, end), units::angular_velocity::degrees_per_second_t(0));
+		if(result.size() < 3) return result;
+
+		// Fixes 1 to n-2 have a track on both sides.
+		parallel::for_each_block(result.size() - 2, threads, min_block, [&](std::size_t first, std::size_t last) {
+			auto previous = std::next(begin, first);
+			auto it = std::next(previous);
+			auto previous_track = units::forward_azimuth(previous->position, it->position);
+			for(std::size_t i = first + 1; i <= last; ++i, previous = it, ++it) {
+				const auto track = units::forward_azimuth(it->position, std::next(it)->position);
+				result[i] = turn_rate(previous_track, track, it->time - previous->time);
+				previous_track = track;
+			}
+		});
+		return result;
+	}
+
+	// Centered floating average over `window` turn rates, computed like detector_t does.
+	// Fixes without a complete window are zero.
+	inline std::vector<units::angular_velocity::degrees_per_second_t> floating_average(const std::vector<units::angular_velocity::degrees_per_second_t>& turn, std::size_t window) {
+		std::vector<units::angular_velocity::degrees_per_second_t> result(turn.size(), units::angular_velocity::degrees_per_second_t(0));
+		units::angular_velocity::degrees_per_second_t rolling_sum{0};
+		for(std::size_t m = 0; m + 1 < turn.size(); ++m) {
+			if(m >= window) {
+				rolling_sum = rolling_sum - turn[m - window];
+			}
+			rolling_sum = rolling_sum + turn[m];
+			if(m + 1 >= window) {
+				result[m + 1 - window + window / 2] = rolling_sum / window;
+			}
+		}
+		return result;
+	}
+
+	// Runs the detector over a whole track. Thermals are written to the inserter,
+	// the per fix intermediates to trace and every fix to observer if given.
+	template <class rules, class iterator_t, class inserter_t, class observer_t = no_observer_t>
+	void detect(iterator_t begin, iterator_t end, inserter_t thermals, std::vector<trace_t>* trace = nullptr, observer_t* observer = nullptr) {
+		detector_t<rules, iterator_t, observer_t> detector(trace, observer);
+		for(auto it = begin; it != end; ++it) {
+			detector.push(it, thermals);
+		}
+		detector.finish(thermals);
+	}
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "airports.hpp"
+#include "circling.hpp"
+#include "io/writer.hpp"
+#include "stream.hpp"
+
+// Result output. Every run reports the same events and each format writes them
+// its own way: text is the German prose for people, CSV, JSON Lines and binary
+// records are for tools. Nothing is flushed per line.
+//
+// CSV and JSON Lines give one row per event with the columns datei, art,
+// flugplatz, von, bis, tek_hoehe, steigen, punkte, lokal, ueberland. art is one
+// of start, bart, bester_bart_lokal, bester_bart_ueberland, summe_lokal,
+// summe_ueberland and platz_flug, platz_lokal, platz_ueberland for the best
+// thermals without overlap, in order of rank. Times are hh:mm:ss, heights m, climb rates m/s.
+// A value that is not finite is null in JSON Lines and an empty field in CSV.
+// JSON Lines adds art kreise with the circles of a thermal: kreise, rechts,
+// radius, abweichung in m, wind_richtung in degrees, wind_staerke in km/h and
+// the same as the logger recorded them, logger_wind_richtung and
+// logger_wind_staerke. CSV has no columns for them. Art duplikat stands for a
+// flight not scored again, wie names the earlier flight whose results apply and
+// aehnlichkeit gives the share of the track both have in common.
+//
+// Binary output starts with "THK\1", then one record per event, a tag byte and
+// a little endian payload. Strings are a u16 length and the bytes, times u32
+// seconds of day, values f64:
+//   'D' file    name
+//   'S' start   airport name
+//   'T' thermal begin, end, gain_te, average, points, u8 flags (1 local, 2 remote)
+//   'R' ranking u8 class (0 local, 1 remote), u8 flags (1 strongest, 2 sum),
+//               the strongest thermal's 'T' payload if present, then
+//               points, begin, end of the best sum if present
+//   'K' top k   u8 class (0 local, 1 remote, 2 flight), u16 count, then count
+//               'T' payloads in order of rank
+//   'C' circles begin, end, u16 circles, u16 right, radius, deviation, u8 flags
+//               (1 wind, 2 logger wind), direction and speed of each wind present
+//   'U' same    name of the earlier flight, similarity
+namespace emit {
+
+	enum class format_t : std::uint8_t {
+		text,
+		csv,
+		jsonl,
+		binary
+	};
+
+	// Reads "text", "csv", "jsonl" or "binary".
+	bool parse(std::string_view name, format_t& format);
+
+	enum class class_t : std::uint8_t {
+		local,
+		remote,
+		// All thermals of the flight, only for top.
+		flight
+	};
+
+	class emitter_t {
+	public:
+		virtual ~emitter_t() = default;
+		// Every flight begins with the file it came from. Text output names it
+		// only if announce is set, when a run reads more than one flight.
+		virtual void file(std::string_view name, bool announce) = 0;
+		virtual void start(const airport_t& airport) = 0;
+		virtual void thermal(const stream::record_t& r) = 0;
+		virtual void ranking(class_t c, const stream::ranking_t& ranking) = 0;
+		// The best thermals sharing no fix, best first.
+		virtual void top(class_t c, const std::vector<stream::record_t>& thermals) = 0;
+		// The circles of a thermal and the wind the logger recorded in it, if any.
+		virtual void circles(const stream::record_t& r, const circling::summary_t& s, const parser::wind_t* logged) = 0;
+		// The flight is one scored before, its results are those of original.
+		virtual void duplicate(std::string_view original, double similarity) = 0;
+	};
+
+	std::unique_ptr<emitter_t> make(format_t format, io::writer& out);
+
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "parser.hpp"
+
+// Fingerprints of flights, to find the same flight uploaded twice or logged by
+// both loggers of a two-seater (§4.1, §4.2). The track is cut into minutes, the
+// mean position and height of each minute is rounded to a grid and the cells
+// hashed. Two loggers in one glider hit mostly the same cells, other flights
+// hardly any. A MinHash sketch of the cells estimates the share two flights
+// have in common, an index of sketches finds similar flights without comparing
+// against each.
+namespace fingerprint {
+
+	// Values of a sketch. The estimate of a similarity is off by about
+	// sqrt(s (1 - s) / hashes).
+	constexpr std::size_t hashes = 64;
+
+	// Similarity from which two flights count as the same. Both loggers of one
+	// glider reach about 0.9, gliders flying together far less.
+	constexpr double same = 0.7;
+
+	struct sketch_t {
+		// Smallest value of each hash over all cells.
+		std::array<std::uint32_t, hashes> minima;
+		// Cells hashed, 0 for a flight without fixes.
+		std::size_t cells = 0;
+
+		sketch_t() {
+			minima.fill(std::numeric_limits<std::uint32_t>::max());
+		}
+
+		// Estimated share of cells two flights have in common, 0 to 1.
+		double similarity(const sketch_t& other) const {
+			if(cells == 0 || other.cells == 0) return 0;
+			std::size_t equal = 0;
+			for(std::size_t i = 0; i < hashes; ++i) equal += minima[i] == other.minima[i];
+			return static_cast<double>(equal) / hashes;
+		}
+	};
+
+	namespace detail {
+
+		inline std::uint64_t mix(std::uint64_t x) {
+			// splitmix64 finalizer.
+			x ^= x >> 30;
+			x *= 0xbf58476d1ce4e5b9ull;
+			x ^= x >> 27;
+			x *= 0x94d049bb133111ebull;
+			x ^= x >> 31;
+			return x;
+		}
+
+		// Odd multipliers and offsets of the hashes, h_i(x) = (a_i x + b_i) >> 32
+		// over the mixed cell.
+		struct family_t {
+			std::array<std::uint64_t, hashes> a, b;
+
+			family_t() {
+				std::uint64_t seed = 0x5448454b464e4731ull;
+				for(std::size_t i = 0; i < hashes; ++i) {
+					a[i] = mix(seed += 0x9e3779b97f4a7c15ull) | 1;
+					b[i] = mix(seed += 0x9e3779b97f4a7c15ull);
+				}
+			}
+		};
+
+		inline const family_t& family() {
+			static const family_t instance;
+			return instance;
+		}
+
+	}
+
+	// Builds the sketch of one flight fix by fix, in order of time.
+	class sketcher_t {
+
+		// Length of a minute and the grid: 100 milliminutes are 185 m of latitude.
+		static constexpr std::int32_t bucket = 60;
+		static constexpr std::int64_t cell = 100;
+		static constexpr std::int64_t height = 100;
+
+		sketch_t sketch;
+
+		// Minute being summed up. Positions are integrated over the time between
+		// the fixes, so a logger recording every four seconds gives the same
+		// mean as one recording every second.
+		std::int32_t minute = 0;
+		double lat = 0, lon = 0, alt = 0;
+		double seconds = 0;
+		// Previous fix, heights count from the first one: loggers set to another
+		// pressure still agree on them.
+		bool started = false;
+		std::int32_t time = 0;
+		double last_lat = 0, last_lon = 0, last_alt = 0;
+		std::int32_t ground = 0;
+
+		void hash(std::uint64_t token) {
+			const auto& f = detail::family();
+			const std::uint64_t x = detail::mix(token);
+			for(std::size_t i = 0; i < hashes; ++i) {
+				const auto h = static_cast<std::uint32_t>((f.a[i] * x + f.b[i]) >> 32);
+				sketch.minima[i] = std::min(sketch.minima[i], h);
+			}
+			++sketch.cells;
+		}
+
+		void flush() {
+			if(!(seconds > 0)) return;
+			// Mean of the minute on two grids half a cell apart, a fix near the
+			// border of a cell in one is near the middle of one in the other.
+			for(std::int64_t g = 0; g < 2; ++g) {
+				const double shift = g * 0.5;
+				const auto y = static_cast<std::int64_t>(std::floor(lat / seconds / cell + shift));
+				const auto x = static_cast<std::int64_t>(std::floor(lon / seconds / cell + shift));
+				const auto z = static_cast<std::int64_t>(std::floor(alt / seconds / height + shift));
+				std::uint64_t token = static_cast<std::uint32_t>(minute);
+				token = detail::mix(token ^ static_cast<std::uint64_t>(g) << 32);
+				token = detail::mix(token ^ static_cast<std::uint64_t>(y));
+				token = detail::mix(token ^ static_cast<std::uint64_t>(x));
+				hash(token ^ static_cast<std::uint64_t>(z));
+			}
+			lat = lon = alt = seconds = 0;
+		}
+
+	public:
+
+		void push(const parser::fix_t& fix) {
+			const double fix_lat = fix.position.latitude_milliminutes();
+			const double fix_lon = fix.position.longitude_milliminutes();
+			const std::int32_t t = fix.time.count();
+			if(!started) {
+				ground = fix.altitude.count();
+				started = true;
+				minute = t / bucket;
+			} else if(t > time) {
+				const double fix_alt = fix.altitude.count() - ground;
+				// The straight line from the previous fix, cut at every full minute.
+				for(std::int32_t from = time; from < t;) {
+					const std::int32_t m = from / bucket;
+					if(m != minute) {
+						flush();
+						minute = m;
+					}
+					const std::int32_t to = std::min(t, (m + 1) * bucket);
+					const double w = to - from;
+					const double mid = ((from + to) / 2.0 - time) / (t - time);
+					lat += w * (last_lat + mid * (fix_lat - last_lat));
+					lon += w * (last_lon + mid * (fix_lon - last_lon));
+					alt += w * (last_alt + mid * (fix_alt - last_alt));
+					seconds += w;
+					from = to;
+				}
+			} else if(t < time) {
+				// Past midnight or out of order, start over from this fix.
+				flush();
+				minute = t / bucket;
+			}
+			time = t;
+			last_lat = fix_lat;
+			last_lon = fix_lon;
+			last_alt = fix.altitude.count() - ground;
+		}
+
+		// Sketch of the fixes so far.
+		sketch_t result() {
+			flush();
+			return sketch;
+		}
+
+	};
+
+	template <class iterator_t>
+	sketch_t sketch(iterator_t begin, iterator_t end) {
+		sketcher_t sketcher;
+		for(auto it = begin; it != end; ++it) sketcher.push(*it);
+		return sketcher.result();
+	}
+
+	// Flights seen before, by name. Sketches are split into bands of rows
+	// values, flights sharing a band are compared. At a similarity of 0.7 two
+	// flights share one with a chance of 99 %, at 0.3 with one of 12 %. Lookups
+	// keep state, an index is used by one thread at a time.
+	class index_t {
+
+		static constexpr std::size_t rows = 4;
+		static constexpr std::size_t bands = hashes / rows;
+
+		std::vector<std::string> names;
+		std::vector<sketch_t> sketches;
+		std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> buckets;
+		// Flight last compared in a lookup, so each is compared once.
+		mutable std::vector<std::uint32_t> seen;
+		mutable std::uint32_t lookups = 0;
+
+		static std::uint64_t key(const sketch_t& s, std::size_t band);
+
+	public:
+
+		struct match_t {
+			const std::string* name = nullptr;
+			double similarity = 0;
+		};
+
+		std::size_t size() const {
+			return names.size();
+		}
+
+		void add(std::string name, const sketch_t& sketch);
+
+		// Most similar flight of at least the given similarity, name is null if
+		// there is none.
+		match_t find(const sketch_t& sketch, double threshold) const;
+
+		// Reads an index written by save, false if the file is missing or no
+		// index. The index is left empty then.
+		bool load(const std::string& path);
+		bool save(const std::string& path) const;
+
+	};
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace io {
+
+// Reads many whole files with many reads in flight, through io_uring where the
+// kernel offers it and through a pool of threads doing pread otherwise. Files
+// are handed over in the order they were requested, each in a buffer that is
+// reused for a later file once the callback returned.
+class bulk_reader {
+
+public:
+
+	enum class backend_t : std::uint8_t {
+		automatic,
+		io_uring,
+		threads
+	};
+
+	// Called on the reading thread once per path. ok is false if the file could
+	// not be read, data is then empty.
+	using callback_t = std::function<void(std::size_t index, std::string_view data, bool ok)>;
+
+private:
+
+	struct ring_t;
+
+	struct buffer_t {
+		std::unique_ptr<char[]> data;
+		std::size_t capacity = 0;
+	};
+
+	// State of a file between open and hand over.
+	struct slot_t {
+		int fd = -1;
+		std::size_t size = 0;
+		std::size_t done = 0;
+		buffer_t buffer;
+		bool ok = false;
+		bool complete = false;
+	};
+
+	std::size_t depth;
+	std::unique_ptr<ring_t> ring;
+	std::vector<buffer_t> pool;
+
+	buffer_t acquire(std::size_t size);
+	void release(buffer_t buffer);
+	// Opens path into slot, false if there is nothing to read. Never marks
+	// the slot complete, the caller does once the slot is visible to others.
+	bool open(slot_t& slot, const std::string& path);
+	void hand_over(std::size_t index, slot_t& slot, const callback_t& f);
+
+	void read_ring(const std::vector<std::string>& paths, const callback_t& f);
+	void read_threads(const std::vector<std::string>& paths, const callback_t& f);
+
+public:
+
+	explicit bulk_reader(std::size_t depth = 32, backend_t backend = backend_t::automatic);
+	bulk_reader(const bulk_reader&) = delete;
+	bulk_reader& operator=(const bulk_reader&) = delete;
+	~bulk_reader();
+
+	// io_uring or threads, the backend actually used.
+	backend_t backend() const;
+
+	void read(const std::vector<std::string>& paths, const callback_t& f);
+
+};
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+
+#include "io/decompressor.hpp"
+
+namespace io {
+
+// Called with the name and the contents of every flight in a bundle.
+using entry_callback_t = std::function<void(const std::string& name, std::istream& input)>;
+
+// Streams every .igc file of a tar or zip bundle to f, in bundle order. A tar
+// bundle may itself be compressed, it is then decompressed on the fly. Entries
+// are streamed, no flight is ever unpacked as a whole. Returns false if the
+// bundle is damaged or an entry uses a feature that is not supported, the
+// entries before it have been handed over.
+bool for_each_entry(std::string_view data, format_t format, const entry_callback_t& f);
+
+}
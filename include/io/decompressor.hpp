@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <streambuf>
+#include <string_view>
+
+namespace io {
+
+enum class compression_t : std::uint8_t {
+	none,
+	gzip,
+	zstd,
+	// Raw deflate, as stored in zip bundles.
+	deflate
+};
+
+// Bundles of many flights.
+enum class container_t : std::uint8_t {
+	none,
+	tar,
+	zip
+};
+
+struct format_t {
+	compression_t compression = compression_t::none;
+	container_t container = container_t::none;
+};
+
+// Recognizes compression and bundles by their magic bytes. A compressed tar
+// bundle is told from a compressed IGC file by decompressing its first block.
+format_t detect(std::string_view data);
+
+// Whether this build can decompress it, zstd is optional.
+bool supported(compression_t compression);
+
+// Decompresses data held in memory, for example an io::mapped_file, into a
+// fixed buffer that is refilled whenever the reader has consumed it. The
+// decompressed file never exists as a whole. Uncompressed data is read in place.
+class decompressor : public std::streambuf {
+
+	struct state_t;
+
+	std::unique_ptr<state_t> state;
+	std::unique_ptr<char[]> buffer;
+	std::size_t capacity;
+	bool damaged = false;
+
+protected:
+
+	int_type underflow() override;
+
+public:
+
+	explicit decompressor(std::string_view data, compression_t compression, std::size_t capacity = 256 * 1024);
+	decompressor(const decompressor&) = delete;
+	decompressor& operator=(const decompressor&) = delete;
+	~decompressor() override;
+
+	// True if the data ended early or is corrupt. What was decompressed up to
+	// there has been read normally.
+	bool failed() const {
+		return damaged;
+	}
+
+};
+
+}
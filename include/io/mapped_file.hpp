@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace io {
+
+// Read only memory mapping of a whole file. A file that can not be opened
+// yields an empty, closed mapping instead of throwing.
+class mapped_file {
+
+	const char* data = nullptr;
+	std::size_t size = 0;
+	bool open = false;
+
+public:
+
+	mapped_file() = default;
+	explicit mapped_file(const std::string& path);
+	mapped_file(const mapped_file&) = delete;
+	mapped_file(mapped_file&& other) noexcept;
+	mapped_file& operator=(const mapped_file&) = delete;
+	mapped_file& operator=(mapped_file&& other) noexcept;
+	~mapped_file();
+
+	explicit operator bool() const {
+		return open;
+	}
+
+	std::string_view view() const {
+		return std::string_view(data, size);
+	}
+
+};
+
+}
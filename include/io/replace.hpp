@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Files the program writes for itself, the airfield cache, the fingerprint
+// index and snapshots. Each starts with six letters naming its kind, a zero,
+// the version of its layout and 0x01020304 in native byte order, so a file
+// from another version or machine is told apart and built anew.
+namespace io {
+
+	enum class header_t {
+		valid,
+		// Not of the kind asked for.
+		foreign,
+		// Of the kind, but another version or byte order.
+		outdated
+	};
+
+	constexpr std::size_t header_size = 12;
+
+	// The header of a file of the given kind, six letters.
+	std::string header(std::string_view kind, std::uint8_t version);
+
+	// Checks the header of bytes and removes it if valid.
+	header_t check_header(std::string_view& bytes, std::string_view kind, std::uint8_t version);
+
+	// Writes bytes to a file beside path and renames it over path. A reader
+	// never sees half a file and a run stopped halfway keeps the old one.
+	bool replace(const std::string& path, std::string_view bytes);
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace io {
+
+// Accepts line streams on the loopback interface, over TCP connections and UDP
+// datagrams on the same port, and multiplexes them with epoll on one thread.
+// Every TCP connection and every UDP sender is a stream of its own. UDP has no
+// end of a stream, a sender quiet for longer than the idle time is closed and
+// a stream of its own again once it sends anew. A port that can not be bound
+// yields a closed server instead of throwing.
+class server {
+
+public:
+
+	// Receives the bytes of all streams. Data arrives in arbitrary pieces, lines
+	// may be split across calls.
+	class handler {
+	public:
+		virtual ~handler() = default;
+		virtual void opened(std::uint64_t stream) = 0;
+		virtual void received(std::uint64_t stream, std::string_view data) = 0;
+		virtual void closed(std::uint64_t stream) = 0;
+	};
+
+private:
+
+	int epoll = -1;
+	int tcp = -1;
+	int udp = -1;
+	// Open TCP connections and UDP senders.
+	std::unordered_set<std::uint64_t> streams;
+	// Last datagram of each UDP sender.
+	std::unordered_map<std::uint64_t, std::chrono::steady_clock::time_point> heard;
+	std::chrono::steady_clock::duration idle;
+	std::chrono::steady_clock::time_point expired = std::chrono::steady_clock::now();
+	std::array<char, 64 * 1024> buffer;
+
+	void accept(handler& h);
+	void read(int fd, handler& h);
+	void receive(handler& h);
+	// Closes the UDP senders quiet for longer than idle.
+	void expire(handler& h);
+
+public:
+
+	explicit server(std::uint16_t port, std::chrono::steady_clock::duration idle = std::chrono::seconds(60));
+	server(const server&) = delete;
+	server& operator=(const server&) = delete;
+	~server();
+
+	explicit operator bool() const {
+		return epoll >= 0;
+	}
+
+	// Serves until stop is set, then closes every stream.
+	void run(handler& h, const std::atomic<bool>& stop);
+
+};
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace io {
+
+// Buffered output to a file descriptor. Output is collected in a fixed buffer
+// and written when the buffer is full or on flush(), never per line. Numbers
+// are formatted with std::to_chars, independent of any locale.
+class writer {
+
+	int fd;
+	std::unique_ptr<char[]> buffer;
+	std::size_t capacity;
+	std::size_t used = 0;
+	bool broken = false;
+
+	char* reserve(std::size_t n);
+
+public:
+
+	explicit writer(int fd = 1, std::size_t capacity = 64 * 1024);
+	writer(const writer&) = delete;
+	writer& operator=(const writer&) = delete;
+	~writer();
+
+	writer& write(std::string_view text);
+	writer& put(char c);
+	writer& number(std::int64_t value);
+	// Shortest text that reads back as the same double.
+	writer& number(double value);
+	// General format with the given significant digits, as std::ostream prints.
+	writer& number(double value, int precision);
+	// Raw bytes, for binary records.
+	writer& bytes(const void* data, std::size_t size);
+
+	void flush();
+
+	// True once a write to the descriptor failed.
+	bool failed() const {
+		return broken;
+	}
+
+};
+
+}
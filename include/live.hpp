@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+#include "airports.hpp"
+#include "io/server.hpp"
+#include "parser.hpp"
+#include "stream.hpp"
+
+// Live scores for a whole field of gliders, each sending its fixes as a line
+// stream of IGC B records or NMEA GGA sentences. Memory for a glider is taken
+// when its stream opens, lines are then scored in place without allocating.
+namespace live {
+
+	struct stats_t {
+		std::size_t gliders = 0;
+		std::size_t peak_gliders = 0;
+		std::size_t lines = 0;
+		std::size_t records = 0;
+		std::size_t skipped = 0;
+		std::size_t thermals = 0;
+		// Lines longer than any IGC or NMEA line, dropped unread.
+		std::size_t overlong = 0;
+	};
+
+	// Scores every stream of an io::server. on_thermal(glider, record, state) is
+	// called with every finished thermal and the glider's rankings including it,
+	// on_closed(glider, result) once its stream ends. Gliders are numbered from
+	// one in the order their streams opened. A UDP stream ends when the server
+	// finds it idle, its memory is freed then like that of a closed connection.
+	template <class rules, class value_type, class thermal_function_t, class closed_function_t>
+	class registry_t : public io::server::handler {
+
+		static constexpr std::size_t max_line = 256;
+
+		struct glider_t;
+
+		struct reporter_t {
+			registry_t* registry;
+			glider_t* glider;
+			void start(const airport_t&) {}
+			void thermal(const stream::record_t& r) {
+				++registry->counters.thermals;
+				registry->on_thermal(glider->number, r, glider->scorer.state());
+			}
+		};
+
+		struct glider_t {
+			std::size_t number;
+			// Start of a line split across reads.
+			std::array<char, max_line> pending;
+			std::size_t length = 0;
+			bool overlong = false;
+			stream::scorer_t<rules, value_type, reporter_t> scorer;
+
+			glider_t(registry_t* registry, std::size_t number) :
+				number(number),
+				scorer(parser::policy_t::skip, reporter_t{ registry, this })
+			{}
+		};
+
+		thermal_function_t on_thermal;
+		closed_function_t on_closed;
+		std::unordered_map<std::uint64_t, std::unique_ptr<glider_t>> gliders;
+		std::size_t opened_streams = 0;
+		stats_t counters;
+
+		void line(glider_t& g, std::string_view line) {
+			++counters.lines;
+			g.scorer.line(line);
+		}
+
+	public:
+
+		registry_t(thermal_function_t on_thermal, closed_function_t on_closed) :
+			on_thermal(std::move(on_thermal)),
+			on_closed(std::move(on_closed))
+		{}
+
+		void opened(std::uint64_t stream) override {
+			gliders.emplace(stream, std::make_unique<glider_t>(this, ++opened_streams));
+			++counters.gliders;
+			counters.peak_gliders = std::max(counters.peak_gliders, counters.gliders);
+		}
+
+		void received(std::uint64_t stream, std::string_view data) override {
+			auto it = gliders.find(stream);
+			if(it == gliders.end()) return;
+			auto& g = *it->second;
+
+			while(!data.empty() && !g.scorer.done()) {
+				const auto end = data.find('\n');
+				const auto piece = data.substr(0, end);
+				data.remove_prefix(end == std::string_view::npos ? data.size() : end + 1);
+
+				// Whole lines are scored straight from the receive buffer.
+				if(end != std::string_view::npos && g.length == 0 && !g.overlong) {
+					line(g, piece);
+					continue;
+				}
+
+				if(g.length + piece.size() > g.pending.size()) {
+					g.overlong = true;
+				} else {
+					std::memcpy(g.pending.data() + g.length, piece.data(), piece.size());
+					g.length += piece.size();
+				}
+				if(end == std::string_view::npos) break;
+
+				if(g.overlong) {
+					++counters.overlong;
+				} else {
+					line(g, std::string_view(g.pending.data(), g.length));
+				}
+				g.length = 0;
+				g.overlong = false;
+			}
+		}
+
+		void closed(std::uint64_t stream) override {
+			auto it = gliders.find(stream);
+			if(it == gliders.end()) return;
+			auto& g = *it->second;
+
+			if(g.length > 0 && !g.overlong && !g.scorer.done()) {
+				line(g, std::string_view(g.pending.data(), g.length));
+			}
+			const auto result = g.scorer.finish();
+			counters.records += result.parse.records;
+			counters.skipped += result.parse.skipped;
+			on_closed(g.number, result);
+
+			gliders.erase(it);
+			--counters.gliders;
+		}
+
+		const stats_t& stats() const {
+			return counters;
+		}
+
+	};
+
+	template <class rules, class value_type, class thermal_function_t, class closed_function_t>
+	registry_t<rules, value_type, thermal_function_t, closed_function_t> registry(thermal_function_t on_thermal, closed_function_t on_closed) {
+		return registry_t<rules, value_type, thermal_function_t, closed_function_t>(std::move(on_thermal), std::move(on_closed));
+	}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Passes over one flight spread across threads. Every call writes only to its
+// own slots of preallocated results, so the outcome does not depend on the
+// number of threads or on their timing. Nothing here may allocate from an
+// arena_t, which is not thread safe.
+namespace parallel {
+
+	// Runs f(0) ... f(n-1) on n threads, f(0) on the calling one.
+	template <class function_t>
+	void run(std::size_t n, function_t f) {
+		std::vector<std::thread> workers;
+		for(std::size_t i = 1; i < n; ++i) {
+			workers.emplace_back(f, i);
+		}
+		f(0);
+		for(auto& w : workers) {
+			w.join();
+		}
+	}
+
+	// Calls f(i) for every i below n on up to `threads` threads. Indices are
+	// handed out one at a time in ascending order, so put the most expensive
+	// first and a few of them do not hold up the rest. f(worker, i) is also
+	// told which of the min(threads, n) workers runs it, for scratch space of
+	// its own.
+	template <class function_t>
+	void for_each_index(std::size_t n, unsigned int threads, function_t f) {
+		auto call = [&](std::size_t worker, std::size_t i) {
+			if constexpr(std::is_invocable_v<function_t&, std::size_t, std::size_t>) {
+				f(worker, i);
+			} else {
+				f(i);
+			}
+		};
+		const std::size_t t = std::min<std::size_t>(threads, n);
+		if(t <= 1) {
+			for(std::size_t i = 0; i < n; ++i) call(0, i);
+			return;
+		}
+		std::atomic<std::size_t> next{0};
+		run(t, [&](std::size_t worker) {
+			for(std::size_t i = next++; i < n; i = next++) call(worker, i);
+		});
+	}
+
+	// Calls f(first, last) for consecutive blocks covering [0, n), one per
+	// thread, none smaller than min_block. For cheap per fix passes.
+	template <class function_t>
+	void for_each_block(std::size_t n, unsigned int threads, std::size_t min_block, function_t f) {
+		const std::size_t t = std::max<std::size_t>(1, std::min<std::size_t>(threads, n / std::max<std::size_t>(min_block, 1)));
+		run(t, [&](std::size_t i) {
+			f(n * i / t, n * (i + 1) / t);
+		});
+	}
+
+}
@@ -1,73 +1,905 @@
 #pragma once
 
 #include <istream>
-#include <map>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 #include <units.h>
 #include <units/gps.hpp>
+#include <units/fixed.hpp>
+
+#include "parallel.hpp"
 
 namespace parser {
 
-	template <class inserter_t>
-	void parse(std::istream& input, inserter_t inserter) {
-		std::string line;
-		std::map<std::string, std::pair<std::uint8_t, std::uint8_t>> position;
+	enum class error_t : std::uint8_t {
+		none,
+		truncated,
+		invalid_digit,
+		invalid_direction,
+		invalid_extension,
+		invalid_checksum
+	};
 
-		position["hour"] = std::make_pair(1, 2);
-		position["minute"] = std::make_pair(3, 2);
-		position["second"] = std::make_pair(5, 2);
-		position["latitude"] = std::make_pair(7, 8);
-		position["longitude"] = std::make_pair(15, 9);
-		position["altitude"] = std::make_pair(25, 5);
+	// What to do with a B record that can not be decoded.
+	enum class policy_t : std::uint8_t {
+		abort,
+		skip
+	};
 
-		using value_type = typename inserter_t::container_type::value_type;
+	inline const char* describe(error_t error) {
+		switch(error) {
+			case error_t::none: return "kein Fehler";
+			case error_t::truncated: return "Datensatz zu kurz";
+			case error_t::invalid_digit: return "ungültige Ziffer";
+			case error_t::invalid_direction: return "ungültige Himmelsrichtung";
+			case error_t::invalid_extension: return "ungültiger I-Datensatz";
+			case error_t::invalid_checksum: return "ungültige Prüfsumme";
+		}
+		return "";
+	}
 
-		std::vector<std::map<std::string, std::string>> values;
-		while( std::getline(input, line) ) {
+	// Position of a decoding error. Line and column are one based, as in the IGC specification.
+	struct diagnostic_t {
+		std::size_t line = 0;
+		std::size_t column = 0;
+		error_t error = error_t::none;
 
-			if(line[0] == 'I') {
-				for(unsigned int i=3; i + 7 < line.size(); i += 7) {
-					auto param = line.substr(i, 7);
-					std::uint8_t begin = std::stoi( param.substr(0, 2) );
-					std::uint8_t end = std::stoi( param.substr(2, 2) );
+		explicit operator bool() const {
+			return error != error_t::none;
+		}
+	};
+
+	// Wind as the logger estimated it, from a K record.
+	struct wind_t {
+		units::timestamp time;
+		// Direction the wind blows from.
+		units::angle::degree_t direction;
+		units::velocity::kilometers_per_hour_t speed;
+	};
+
+	struct result_t {
+		// First error that stopped reading the file, none if the whole file was read.
+		error_t error = error_t::none;
+		std::size_t records = 0;
+		std::size_t skipped = 0;
+		std::vector<std::string> missing;
+		std::vector<diagnostic_t> diagnostics;
+		// K records with the WDI and WVE fields, if the J record declares both.
+		std::vector<wind_t> wind;
+	};
+
+	// Fixed width decimal column. The validity of all characters is folded into
+	// one flag, so well formed records never branch per digit.
+	inline bool digits(std::string_view raw, int& value) {
+		bool valid = !raw.empty();
+		int result = 0;
+		for(char c : raw) {
+			unsigned int digit = static_cast<unsigned char>(c) - '0';
+			valid &= digit < 10;
+			result = result * 10 + static_cast<int>(digit);
+		}
+		value = result;
+		return valid;
+	}
+
+	// Fixed width decimal column of a signed value, a minus only in its first
+	// character.
+	inline bool signed_digits(std::string_view raw, int& value) {
+		const bool negative = !raw.empty() && raw.front() == '-';
+		raw.remove_prefix(negative);
+		const bool valid = digits(raw, value);
+		if(negative) value = -value;
+		return valid;
+	}
+
+	// Only called once a column failed, finds the offending character.
+	inline std::size_t first_invalid(std::string_view raw, bool sign) {
+		for(std::size_t i = 0; i < raw.size(); ++i) {
+			if((raw[i] < '0' || raw[i] > '9') && !(sign && i == 0 && raw[i] == '-')) return i;
+		}
+		return 0;
+	}
+
+	// Values of the fixed columns of a B record.
+	struct fixed_columns_t {
+		int hour, minute, second;
+		int lat_deg, lat_min;
+		int lon_deg, lon_min;
+		int altitude;
+	};
+
+	// The fixed columns one digit at a time. Accepts a minus only in the first
+	// column of the altitude.
+	inline bool decode_fixed(std::string_view line, fixed_columns_t& c) {
+		return
+			digits(line.substr(1, 2), c.hour) &
+			digits(line.substr(3, 2), c.minute) &
+			digits(line.substr(5, 2), c.second) &
+			digits(line.substr(7, 2), c.lat_deg) &
+			digits(line.substr(9, 5), c.lat_min) &
+			digits(line.substr(15, 3), c.lon_deg) &
+			digits(line.substr(18, 5), c.lon_min) &
+			signed_digits(line.substr(25, 5), c.altitude);
+	}
+
+	// Eight characters at a time in a 64 bit word, the first one in the lowest
+	// byte. Only little endian targets load them that way, on others enabled is
+	// false and the fixed columns are decoded digit by digit.
+	namespace swar {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		constexpr bool enabled = true;
+#else
+		constexpr bool enabled = false;
+#endif
+
+		inline std::uint64_t load(const char* p) {
+			std::uint64_t x;
+			std::memcpy(&x, p, sizeof(x));
+			return x;
+		}
 
-					auto code = param.substr(4, 3);
+		// Every byte is '0' to '9': the high nibble is 3 before and after adding 6.
+		inline bool digits(std::uint64_t x) {
+			constexpr std::uint64_t high = 0xF0F0F0F0F0F0F0F0;
+			return ((x & high) | (((x + 0x0606060606060606) & high) >> 4)) == 0x3333333333333333;
+		}
+
+		// Values of the digit pairs, in bytes 0, 2, 4 and 6.
+		inline std::uint64_t pairs(std::uint64_t x) {
+			x -= 0x3030303030303030;
+			return (x * 10 + (x >> 8)) & 0x00FF00FF00FF00FF;
+		}
+
+		// Value of eight digits.
+		inline std::uint32_t value(std::uint64_t x) {
+			x = pairs(x);
+			x = (x * 100 + (x >> 16)) & 0x0000FFFF0000FFFF;
+			return static_cast<std::uint32_t>(x * 10000 + (x >> 32));
+		}
+
+		// The fixed columns in four loads, false if any is not plain digits. The
+		// caller then falls back to decode_fixed, which also handles negative
+		// altitudes. line must hold at least 33 characters.
+		inline bool decode_fixed(std::string_view line, fixed_columns_t& c) {
+			const char* p = line.data();
+			// HHMMSSDD, the last two being the latitude degrees.
+			const std::uint64_t time = load(p + 1);
+			// DDMMmmmN shifted to 0DDMMmmm.
+			const std::uint64_t lat = load(p + 7) << 8 | 0x30;
+			// DDDMMmmm.
+			const std::uint64_t lon = load(p + 15);
+			// PPPPPGGG shifted to 000PPPPP.
+			const std::uint64_t alt = load(p + 25) << 24 | 0x303030;
+			if(!(digits(time) & digits(lat) & digits(lon) & digits(alt))) {
+				return false;
+			}
+
+			const std::uint64_t t = pairs(time);
+			c.hour = static_cast<int>(t & 0xFF);
+			c.minute = static_cast<int>(t >> 16 & 0xFF);
+			c.second = static_cast<int>(t >> 32 & 0xFF);
+			const std::uint32_t la = value(lat);
+			c.lat_deg = static_cast<int>(la / 100000);
+			c.lat_min = static_cast<int>(la % 100000);
+			const std::uint32_t lo = value(lon);
+			c.lon_deg = static_cast<int>(lo / 100000);
+			c.lon_min = static_cast<int>(lo % 100000);
+			c.altitude = static_cast<int>(value(alt));
+			return true;
+		}
+
+	}
+
+	// Zero based column of a B record. A size of zero marks a field the logger did not declare.
+	struct column_t {
+		std::uint8_t begin = 0;
+		std::uint8_t size = 0;
+		// Signed values may start with a minus.
+		bool sign = false;
+	};
+
+	// Fixed part of every B record, always decoded.
+	struct fix_t {
+		units::timestamp time;
+		units::gps_position position;
+		units::altitude altitude;
+	};
 
-					position[code] = std::make_pair(begin - 1, end - begin + 1);
+	// Optional I record extensions. Each field carries its three letter code,
+	// whether its value may be negative, its storage and the conversion from
+	// the raw column.
+	namespace field {
+
+		struct fix_accuracy {
+			static constexpr char code[] = "FXA";
+			static constexpr bool sign = false;
+			units::length::meter_t fix_accuracy;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = digits(raw, v);
+				fix_accuracy = units::length::meter_t(v);
+				return valid;
+			}
+		};
+
+		struct true_air_speed {
+			static constexpr char code[] = "TAS";
+			static constexpr bool sign = false;
+			units::velocity::kilometers_per_hour_t true_air_speed;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = digits(raw, v);
+				true_air_speed = units::velocity::kilometers_per_hour_t(v / 100.0);
+				return valid;
+			}
+		};
+
+		struct ground_speed {
+			static constexpr char code[] = "GSP";
+			static constexpr bool sign = false;
+			units::velocity::kilometers_per_hour_t ground_speed;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = digits(raw, v);
+				ground_speed = units::velocity::kilometers_per_hour_t(v / 100.0);
+				return valid;
+			}
+		};
+
+		struct total_energy_vario {
+			static constexpr char code[] = "VAT";
+			static constexpr bool sign = true;
+			units::velocity::meters_per_second_t total_energy_vario;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = signed_digits(raw, v);
+				total_energy_vario = units::velocity::meters_per_second_t(v / 100.0);
+				return valid;
+			}
+		};
+
+		struct true_heading {
+			static constexpr char code[] = "HDT";
+			static constexpr bool sign = false;
+			units::angle::degree_t true_heading;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = digits(raw, v);
+				true_heading = units::angle::degree_t(v);
+				return valid;
+			}
+		};
+
+		struct true_track {
+			static constexpr char code[] = "TRT";
+			static constexpr bool sign = false;
+			units::angle::degree_t true_track;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = digits(raw, v);
+				true_track = units::angle::degree_t(v);
+				return valid;
+			}
+		};
+
+		struct oat {
+			static constexpr char code[] = "OAT";
+			static constexpr bool sign = true;
+			units::temperature::celsius_t oat;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = signed_digits(raw, v);
+				oat = units::temperature::celsius_t(v / 10.0);
+				return valid;
+			}
+		};
+
+		struct gload {
+			static constexpr char code[] = "ACZ";
+			static constexpr bool sign = true;
+			units::acceleration::standard_gravity_t gload;
+			bool decode(std::string_view raw) {
+				int v;
+				bool valid = signed_digits(raw, v);
+				gload = units::acceleration::standard_gravity_t(v / 100.0);
+				return valid;
+			}
+		};
+
+	}
+
+	// Column layout of the requested extension fields, read from the I record.
+	template <class... fields>
+	class layout_t {
+
+		std::array<column_t, sizeof...(fields)> columns;
+
+		// Time, position, validity flag, pressure and GNSS altitude.
+		static constexpr std::size_t fixed_size = 35;
+
+		// Shortest B record holding every requested column.
+		std::size_t required = fixed_size;
+
+	public:
+
+		diagnostic_t declare(std::string_view line) {
+			for(std::size_t i=3; i + 7 <= line.size(); i += 7) {
+				int begin, end;
+				if(!digits(line.substr(i, 2), begin) || !digits(line.substr(i + 2, 2), end) || begin < 1 || end < begin) {
+					return diagnostic_t{ 0, i + 1, error_t::invalid_extension };
 				}
+				auto code = line.substr(i + 4, 3);
+
+				std::size_t index = 0;
+				((
+					code == fields::code ? void(columns[index] = column_t{ std::uint8_t(begin - 1), std::uint8_t(end - begin + 1), fields::sign }) : void(),
+					++index
+				), ...);
+				if(code_requested(code)) {
+					required = std::max<std::size_t>(required, end);
+				}
+			}
+			return diagnostic_t{};
+		}
+
+		std::vector<std::string> missing() const {
+			std::vector<std::string> result;
+			std::size_t index = 0;
+			((
+				columns[index].size == 0 ? void(result.emplace_back(fields::code)) : void(),
+				++index
+			), ...);
+			return result;
+		}
+
+		// Decodes one B record into s. On failure s is partially written and the
+		// returned diagnostic names the first offending column.
+		template <class value_type>
+		diagnostic_t decode(std::string_view line, value_type& s) const {
+			if(line.size() < required) {
+				return diagnostic_t{ 0, line.size() + 1, error_t::truncated };
+			}
+
+			fixed_columns_t c;
+			bool valid = (swar::enabled && swar::decode_fixed(line, c)) || decode_fixed(line, c);
+
+			std::size_t index = 0;
+			((
+				valid &= columns[index].size == 0 || static_cast<fields&>(s).decode(line.substr(columns[index].begin, columns[index].size)),
+				++index
+			), ...);
+
+			const char n = line[14];
+			const char e = line[23];
+			const bool directions = (n == 'N' || n == 'S') & (e == 'E' || e == 'W');
+
+			if(!(valid & directions)) {
+				return locate(line);
+			}
+
+			const std::int32_t lat_sign = n == 'N' ? 1 : -1;
+			const std::int32_t lon_sign = e == 'E' ? 1 : -1;
+			s.time = units::timestamp(c.hour * 3600 + c.minute * 60 + c.second);
+			s.position = units::gps_position::from_milliminutes(
+				lat_sign * (c.lat_deg * 60000 + c.lat_min),
+				lon_sign * (c.lon_deg * 60000 + c.lon_min)
+			);
+			s.altitude = units::altitude(c.altitude);
+
+			return diagnostic_t{};
+		}
+
+	private:
+
+		static bool code_requested(std::string_view code) {
+			return ((code == fields::code) || ...);
+		}
+
+		// Cold path, reconstructs where a record went wrong.
+		diagnostic_t locate(std::string_view line) const {
+			std::vector<column_t> numeric {
+				{1, 2}, {3, 2}, {5, 2}, {7, 2}, {9, 5}, {15, 3}, {18, 5}, {25, 5, true}
+			};
+			if(line[14] != 'N' && line[14] != 'S') return diagnostic_t{ 0, 15, error_t::invalid_direction };
+			if(line[23] != 'E' && line[23] != 'W') return diagnostic_t{ 0, 24, error_t::invalid_direction };
+			numeric.insert(numeric.end(), columns.begin(), columns.end());
+
+			for(const auto& c : numeric) {
+				if(c.size == 0) continue;
+				int v;
+				auto raw = line.substr(c.begin, c.size);
+				if(!(c.sign ? signed_digits(raw, v) : digits(raw, v))) {
+					return diagnostic_t{ 0, c.begin + first_invalid(raw, c.sign) + 1u, error_t::invalid_digit };
+				}
+			}
+			return diagnostic_t{ 0, 1, error_t::invalid_digit };
+		}
+
+	};
+
+	// Columns of the wind fields in K records, read from the J record. K records
+	// are optional data, one that can not be decoded is ignored.
+	class wind_layout_t {
+
+		column_t direction, speed;
+
+	public:
+
+		void declare(std::string_view line) {
+			for(std::size_t i = 3; i + 7 <= line.size(); i += 7) {
+				int begin, end;
+				if(!digits(line.substr(i, 2), begin) || !digits(line.substr(i + 2, 2), end) || begin < 1 || end < begin) return;
+				const auto code = line.substr(i + 4, 3);
+				const column_t column{ std::uint8_t(begin - 1), std::uint8_t(end - begin + 1) };
+				if(code == "WDI") direction = column;
+				if(code == "WVE") speed = column;
+			}
+		}
+
+		// Decodes one K record. Speeds are in hundredths of km/h, as TAS is.
+		bool decode(std::string_view line, wind_t& w) const {
+			if(direction.size == 0 || speed.size == 0) return false;
+			if(line.size() < std::max<std::size_t>(direction.begin + direction.size, speed.begin + speed.size)) return false;
+			int hour, minute, second, d, v;
+			const bool valid =
+				digits(line.substr(1, 2), hour) &
+				digits(line.substr(3, 2), minute) &
+				digits(line.substr(5, 2), second) &
+				digits(line.substr(direction.begin, direction.size), d) &
+				digits(line.substr(speed.begin, speed.size), v);
+			if(!valid) return false;
+			w.time = units::timestamp(hour * 3600 + minute * 60 + second);
+			w.direction = units::angle::degree_t(d);
+			w.speed = units::velocity::kilometers_per_hour_t(v / 100.0);
+			return true;
+		}
+
+	};
+
+	// A fix carrying only the extension fields listed. Derive the sample type from it
+	// to let the parser skip every column that is not needed.
+	template <class... fields>
+	struct record : fix_t, fields... {
+		using layout = layout_t<fields...>;
+	};
+
+	namespace detail {
+
+		// Decimal number as an integer in units of 10^-scale, rounded at the first
+		// dropped digit.
+		inline bool decimal(std::string_view raw, int scale, int& value) {
+			const bool negative = !raw.empty() && raw.front() == '-';
+			raw.remove_prefix(negative);
+			const auto point = std::min(raw.find('.'), raw.size());
+			const auto fraction = raw.substr(std::min(point + 1, raw.size()));
+
+			int result = 0;
+			bool valid = point > 0 && digits(raw.substr(0, point), result);
+			for(int i = 0; i <= scale; ++i) {
+				int digit = 0;
+				if(static_cast<std::size_t>(i) < fraction.size()) {
+					valid &= digits(fraction.substr(i, 1), digit);
+				}
+				result = i < scale ? result * 10 + digit : result + (digit >= 5);
+			}
+			value = negative ? -result : result;
+			return valid;
+		}
+
+		inline unsigned int hex(char c) {
+			if(c >= '0' && c <= '9') return c - '0';
+			if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+			return 16;
+		}
+
+	}
+
+	// NMEA 0183 GGA sentence, as sent by live trackers. Time, position and GNSS
+	// altitude fill the fixed part of a fix, extension fields keep their defaults.
+	// Returns false with an empty diagnostic for sentences without a position fix.
+	inline bool decode_gga(std::string_view line, fix_t& s, diagnostic_t& diagnostic) {
+		const auto star = line.find('*');
+		if(star != std::string_view::npos) {
+			unsigned int sum = 0;
+			for(char c : line.substr(1, star - 1)) sum ^= static_cast<unsigned char>(c);
+			const bool valid =
+				line.size() >= star + 3 &&
+				detail::hex(line[star + 1]) < 16 && detail::hex(line[star + 2]) < 16 &&
+				detail::hex(line[star + 1]) * 16 + detail::hex(line[star + 2]) == sum;
+			if(!valid) {
+				diagnostic = diagnostic_t{ 0, star + 2, error_t::invalid_checksum };
+				return false;
+			}
+			line = line.substr(0, star);
+		}
+
+		// $--GGA,time,lat,N,lon,E,quality,satellites,hdop,altitude,M,...
+		std::array<std::string_view, 10> field;
+		std::array<std::size_t, 10> column;
+		std::size_t begin = 0;
+		for(std::size_t i = 0; i < field.size(); ++i) {
+			if(begin > line.size()) {
+				diagnostic = diagnostic_t{ 0, line.size() + 1, error_t::truncated };
+				return false;
+			}
+			const auto end = std::min(line.find(',', begin), line.size());
+			field[i] = line.substr(begin, end - begin);
+			column[i] = begin + 1;
+			begin = end + 1;
+		}
+
+		if(field[6].empty() || field[6] == "0") {
+			return false;
+		}
+
+		auto fail = [&](std::size_t i, error_t error) {
+			diagnostic = diagnostic_t{ 0, column[i], error };
+			return false;
+		};
+
+		int hour, minute, second, lat_deg, lat_min, lon_deg, lon_min, altitude;
+		if(!(field[1].size() >= 6 && digits(field[1].substr(0, 2), hour) & digits(field[1].substr(2, 2), minute) & digits(field[1].substr(4, 2), second))) {
+			return fail(1, error_t::invalid_digit);
+		}
+		if(!(field[2].size() > 2 && digits(field[2].substr(0, 2), lat_deg) & detail::decimal(field[2].substr(2), 3, lat_min))) {
+			return fail(2, error_t::invalid_digit);
+		}
+		if(field[3] != "N" && field[3] != "S") {
+			return fail(3, error_t::invalid_direction);
+		}
+		if(!(field[4].size() > 3 && digits(field[4].substr(0, 3), lon_deg) & detail::decimal(field[4].substr(3), 3, lon_min))) {
+			return fail(4, error_t::invalid_digit);
+		}
+		if(field[5] != "E" && field[5] != "W") {
+			return fail(5, error_t::invalid_direction);
+		}
+		if(!detail::decimal(field[9], 0, altitude)) {
+			return fail(9, error_t::invalid_digit);
+		}
+
+		const std::int32_t lat_sign = field[3] == "N" ? 1 : -1;
+		const std::int32_t lon_sign = field[5] == "E" ? 1 : -1;
+		s.time = units::timestamp(hour * 3600 + minute * 60 + second);
+		s.position = units::gps_position::from_milliminutes(
+			lat_sign * (lat_deg * 60000 + lat_min),
+			lon_sign * (lon_deg * 60000 + lon_min)
+		);
+		s.altitude = units::altitude(altitude);
+		return true;
+	}
+
+	// Incremental decoding, fed one line at a time, for input that arrives piecewise.
+	// Follows the same rules as parse(input, inserter, policy).
+	template <class value_type>
+	class decoder_t {
+
+		typename value_type::layout layout;
+		wind_layout_t wind;
+		policy_t policy;
+		result_t result;
+		std::size_t line_number = 0;
+		bool stopped = false;
+
+	public:
+
+		explicit decoder_t(policy_t policy) :
+			policy(policy)
+		{}
+
+		// Returns true if line was a B record or an NMEA GGA sentence with a position
+		// fix and has been decoded into s. Once the input has been stopped by an error
+		// every further line is ignored.
+		bool line(std::string_view line, value_type& s) {
+			++line_number;
+			if(!line.empty() && line.back() == '\r') line.remove_suffix(1);
+			if(stopped || line.empty()) return false;
+
+			diagnostic_t diagnostic;
+			if(line[0] == 'I') {
+				diagnostic = layout.declare(line);
+			}
+
+			if(line[0] == 'J') {
+				wind.declare(line);
+			}
+
+			if(line[0] == 'K') {
+				wind_t w;
+				if(wind.decode(line, w)) result.wind.push_back(w);
+				return false;
 			}
 
 			if(line[0] == 'B') {
-				std::map<std::string, std::string> sample_map;
-				for(const auto& p : position) {
-					sample_map[p.first] = line.substr(p.second.first, p.second.second);
+				diagnostic = layout.decode(line, s);
+				if(!diagnostic) {
+					++result.records;
+					return true;
 				}
-				values.emplace_back(std::move(sample_map));
 			}
+
+			if(line[0] == '$' && line.size() > 7 && line.substr(3, 4) == "GGA,") {
+				if(decode_gga(line, s, diagnostic)) {
+					++result.records;
+					return true;
+				}
+			}
+
+			if(diagnostic) {
+				diagnostic.line = line_number;
+				result.diagnostics.push_back(diagnostic);
+				if(policy == policy_t::abort || line[0] == 'I') {
+					result.error = diagnostic.error;
+					stopped = true;
+				} else {
+					++result.skipped;
+				}
+			}
+			return false;
+		}
+
+		bool done() const {
+			return stopped;
+		}
+
+		result_t finish() {
+			result.missing = layout.missing();
+			return std::move(result);
+		}
+
+		// Everything read so far, for a checkpoint::writer_t.
+		template <class archive_t>
+		void save(archive_t& out) const {
+			out.put(layout);
+			out.put(wind);
+			out.put(result.error);
+			out.put(result.records);
+			out.put(result.skipped);
+			out.put(result.diagnostics);
+			out.put(result.wind);
+			out.put(line_number);
+			out.put(stopped);
 		}
 
+		// Continues from a saved decoder, in place of one that has read nothing.
+		template <class archive_t>
+		bool restore(archive_t& in) {
+			return
+				in.get(layout) &&
+				in.get(wind) &&
+				in.get(result.error) &&
+				in.get(result.records) &&
+				in.get(result.skipped) &&
+				in.get(result.diagnostics) &&
+				in.get(result.wind) &&
+				in.get(line_number) &&
+				in.get(stopped);
+		}
+
+	};
 
-		for(auto& sample_map : values) {
+	// Never throws on malformed input. Every record that can not be decoded is listed in
+	// the diagnostics. With policy_t::skip it is dropped and reading continues, with
+	// policy_t::abort reading stops and the error is reported for the whole file.
+	template <class inserter_t>
+	result_t parse(std::istream& input, inserter_t inserter, policy_t policy) {
+		using value_type = typename inserter_t::container_type::value_type;
+
+		decoder_t<value_type> decoder(policy);
+		std::string line;
+		while( !decoder.done() && std::getline(input, line) ) {
 			value_type s;
-			s.time =
-				units::time::hour_t(std::stoi(sample_map["hour"])) +
-				units::time::minute_t(std::stoi(sample_map["minute"]))+
-				units::time::second_t(std::stoi(sample_map["second"]));
+			if(decoder.line(line, s)) {
+				inserter = std::move(s);
+			}
+		}
+
+		return decoder.finish();
+	}
 
-			s.position = units::gps_position(sample_map["latitude"], sample_map["longitude"]);
-			s.altitude = units::length::meter_t(std::stod(sample_map["altitude"]));
-			s.fix_accuracy = units::length::meter_t(std::stod(sample_map["FXA"]));
-			s.true_air_speed = units::velocity::kilometers_per_hour_t(std::stod(sample_map["TAS"]) / 100);
-			s.ground_speed = units::velocity::kilometers_per_hour_t(std::stod(sample_map["GSP"]) / 100);
-			s.total_energy_vario = units::velocity::meters_per_second_t(std::stod(sample_map["VAT"]) / 100);
-			s.true_heading = units::angle::degree_t(std::stod(sample_map["HDT"]));
-			s.true_track = units::angle::degree_t(std::stod(sample_map["TRT"]));
-			s.oat = units::temperature::celsius_t(std::stod(sample_map["OAT"]) / 10);
-			s.gload = units::acceleration::standard_gravity_t(std::stod(sample_map["ACZ"]) / 100);
+	namespace detail {
+
+		// Calls f for every line of text, without the line break.
+		template <class function_t>
+		void for_each_line(std::string_view text, function_t f) {
+			while(!text.empty()) {
+				auto end = text.find('\n');
+				auto line = text.substr(0, end);
+				text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+				if(!line.empty() && line.back() == '\r') line.remove_suffix(1);
+				f(line);
+			}
+		}
 
-			inserter = std::move(s);
+	}
+
+	// Parses a whole IGC file held in memory, for example an io::mapped_file.
+	// The header is read sequentially up to the first B record, the B record region
+	// is then split at line boundaries and decoded by up to `threads` threads
+	// directly into their slice of track. All chunks share the layout from the
+	// I record. A file with NMEA GGA sentences, or with I or J records after the
+	// first B record, is decoded sequentially as a whole instead, as only the
+	// decoder follows them. Decoded fixes are appended to track in file order
+	// and the result is the same as parse(input, inserter, policy) would give.
+	template <class value_type, class allocator_t>
+	result_t parse_parallel(std::string_view text, std::vector<value_type, allocator_t>& track, policy_t policy, unsigned int threads = std::thread::hardware_concurrency()) {
+		// Below this size a chunk costs more to hand to a thread than to decode.
+		constexpr std::size_t min_chunk = 64 * 1024;
+
+		const std::string_view whole = text;
+		auto sequential = [&]() {
+			decoder_t<value_type> decoder(policy);
+			detail::for_each_line(whole, [&](std::string_view line) {
+				value_type s;
+				if(decoder.line(line, s)) track.push_back(std::move(s));
+			});
+			return decoder.finish();
+		};
+		auto gga = [](std::string_view line) {
+			return line.size() > 7 && line[0] == '$' && line.substr(3, 4) == "GGA,";
+		};
+
+		result_t result;
+		typename value_type::layout layout;
+		wind_layout_t wind;
+
+		std::size_t header_lines = 0;
+		while(!text.empty() && text[0] != 'B') {
+			auto end = text.find('\n');
+			auto line = text.substr(0, end);
+			text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+			if(!line.empty() && line.back() == '\r') line.remove_suffix(1);
+			++header_lines;
+
+			if(gga(line)) {
+				return sequential();
+			}
+			if(!line.empty() && line[0] == 'J') {
+				wind.declare(line);
+			}
+			wind_t w;
+			if(!line.empty() && line[0] == 'K' && wind.decode(line, w)) {
+				result.wind.push_back(w);
+			}
+
+			if(!line.empty() && line[0] == 'I') {
+				auto diagnostic = layout.declare(line);
+				if(diagnostic) {
+					diagnostic.line = header_lines;
+					result.diagnostics.push_back(diagnostic);
+					result.error = diagnostic.error;
+					result.missing = layout.missing();
+					return result;
+				}
+			}
 		}
 
+		struct chunk_t {
+			std::string_view text;
+			std::size_t lines = 0;
+			std::size_t capacity = 0;
+			// Holds a line only the sequential decoder follows.
+			bool sequential = false;
+			std::size_t offset = 0;
+			std::size_t records = 0;
+			std::vector<diagnostic_t> diagnostics;
+			std::vector<wind_t> wind;
+		};
+
+		std::size_t n = std::max<std::size_t>(1, std::min<std::size_t>(threads, text.size() / min_chunk + 1));
+		std::vector<chunk_t> chunks(n);
+		std::size_t begin = 0;
+		for(std::size_t i = 0; i < n; ++i) {
+			std::size_t end = text.size();
+			if(i + 1 < n) {
+				end = text.find('\n', std::max(begin, text.size() * (i + 1) / n));
+				end = end == std::string_view::npos ? text.size() : end + 1;
+			}
+			chunks[i].text = text.substr(begin, end - begin);
+			begin = end;
+		}
+
+		parallel::run(n, [&](std::size_t i) {
+			auto& chunk = chunks[i];
+			detail::for_each_line(chunk.text, [&](std::string_view line) {
+				++chunk.lines;
+				chunk.capacity += !line.empty() && line[0] == 'B';
+				chunk.sequential |= !line.empty() && (line[0] == 'I' || line[0] == 'J' || gga(line));
+			});
+		});
+		for(const auto& chunk : chunks) {
+			if(chunk.sequential) return sequential();
+		}
+
+		const std::size_t base = track.size();
+		std::size_t capacity = 0;
+		for(auto& chunk : chunks) {
+			chunk.offset = base + capacity;
+			capacity += chunk.capacity;
+		}
+		track.resize(base + capacity);
+
+		parallel::run(n, [&](std::size_t i) {
+			auto& chunk = chunks[i];
+			std::size_t line_number = 0;
+			bool stopped = false;
+			detail::for_each_line(chunk.text, [&](std::string_view line) {
+				++line_number;
+				if(stopped || line.empty()) return;
+				if(line[0] == 'K') {
+					wind_t w;
+					if(wind.decode(line, w)) chunk.wind.push_back(w);
+					return;
+				}
+				if(line[0] != 'B') return;
+
+				auto& s = track[chunk.offset + chunk.records];
+				auto diagnostic = layout.decode(line, s);
+				if(diagnostic) {
+					diagnostic.line = line_number;
+					chunk.diagnostics.push_back(diagnostic);
+					stopped = policy == policy_t::abort;
+				} else {
+					++chunk.records;
+				}
+			});
+		});
+
+		// Stitch the slices together, closing the gaps left by skipped records.
+		std::size_t line_offset = header_lines;
+		std::size_t write = base;
+		for(auto& chunk : chunks) {
+			for(auto& d : chunk.diagnostics) {
+				d.line += line_offset;
+				result.diagnostics.push_back(d);
+			}
+			line_offset += chunk.lines;
+
+			if(write != chunk.offset) {
+				std::move(
+					track.begin() + chunk.offset,
+					track.begin() + chunk.offset + chunk.records,
+					track.begin() + write
+				);
+			}
+			write += chunk.records;
+			result.records += chunk.records;
+			result.wind.insert(result.wind.end(), chunk.wind.begin(), chunk.wind.end());
+
+			if(!chunk.diagnostics.empty()) {
+				if(policy == policy_t::abort) {
+					result.error = chunk.diagnostics.front().error;
+					break;
+				}
+				result.skipped += chunk.diagnostics.size();
+			}
+		}
+		track.resize(write);
+
+		result.missing = layout.missing();
+		return result;
+	}
+
+	// Throws std::invalid_argument on the first malformed record. Returns the codes of
+	// the requested fields the logger did not declare, their values are left default constructed.
+	template <class inserter_t>
+	std::vector<std::string> parse(std::istream& input, inserter_t inserter) {
+		auto result = parse(input, inserter, policy_t::abort);
+		if(result.error != error_t::none) {
+			const auto& d = result.diagnostics.back();
+			throw std::invalid_argument(
+				"Zeile " + std::to_string(d.line) +
+				", Spalte " + std::to_string(d.column) +
+				": " + describe(d.error)
+			);
+		}
+		return result.missing;
 	}
 
 }
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "airports.hpp"
+#include "circling.hpp"
+#include "classification.hpp"
+#include "detection.hpp"
+#include "parallel.hpp"
+#include "scoring.hpp"
+#include "thermal.hpp"
+
+namespace pipeline {
+
+	template <class iterator_t>
+	struct score_t {
+		const airport_t* start_airport = nullptr;
+		std::pmr::vector<thermal_t<iterator_t>> thermals;
+		// First and last fix of every thermal as detected, before optimize.
+		std::pmr::vector<std::pair<iterator_t, iterator_t>> detected;
+		// Indices into thermals.
+		std::pmr::vector<std::uint32_t> local;
+		std::pmr::vector<std::uint32_t> remote;
+		// First fix of the flight and the classes of every fix.
+		iterator_t begin{};
+		classification::classes_t classes;
+
+		explicit score_t(std::pmr::memory_resource* memory) :
+			thermals(memory),
+			detected(memory),
+			local(memory),
+			remote(memory),
+			classes(memory)
+		{}
+
+		// §4.1 for any part of the flight, such as one cut from a thermal.
+		bool is_local(const thermal_t<iterator_t>& t) const {
+			return classes.local(std::distance(begin, t.begin), std::distance(begin, t.end));
+		}
+
+		// §4.2 for any part of the flight.
+		bool is_remote(const thermal_t<iterator_t>& t) const {
+			return classes.remote(std::distance(begin, t.begin));
+		}
+
+		auto local_thermals() const {
+			return classification::view_t(thermals.cbegin(), local);
+		}
+
+		auto remote_thermals() const {
+			return classification::view_t(thermals.cbegin(), remote);
+		}
+	};
+
+	// Detection, optimization and classification of one flight under a ruleset.
+	// All containers of the result allocate from memory, typically an arena_t.
+	// Detection runs on the calling thread, optimization and the per fix passes
+	// of classification on up to `threads`. The result does not depend on it.
+	// circles, if given, follows the track during detection.
+	template <class rules, class iterator_t>
+	score_t<iterator_t> score(
+		iterator_t begin,
+		iterator_t end,
+		std::pmr::memory_resource* memory = std::pmr::get_default_resource(),
+		std::vector<detection::trace_t>* trace = nullptr,
+		unsigned int threads = std::thread::hardware_concurrency(),
+		circling::tracker_t* circles = nullptr
+	) {
+		score_t<iterator_t> result(memory);
+		if(begin == end) return result;
+
+		detection::detect<rules>(begin, end, std::back_inserter(result.thermals), trace, circles);
+
+		result.detected.reserve(result.thermals.size());
+		for(const auto& t : result.thermals) {
+			result.detected.emplace_back(t.begin, t.end);
+		}
+
+		// optimize is quadratic in the length of a thermal. Longest first, so
+		// the last thread to finish is not stuck with the longest one.
+		std::pmr::vector<std::uint32_t> order(result.thermals.size(), memory);
+		for(std::uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+			return std::distance(result.thermals[a].begin, result.thermals[a].end) > std::distance(result.thermals[b].begin, result.thermals[b].end);
+		});
+		optimize_each<iterator_t>(order.size(), [&](std::size_t i) -> thermal_t<iterator_t>& {
+			return result.thermals[order[i]];
+		}, memory, threads);
+
+		result.start_airport = &nearest_airport(begin->position);
+
+		const auto distance = classification::distances(begin, end, *result.start_airport, memory, threads);
+		result.begin = begin;
+		result.classes = classification::classes_t(begin, distance, *result.start_airport, rules::cylinder_radius, rules::glide_ratio, memory, threads);
+		for(std::uint32_t i = 0; i < result.thermals.size(); ++i) {
+			const auto& t = result.thermals[i];
+			if(result.is_local(t)) result.local.push_back(i);
+			if(result.is_remote(t)) result.remote.push_back(i);
+		}
+
+		return result;
+	}
+
+}
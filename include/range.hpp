@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
+#include "parallel.hpp"
+
+// Minimum or maximum of any interval of a fixed sequence, such as a column
+// derived per fix of a flight, in O(1) after O(n log n) preparation.
+namespace range {
+
+	// Level k holds the best of the 2^k values starting at each index, an
+	// interval is covered by two overlapping runs of one level. better(a, b)
+	// tells whether a wins over b: std::less<> gives minima, std::greater<>
+	// maxima.
+	template <class value_t, class better_t = std::less<>>
+	class sparse_table_t {
+
+		std::size_t n = 0;
+		// Levels one after another, level k is n - 2^k + 1 values long.
+		std::pmr::vector<value_t> values;
+		std::pmr::vector<std::size_t> offsets;
+		// Level of the longest run fitting into an interval of each length.
+		std::pmr::vector<std::uint8_t> levels;
+		better_t better;
+
+		value_t best(const value_t& a, const value_t& b) const {
+			return better(b, a) ? b : a;
+		}
+
+		static std::size_t values_for(std::size_t n) {
+			std::size_t size = 0;
+			for(std::size_t length = 1; length <= n; length *= 2) {
+				size += n - length + 1;
+			}
+			return size;
+		}
+
+	public:
+
+		// Of no values, filled by assign.
+		explicit sparse_table_t(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) :
+			values(memory),
+			offsets(memory),
+			levels(1, memory)
+		{}
+
+		template <class input_t>
+		explicit sparse_table_t(const input_t& input, std::pmr::memory_resource* memory = std::pmr::get_default_resource(), unsigned int threads = 1) :
+			sparse_table_t(memory)
+		{
+			assign(input, threads);
+		}
+
+		// Room for n values, assign does not allocate for as many.
+		void reserve(std::size_t n) {
+			values.reserve(values_for(n));
+			// One level per bit of n.
+			offsets.reserve(64);
+			levels.reserve(n + 1);
+		}
+
+		// Replaces the values, keeping the memory held.
+		template <class input_t>
+		void assign(const input_t& input, unsigned int threads = 1) {
+			n = input.size();
+			levels.resize(n + 1);
+			for(std::size_t length = 2; length <= n; ++length) {
+				levels[length] = levels[length / 2] + 1;
+			}
+
+			offsets.clear();
+			std::size_t size = 0;
+			for(std::size_t length = 1; length <= n; length *= 2) {
+				offsets.push_back(size);
+				size += n - length + 1;
+			}
+			values.resize(size);
+			std::copy(input.begin(), input.end(), values.begin());
+
+			for(std::size_t k = 1; k < offsets.size(); ++k) {
+				const std::size_t half = std::size_t(1) << (k - 1);
+				const value_t* below = values.data() + offsets[k - 1];
+				value_t* level = values.data() + offsets[k];
+				parallel::for_each_block(n - 2 * half + 1, threads, 4096, [&](std::size_t first, std::size_t last) {
+					for(std::size_t i = first; i < last; ++i) {
+						level[i] = best(below[i], below[i + half]);
+					}
+				});
+			}
+		}
+
+		std::size_t size() const {
+			return n;
+		}
+
+		// Best value from first to last, both included, first <= last < size().
+		value_t query(std::size_t first, std::size_t last) const {
+			const unsigned int k = levels[last - first + 1];
+			const value_t* level = values.data() + offsets[k];
+			return best(level[first], level[last + 1 - (std::size_t(1) << k)]);
+		}
+
+	};
+
+	template <class value_t>
+	using minimum_t = sparse_table_t<value_t, std::less<>>;
+
+	template <class value_t>
+	using maximum_t = sparse_table_t<value_t, std::greater<>>;
+
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <units.h>
+#include <units/gps.hpp>
+
+#include "parser.hpp"
+
+// Canonical rate of a track, for loggers recording faster or slower than the
+// rules assume. The window of §3.3 is counted in fixes and stands for 17
+// seconds only at one fix per second; a logger writing several fixes within
+// the same second even gives a time step of zero to the turn rate. Fixes are
+// put on a grid of whole `interval` seconds, starting at the first fix:
+// fixes around a grid point are averaged, grid points between two fixes are
+// interpolated.
+namespace resample {
+
+	struct options_t {
+		// Seconds between fixes of the result.
+		std::int32_t interval = 1;
+		// Longer gaps in the track are kept, not filled.
+		std::int32_t max_gap = 30;
+	};
+
+	namespace detail {
+
+		// Extension fields whose values may be averaged and interpolated, f is
+		// called with the field of target and of other. Headings and tracks wrap
+		// around and are taken from the earlier fix instead.
+		template <class sample_t, class function_t>
+		void for_each_linear(sample_t& target, const sample_t& other, function_t f) {
+			using namespace parser::field;
+			if constexpr(std::is_base_of_v<fix_accuracy, sample_t>) f(target.fix_accuracy, other.fix_accuracy);
+			if constexpr(std::is_base_of_v<true_air_speed, sample_t>) f(target.true_air_speed, other.true_air_speed);
+			if constexpr(std::is_base_of_v<ground_speed, sample_t>) f(target.ground_speed, other.ground_speed);
+			if constexpr(std::is_base_of_v<total_energy_vario, sample_t>) f(target.total_energy_vario, other.total_energy_vario);
+			if constexpr(std::is_base_of_v<oat, sample_t>) f(target.oat, other.oat);
+			if constexpr(std::is_base_of_v<gload, sample_t>) f(target.gload, other.gload);
+		}
+
+		// Linear fields of target moved towards those of to by w.
+		template <class sample_t>
+		void mix(sample_t& target, const sample_t& to, double w) {
+			for_each_linear(target, to, [w](auto& value, const auto& other) {
+				value = value + (other - value) * w;
+			});
+		}
+
+		inline std::int32_t lerp(std::int32_t a, std::int32_t b, double w) {
+			return static_cast<std::int32_t>(std::lround(a + (b - a) * w));
+		}
+
+	}
+
+	// Resamples a track fix by fix. Fixes must arrive in order of time, a fix
+	// before the previous one is dropped. Every output fix is written with
+	// *out++, up to one grid interval after the fixes it depends on arrived.
+	template <class sample_t>
+	class resampler_t {
+
+		options_t options;
+
+		// Seconds since the first fix, unwrapped at midnight.
+		std::optional<units::timestamp> first_time, last_time;
+		std::int64_t elapsed = 0;
+
+		// Grid point being collected, the sum of its fixes and their mean so far.
+		std::int64_t bucket = 0;
+		std::size_t count = 0;
+		std::int64_t latitude = 0, longitude = 0, altitude = 0;
+		sample_t mean;
+
+		// Last fix written and its grid point.
+		std::optional<sample_t> written;
+		std::int64_t written_bucket = 0;
+
+		std::size_t dropped_fixes = 0;
+
+		template <class output_t>
+		void emit(output_t& out) {
+			if(count == 0) return;
+
+			const auto n = static_cast<std::int64_t>(count);
+			auto round = [n](std::int64_t sum) {
+				return static_cast<std::int32_t>(sum >= 0 ? (sum + n / 2) / n : -((-sum + n / 2) / n));
+			};
+			mean.time = time_of(bucket);
+			mean.position = units::gps_position::from_milliminutes(round(latitude), round(longitude));
+			mean.altitude = units::altitude(round(altitude));
+
+			if(written && bucket - written_bucket > 1 && (bucket - written_bucket) * options.interval <= options.max_gap) {
+				const double steps = static_cast<double>(bucket - written_bucket);
+				for(std::int64_t b = written_bucket + 1; b < bucket; ++b) {
+					const double w = (b - written_bucket) / steps;
+					sample_t s = *written;
+					detail::mix(s, mean, w);
+					s.time = time_of(b);
+					s.position = units::gps_position::from_milliminutes(
+						detail::lerp(written->position.latitude_milliminutes(), mean.position.latitude_milliminutes(), w),
+						detail::lerp(written->position.longitude_milliminutes(), mean.position.longitude_milliminutes(), w)
+					);
+					s.altitude = units::altitude(detail::lerp(written->altitude.count(), mean.altitude.count(), w));
+					*out++ = s;
+				}
+			}
+
+			*out++ = mean;
+			written = mean;
+			written_bucket = bucket;
+			count = 0;
+		}
+
+		units::timestamp time_of(std::int64_t b) const {
+			const std::int64_t t = first_time->count() + b * options.interval;
+			return units::timestamp(static_cast<std::int32_t>(t % units::timestamp::day));
+		}
+
+	public:
+
+		explicit resampler_t(options_t options = {}) :
+			options(options)
+		{
+			if(this->options.interval < 1) this->options.interval = 1;
+		}
+
+		template <class output_t>
+		void push(const sample_t& s, output_t& out) {
+			if(!first_time) {
+				first_time = last_time = s.time;
+			} else {
+				const auto d = delta(*last_time, s.time);
+				if(d < 0) {
+					++dropped_fixes;
+					return;
+				}
+				elapsed += d;
+				last_time = s.time;
+			}
+
+			// Grid point nearest to the fix, halfway between two goes to the later.
+			const std::int64_t b = (elapsed + options.interval / 2) / options.interval;
+			if(count > 0 && b != bucket) emit(out);
+			bucket = b;
+
+			if(count == 0) {
+				mean = s;
+				latitude = longitude = altitude = 0;
+			} else {
+				detail::mix(mean, s, 1.0 / static_cast<double>(count + 1));
+			}
+			latitude += s.position.latitude_milliminutes();
+			longitude += s.position.longitude_milliminutes();
+			altitude += s.altitude.count();
+			++count;
+		}
+
+		// Writes the fixes still held back at the end of the track.
+		template <class output_t>
+		void finish(output_t& out) {
+			emit(out);
+		}
+
+		// Fixes dropped for going back in time.
+		std::size_t dropped() const {
+			return dropped_fixes;
+		}
+
+	};
+
+	// Resamples a whole track, returns the output iterator past the last fix.
+	template <class iterator_t, class output_t>
+	output_t resample(iterator_t begin, iterator_t end, const options_t& options, output_t out) {
+		resampler_t<typename std::iterator_traits<iterator_t>::value_type> resampler(options);
+		for(auto it = begin; it != end; ++it) {
+			resampler.push(*it, out);
+		}
+		resampler.finish(out);
+		return out;
+	}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <units.h>
+
+// Contest rules as compile time policies. The scoring pipeline is instantiated
+// per ruleset, so every constant is folded into the code using it. To support
+// another contest, add a struct with the same members and list it in `all`.
+namespace ruleset {
+
+	// Ausschreibung der Thermik Challenge, Akaflieg Dresden.
+	struct akaflieg_dresden {
+		static constexpr char name[] = "akaflieg_dresden";
+
+		// §3.3: floating average over 17 fixes, at 1 Hz 17 seconds.
+		static constexpr std::size_t window = 17;
+		// §3.3: average turn rate of a thermal.
+		static constexpr units::angular_velocity::degrees_per_second_t turn_rate{6};
+		// §3.4: thermals closer than this are merged.
+		static constexpr units::time::second_t merge_gap{12};
+		// §4.1: radius of the local cylinder.
+		static constexpr units::length::meter_t cylinder_radius{10000};
+		// §4.2: glide ratio of the cone around the start airport.
+		static constexpr double glide_ratio = 40;
+		// §5.2: thermals summed within this window.
+		static constexpr units::time::second_t scoring_window{3600};
+	};
+
+	using all = std::tuple<akaflieg_dresden>;
+
+	// Calls f(rules{}) for the ruleset with the given name. Returns false if there is none.
+	template <class function_t>
+	bool dispatch(const std::string& name, function_t f) {
+		return std::apply(
+			[&](auto... rules) {
+				return ((name == decltype(rules)::name ? (f(rules), true) : false) || ...);
+			},
+			all{}
+		);
+	}
+
+}
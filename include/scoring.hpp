@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+#include <units.h>
+#include <units/gps.hpp>
+
+#include "airfields.hpp"
+#include "airports.hpp"
+#include "parallel.hpp"
+#include "range.hpp"
+#include "thermal.hpp"
+
+// TE height of every fix of a flight, or of a part of one, and the highest of
+// any range of them.
+template <class iterator_t>
+class energy_t {
+
+	iterator_t base{};
+	std::pmr::vector<double> height;
+	range::maximum_t<double> highest;
+
+public:
+
+	// Of no fixes, filled by assign.
+	explicit energy_t(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) :
+		height(memory),
+		highest(memory)
+	{}
+
+	energy_t(iterator_t begin, iterator_t end, std::pmr::memory_resource* memory = std::pmr::get_default_resource(), unsigned int threads = 1) :
+		energy_t(memory)
+	{
+		assign(begin, end, threads);
+	}
+
+	// Room for n fixes, assign does not allocate for as many.
+	void reserve(std::size_t n) {
+		height.reserve(n);
+		highest.reserve(n);
+	}
+
+	// Replaces the fixes, keeping the memory held.
+	void assign(iterator_t begin, iterator_t end, unsigned int threads = 1) {
+		base = begin;
+		height.resize(std::distance(begin, end));
+		parallel::for_each_block(height.size(), threads, 4096, [&](std::size_t first, std::size_t last) {
+			auto it = std::next(begin, first);
+			for(std::size_t i = first; i < last; ++i, ++it) {
+				// As thermal_t adds it to the gain.
+				const units::length::meter_t speed = units::math::pow<2>(it->true_air_speed) / units::acceleration::standard_gravity_t(2);
+				height[i] = it->altitude.count() + speed.template to<double>();
+			}
+		});
+		highest.assign(height, threads);
+	}
+
+	double at(iterator_t it) const {
+		return height[it - base];
+	}
+
+	// Highest from first to last, both included.
+	double max(iterator_t first, iterator_t last) const {
+		return highest.query(first - base, last - base);
+	}
+
+};
+
+namespace detail {
+
+	// Times never go backwards from first to last, both included, so the first
+	// fix of a range is the nearest in time to any fix before it.
+	template <class iterator_t>
+	bool ordered(iterator_t first, iterator_t last) {
+		std::int64_t span = 0;
+		for(auto it = first; it != last; ++it) {
+			const auto d = delta(it->time, (it + 1)->time);
+			if(d < 0) return false;
+			span += d;
+		}
+		return span < units::timestamp::day / 2;
+	}
+
+	// Rounding of the TE heights against the gain of thermal_t.
+	constexpr double slack = 1e-6;
+
+	struct any_start_t {
+		template <class iterator_t>
+		bool operator()(iterator_t) const {
+			return true;
+		}
+	};
+
+	// Every part from start to an end within first to last, both included, in
+	// order of the end. A range is skipped if even its highest end reached in
+	// its shortest time could not beat best: points are gain² / time.
+	template <class iterator_t>
+	void optimize_ends(iterator_t start, iterator_t first, iterator_t last, const energy_t<iterator_t>& energy, thermal_t<iterator_t>& best) {
+		const double gain = energy.max(first, last) - energy.at(start) + slack;
+		if(!(gain > 0)) return;
+		const double time = delta(start->time, first->time);
+		if(time > 0 && gain * gain / time <= best.points) return;
+
+		if(last - first < 4) {
+			for(auto it = first; ; ++it) {
+				thermal_t<iterator_t> t(start, it);
+				if(t.points > best.points) best = t;
+				if(it == last) break;
+			}
+			return;
+		}
+		const auto middle = first + (last - first) / 2;
+		optimize_ends(start, first, middle, energy, best);
+		optimize_ends(start, middle + 1, last, energy, best);
+	}
+
+}
+
+// The part of a thermal with the most points: the thermal itself or any part
+// ending before its last fix, of those starting at a fix starts accepts. Its
+// points are below zero if starts accepts none. energy must cover the thermal
+// but its last fix.
+template <class iterator_t, class starts_t = detail::any_start_t>
+void optimize(thermal_t<iterator_t>& thermal, const energy_t<iterator_t>& energy, starts_t starts = {}) {
+	thermal_t<iterator_t> max = thermal;
+	if(!starts(thermal.begin)) max.points = -1;
+
+	if(thermal.begin < thermal.end && detail::ordered(thermal.begin, thermal.end)) {
+		// Parts are tried in the same order as by the plain search below, so
+		// the same one wins a tie.
+		const auto last = std::prev(thermal.end);
+		for(auto it1 = thermal.begin; it1 < last; ++it1) {
+			if(!starts(it1)) continue;
+			// A start followed by a lower one never wins: the next start gains
+			// more to every end in no more time.
+			if(starts(it1 + 1) && energy.at(it1 + 1) < energy.at(it1) - detail::slack) continue;
+			detail::optimize_ends(it1, it1 + 1, last, energy, max);
+		}
+	} else {
+		for(auto it1 = thermal.begin; it1 != thermal.end; ++it1) {
+			if(!starts(it1)) continue;
+			for(auto it2 = it1+1; it2 != thermal.end; ++it2) {
+				thermal_t<iterator_t> t(it1, it2);
+				if(t.points > max.points) max = t;
+			}
+		}
+	}
+
+	thermal = max;
+}
+
+// Index of the TE heights of one thermal at a time, reused from thermal to
+// thermal. Thermals cover little of a flight, indexing each costs less than
+// indexing the whole flight. Allocates only while growing to the longest
+// thermal, and not at all after reserve for it.
+template <class iterator_t>
+class energy_scratch_t {
+
+	energy_t<iterator_t> energy;
+
+public:
+
+	explicit energy_scratch_t(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) :
+		energy(memory)
+	{}
+
+	void reserve(std::size_t fixes) {
+		energy.reserve(fixes);
+	}
+
+	const energy_t<iterator_t>& cover(iterator_t begin, iterator_t end) {
+		energy.assign(begin, end);
+		return energy;
+	}
+
+};
+
+template <class iterator_t, class starts_t = detail::any_start_t>
+void optimize(thermal_t<iterator_t>& thermal, energy_scratch_t<iterator_t>& scratch, starts_t starts = {}) {
+	optimize(thermal, scratch.cover(thermal.begin, thermal.end), starts);
+}
+
+// Optimizes thermal(0) ... thermal(n-1) on up to `threads` threads. Each
+// thread has scratch of its own, taken from memory before any starts, since
+// an arena_t must not be used by several threads.
+template <class iterator_t, class thermal_function_t>
+void optimize_each(std::size_t n, thermal_function_t thermal, std::pmr::memory_resource* memory, unsigned int threads) {
+	std::size_t longest = 0;
+	for(std::size_t i = 0; i < n; ++i) {
+		const auto& t = thermal(i);
+		longest = std::max<std::size_t>(longest, std::distance(t.begin, t.end));
+	}
+	const std::size_t workers = std::max<std::size_t>(1, std::min<std::size_t>(threads, n));
+	std::pmr::vector<energy_scratch_t<iterator_t>> scratch(memory);
+	scratch.reserve(workers);
+	for(std::size_t w = 0; w < workers; ++w) {
+		scratch.emplace_back(memory);
+		scratch.back().reserve(longest);
+	}
+	parallel::for_each_index(n, threads, [&](std::size_t worker, std::size_t i) {
+		optimize(thermal(i), scratch[worker]);
+	});
+}
+
+template <class thermal_it>
+auto find_max_hour(const thermal_it begin, const thermal_it end, units::time::second_t window) {
+
+	struct {
+		double points;
+		thermal_it begin;
+		thermal_it end;
+	} max { 0, begin, begin };
+
+	// Points of all thermals before each one, the sum of a window is the
+	// difference of two of them. Points are never negative, so the rest of the
+	// flight bounds every window from a thermal on.
+	std::vector<double> before(1, 0.0);
+	bool bounded = true;
+	for(auto it = begin; it != end; ++it) {
+		bounded &= it->points >= 0;
+		before.push_back(before.back() + it->points);
+	}
+
+	std::size_t i1 = 0;
+	for(auto it1 = begin; it1 != end; ++it1, ++i1) {
+		if(bounded && before.back() - before[i1] <= max.points) break;
+		std::size_t i2 = i1 + 1;
+		for(auto it2 = it1+1; it2 != end; ++it2, ++i2) {
+			if((it2->end->time - it1->begin->time) <= window) {
+				const double total_points = before[i2 + 1] - before[i1];
+				if(total_points > max.points) {
+					max.points = total_points;
+					max.begin = it1;
+					max.end = it2;
+				}
+			}
+		}
+	}
+
+	return max;
+}
+
+// Searches the loaded airfield databases, the built in list without them.
+inline const airport_t& nearest_airport(const units::gps_position& position) {
+	if(const auto* loaded = airfields::nearest(position)) {
+		return *loaded;
+	}
+	const auto& airports = builtin_airports();
+	return *std::min_element(
+		airports.begin(),
+		airports.end(),
+		[&](const airport_t& lhs, const airport_t& rhs) {
+			return units::distance(position, lhs.position) < units::distance(position, rhs.position);
+		}
+	);
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "classification.hpp"
+#include "pipeline.hpp"
+#include "scoring.hpp"
+#include "thermal.hpp"
+
+// The k best thermals of a flight that share no fix. Every detected thermal is
+// a range of fixes whose best part optimize finds. Taking that part leaves the
+// fixes before and after it as two new ranges. Only these two are optimized
+// again, all other ranges keep their best part in a max heap, so each further
+// thermal costs two optimizations of ranges smaller than the one it came from.
+// For a class the detected thermals are first split at every fix no part of
+// the class may hold, and optimize only tries starts the class allows, so
+// every part taken belongs to it.
+namespace selection {
+
+	// Parts of the whole flight.
+	struct flight_t {
+		static bool holds(std::uint8_t) { return true; }
+		static bool starts(std::uint8_t) { return true; }
+	};
+
+	// §4.1: every fix within the cylinder, as classes_t::local.
+	struct local_t {
+		static bool holds(std::uint8_t mask) { return mask & classification::in_cylinder; }
+		static bool starts(std::uint8_t) { return true; }
+	};
+
+	// §4.2: begun outside the glide cone, as classes_t::remote.
+	struct remote_t {
+		static bool holds(std::uint8_t) { return true; }
+		static bool starts(std::uint8_t mask) { return !(mask & classification::in_cone); }
+	};
+
+	template <class iterator_t>
+	struct pick_t {
+		thermal_t<iterator_t> thermal;
+		// Index of the detected thermal it was cut from.
+		std::uint32_t source;
+	};
+
+	template <class iterator_t, class class_t = flight_t>
+	class selector_t {
+
+		struct candidate_t {
+			// Fixes still free, both included.
+			iterator_t first;
+			iterator_t last;
+			std::uint32_t source;
+			// Best part of them.
+			thermal_t<iterator_t> best;
+		};
+
+		// Max heap on points, the earlier thermal wins a tie.
+		static bool below(const candidate_t& lhs, const candidate_t& rhs) {
+			if(lhs.best.points != rhs.best.points) return lhs.best.points < rhs.best.points;
+			return rhs.best.begin < lhs.best.begin;
+		}
+
+		// First fix of the flight and the classes of every fix.
+		iterator_t begin;
+		const classification::classes_t* classes;
+		std::pmr::vector<candidate_t> heap;
+		energy_scratch_t<iterator_t> energy;
+
+		std::uint8_t mask(iterator_t it) const {
+			return (*classes)[it - begin];
+		}
+
+		void push(iterator_t first, iterator_t last, std::uint32_t source, const thermal_t<iterator_t>& best) {
+			// Parts without points are not worth reporting.
+			if(!(best.points > 0)) return;
+			heap.push_back(candidate_t{ first, last, source, best });
+			std::push_heap(heap.begin(), heap.end(), below);
+		}
+
+		void optimize_range(iterator_t first, iterator_t last, std::uint32_t source) {
+			// A thermal needs two fixes.
+			if(last - first < 1) return;
+			thermal_t<iterator_t> best(first, last);
+			optimize(best, energy, [this](iterator_t it) { return class_t::starts(mask(it)); });
+			push(first, last, source, best);
+		}
+
+	public:
+
+		selector_t(iterator_t begin, const classification::classes_t& classes, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) :
+			begin(begin),
+			classes(&classes),
+			heap(memory),
+			energy(memory)
+		{}
+
+		// A detected thermal from first to last whose optimized part is known
+		// and which the class takes whole.
+		void add(iterator_t first, iterator_t last, std::uint32_t source, const thermal_t<iterator_t>& best) {
+			push(first, last, source, best);
+		}
+
+		// A detected thermal from first to last, split into the runs of fixes
+		// the class may hold, each optimized here.
+		void add(iterator_t first, iterator_t last, std::uint32_t source) {
+			auto run = first;
+			for(auto it = first; ; ++it) {
+				const bool held = class_t::holds(mask(it));
+				if(!held && run < it) optimize_range(run, it - 1, source);
+				if(it == last) {
+					if(held) optimize_range(run, last, source);
+					break;
+				}
+				if(!held) run = it + 1;
+			}
+		}
+
+		// The best part not sharing a fix with any taken before, none once no
+		// part with points is left.
+		std::optional<pick_t<iterator_t>> next() {
+			if(heap.empty()) return std::nullopt;
+			std::pop_heap(heap.begin(), heap.end(), below);
+			const candidate_t c = heap.back();
+			heap.pop_back();
+			if(c.best.begin != c.first) optimize_range(c.first, c.best.begin - 1, c.source);
+			if(c.best.end != c.last) optimize_range(c.best.end + 1, c.last, c.source);
+			return pick_t<iterator_t>{ c.best, c.source };
+		}
+
+	};
+
+	// The k best parts of a class of the thermals of a score, best first. Every
+	// detected thermal is offered, a part of a class needs not be cut from a
+	// thermal of it.
+	template <class class_t = flight_t, class iterator_t>
+	std::pmr::vector<pick_t<iterator_t>> top_k(
+		const pipeline::score_t<iterator_t>& score,
+		std::size_t k,
+		std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+	) {
+		selector_t<iterator_t, class_t> selector(score.begin, score.classes, memory);
+		for(std::uint32_t i = 0; i < score.detected.size(); ++i) {
+			const auto [first, last] = score.detected[i];
+			if constexpr(std::is_same_v<class_t, flight_t>) {
+				selector.add(first, last, i, score.thermals[i]);
+			} else {
+				selector.add(first, last, i);
+			}
+		}
+
+		std::pmr::vector<pick_t<iterator_t>> result(memory);
+		result.reserve(k);
+		while(result.size() < k) {
+			auto pick = selector.next();
+			if(!pick) break;
+			result.push_back(*pick);
+		}
+		return result;
+	}
+
+}
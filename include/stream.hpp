@@ -0,0 +1,444 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <units.h>
+#include <units/gps.hpp>
+#include <units/fixed.hpp>
+
+#include "airports.hpp"
+#include "classification.hpp"
+#include "detection.hpp"
+#include "parser.hpp"
+#include "scoring.hpp"
+#include "thermal.hpp"
+
+// The scoring pipeline as a chain of streaming stages,
+// parse -> derive/detect/merge -> optimize -> classify -> rank.
+// Every stage is fed one item at a time and passes its output on at once, so a
+// thermal is reported as soon as it can no longer change. Only the fixes some
+// stage still refers to are buffered, memory does not grow with the flight.
+namespace stream {
+
+	// Queue in a ring of power of two size. It grows by doubling and never
+	// shrinks, so a stream in steady state pushes and pops without allocating.
+	template <class T>
+	class ring_t {
+
+		std::vector<T> slots;
+		std::size_t head = 0;
+		std::size_t count = 0;
+
+	public:
+
+		T& operator[](std::size_t i) { return slots[(head + i) & (slots.size() - 1)]; }
+		const T& operator[](std::size_t i) const { return slots[(head + i) & (slots.size() - 1)]; }
+		T& front() { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+		T& back() { return (*this)[count - 1]; }
+		const T& back() const { return (*this)[count - 1]; }
+		std::size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		void push_back(T value) {
+			if(count == slots.size()) {
+				std::vector<T> grown(std::max<std::size_t>(16, 2 * slots.size()));
+				for(std::size_t i = 0; i < count; ++i) {
+					grown[i] = std::move((*this)[i]);
+				}
+				slots.swap(grown);
+				head = 0;
+			}
+			slots[(head + count) & (slots.size() - 1)] = std::move(value);
+			++count;
+		}
+
+		void pop_front() {
+			head = (head + 1) & (slots.size() - 1);
+			--count;
+		}
+
+		template <class archive_t>
+		void save(archive_t& out) const {
+			out.put(static_cast<std::uint64_t>(count));
+			for(std::size_t i = 0; i < count; ++i) out.put((*this)[i]);
+		}
+
+		// Replaces the contents with saved ones.
+		template <class archive_t>
+		bool restore(archive_t& in) {
+			std::uint64_t n;
+			if(!in.get(n)) return false;
+			while(!empty()) pop_front();
+			for(std::uint64_t i = 0; i < n; ++i) {
+				T value;
+				if(!in.get(value)) return false;
+				push_back(std::move(value));
+			}
+			return true;
+		}
+
+	};
+
+	// Fixes still referenced by the pipeline. Iterators hold absolute fix numbers,
+	// so they stay valid while new fixes are appended and older ones dropped.
+	template <class fix_type>
+	class track_t {
+
+		ring_t<fix_type> fixes;
+		std::size_t base = 0;
+
+	public:
+
+		class iterator {
+
+			track_t* track = nullptr;
+			std::size_t index = 0;
+
+		public:
+
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = fix_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			iterator() = default;
+
+			iterator(track_t* track, std::size_t index) :
+				track(track),
+				index(index)
+			{}
+
+			reference operator*() const { return track->fixes[index - track->base]; }
+			pointer operator->() const { return &**this; }
+			iterator& operator++() { ++index; return *this; }
+			iterator operator++(int) { auto copy = *this; ++index; return copy; }
+			iterator& operator--() { --index; return *this; }
+			iterator& operator+=(difference_type n) { index += n; return *this; }
+			iterator operator+(difference_type n) const { return iterator(track, index + n); }
+			difference_type operator-(const iterator& other) const { return index - other.index; }
+			bool operator==(const iterator& other) const { return index == other.index; }
+			bool operator!=(const iterator& other) const { return index != other.index; }
+			bool operator<(const iterator& other) const { return index < other.index; }
+
+			std::size_t number() const { return index; }
+
+		};
+
+		iterator push(fix_type fix) {
+			fixes.push_back(std::move(fix));
+			return iterator(this, base + fixes.size() - 1);
+		}
+
+		void drop_before(const iterator& it) {
+			while(base < it.number() && !fixes.empty()) {
+				fixes.pop_front();
+				++base;
+			}
+		}
+
+		// Fixes currently held.
+		std::size_t size() const {
+			return fixes.size();
+		}
+
+		iterator at(std::size_t number) {
+			return iterator(this, number);
+		}
+
+		template <class archive_t>
+		void save(archive_t& out) const {
+			out.put(static_cast<std::uint64_t>(base));
+			fixes.save(out);
+		}
+
+		template <class archive_t>
+		bool restore(archive_t& in) {
+			std::uint64_t b;
+			if(!in.get(b) || !fixes.restore(in)) return false;
+			base = b;
+			return true;
+		}
+
+	};
+
+	// A finished thermal as plain values, independent of the buffered fixes.
+	struct record_t {
+		units::timestamp begin;
+		units::timestamp end;
+		units::length::meter_t gain_te;
+		units::velocity::meters_per_second_t average;
+		double points;
+		bool local;
+		bool remote;
+	};
+
+	// §5: best thermal and best sum within the scoring window of one class. Thermals
+	// arrive in time order, the window is a queue of the thermals it may still extend.
+	class ranking_t {
+
+		ring_t<record_t> window;
+		double window_points = 0;
+
+	public:
+
+		std::optional<record_t> strongest;
+		double max_points = 0;
+		std::optional<std::pair<units::timestamp, units::timestamp>> max_window;
+
+		void push(const record_t& r, units::time::second_t scoring_window) {
+			if(!strongest || r.points > strongest->points) {
+				strongest = r;
+			}
+
+			window.push_back(r);
+			window_points += r.points;
+			while(window.size() > 1 && r.end - window.front().begin > scoring_window) {
+				window_points -= window.front().points;
+				window.pop_front();
+			}
+			// As find_max_hour, a sum spans at least two thermals.
+			if(window.size() > 1 && window_points > max_points) {
+				max_points = window_points;
+				max_window.emplace(window.front().begin, r.end);
+			}
+		}
+
+		template <class archive_t>
+		void save(archive_t& out) const {
+			window.save(out);
+			out.put(window_points);
+			out.put(strongest);
+			out.put(max_points);
+			out.put(max_window);
+		}
+
+		template <class archive_t>
+		bool restore(archive_t& in) {
+			return window.restore(in) && in.get(window_points) && in.get(strongest) && in.get(max_points) && in.get(max_window);
+		}
+
+	};
+
+	struct result_t {
+		parser::result_t parse;
+		const airport_t* start_airport = nullptr;
+		ranking_t local;
+		ranking_t remote;
+		// Most fixes held at once.
+		std::size_t peak_buffer = 0;
+	};
+
+	namespace detail {
+
+		// Output iterator like sink handing every assigned value to a function.
+		template <class function_t>
+		struct sink_t {
+			function_t f;
+			template <class T>
+			sink_t& operator=(T&& value) {
+				f(std::forward<T>(value));
+				return *this;
+			}
+		};
+
+		template <class function_t>
+		sink_t<function_t> sink(function_t f) {
+			return sink_t<function_t>{ std::move(f) };
+		}
+
+	}
+
+	// Scoring state of one flight, fed one line at a time. handler_t is told about
+	// the start airport by start(const airport_t&) and about every finished thermal
+	// by thermal(const record_t&). Once the buffers have grown to the flight's
+	// longest thermal, lines are scored without allocating. Iterators into the
+	// track point back at the scorer, so it stays where it was constructed.
+	template <class rules, class value_type, class handler_t>
+	class scorer_t {
+
+		using iterator_t = typename track_t<value_type>::iterator;
+
+		handler_t handler;
+		result_t result;
+		track_t<value_type> track;
+		parser::decoder_t<value_type> decoder;
+		detection::detector_t<rules, iterator_t> detector;
+
+		// Class membership of the buffered fixes, aligned with the track.
+		ring_t<std::uint32_t> outside_cylinder;
+		ring_t<std::uint8_t> in_cone;
+		std::size_t class_base = 0;
+		// Grows to the longest thermal, as the track does.
+		energy_scratch_t<iterator_t> energy;
+
+		void finished(thermal_t<iterator_t> t) {
+			optimize(t, energy);
+
+			const std::size_t first = t.begin.number() - class_base;
+			const std::size_t last = t.end.number() - class_base;
+			const record_t r {
+				t.begin->time,
+				t.end->time,
+				t.gain_te,
+				t.average,
+				t.points,
+				outside_cylinder[last + 1] == outside_cylinder[first],
+				!in_cone[first]
+			};
+
+			if(r.local) result.local.push(r, rules::scoring_window);
+			if(r.remote) result.remote.push(r, rules::scoring_window);
+			handler.thermal(r);
+		}
+
+	public:
+
+		scorer_t(parser::policy_t policy, handler_t handler) :
+			handler(std::move(handler)),
+			decoder(policy)
+		{
+			outside_cylinder.push_back(0);
+		}
+
+		scorer_t(const scorer_t&) = delete;
+		scorer_t& operator=(const scorer_t&) = delete;
+
+		void line(std::string_view line) {
+			value_type s;
+			if(!decoder.line(line, s)) return;
+
+			auto it = track.push(std::move(s));
+			if(!result.start_airport) {
+				result.start_airport = &nearest_airport(it->position);
+				handler.start(*result.start_airport);
+			}
+
+			const auto d = units::distance(it->position, result.start_airport->position);
+			const auto height = units::length::meter_t(it->altitude) - result.start_airport->elevation;
+			outside_cylinder.push_back(outside_cylinder.back() + !(d <= rules::cylinder_radius));
+			in_cone.push_back(height * rules::glide_ratio > d);
+
+			auto sink = detail::sink([this](thermal_t<iterator_t> t) { finished(std::move(t)); });
+			detector.push(it, sink);
+
+			result.peak_buffer = std::max(result.peak_buffer, track.size());
+			if(auto oldest = detector.oldest()) {
+				track.drop_before(*oldest);
+				while(class_base < oldest->number()) {
+					outside_cylinder.pop_front();
+					in_cone.pop_front();
+					++class_base;
+				}
+			}
+		}
+
+		// True once an error has stopped the input, further lines are ignored.
+		bool done() const {
+			return decoder.done();
+		}
+
+		// Rankings of the thermals finished so far.
+		const result_t& state() const {
+			return result;
+		}
+
+		// Everything needed to go on after the last line, the rolling window of
+		// fixes, the open and pending thermal and the rankings so far. Small,
+		// the buffers hold no more than the longest thermal.
+		template <class archive_t>
+		void save(archive_t& out) const {
+			decoder.save(out);
+			track.save(out);
+			detector.save(out, [](const iterator_t& it) { return it.number(); });
+			outside_cylinder.save(out);
+			in_cone.save(out);
+			out.put(static_cast<std::uint64_t>(class_base));
+			out.put(static_cast<std::uint64_t>(result.peak_buffer));
+			result.local.save(out);
+			result.remote.save(out);
+			out.put(result.start_airport != nullptr);
+			if(result.start_airport) {
+				out.put(result.start_airport->name);
+				out.put(result.start_airport->position);
+			}
+		}
+
+		// Continues from a saved scorer, in place of one that has read no line.
+		// The handler is not told the start airport again. False if the
+		// snapshot is damaged or its start airport is not the one the loaded
+		// airfields give, the scorer is not usable then.
+		template <class archive_t>
+		bool restore(archive_t& in) {
+			std::uint64_t base, peak;
+			bool started;
+			const bool ok =
+				decoder.restore(in) &&
+				track.restore(in) &&
+				detector.restore(in, [this](std::uint64_t number) { return track.at(number); }) &&
+				outside_cylinder.restore(in) &&
+				in_cone.restore(in) &&
+				in.get(base) &&
+				in.get(peak) &&
+				result.local.restore(in) &&
+				result.remote.restore(in) &&
+				in.get(started);
+			if(!ok) return false;
+			class_base = base;
+			result.peak_buffer = peak;
+
+			result.start_airport = nullptr;
+			if(started) {
+				std::string name;
+				units::gps_position position;
+				if(!in.get(name) || !in.get(position)) return false;
+				result.start_airport = &nearest_airport(position);
+				if(result.start_airport->name != name) return false;
+			}
+			return true;
+		}
+
+		// Ends the flight, a thermal still open is finished.
+		result_t finish() {
+			auto sink = detail::sink([this](thermal_t<iterator_t> t) { finished(std::move(t)); });
+			detector.finish(sink);
+			result.parse = decoder.finish();
+			return std::move(result);
+		}
+
+	};
+
+	namespace detail {
+
+		template <class start_function_t, class thermal_function_t>
+		struct callbacks_t {
+			start_function_t on_start;
+			thermal_function_t on_thermal;
+			void start(const airport_t& ap) { on_start(ap); }
+			void thermal(const record_t& r) { on_thermal(r); }
+		};
+
+	}
+
+	// Runs the whole pipeline over a line oriented input. on_start is called with
+	// the start airport at the first fix, on_thermal with every finished thermal.
+	template <class rules, class value_type, class start_function_t, class thermal_function_t>
+	result_t run(std::istream& input, parser::policy_t policy, start_function_t on_start, thermal_function_t on_thermal) {
+		using handler_t = detail::callbacks_t<start_function_t, thermal_function_t>;
+		scorer_t<rules, value_type, handler_t> scorer(policy, handler_t{ std::move(on_start), std::move(on_thermal) });
+
+		std::string line;
+		while(!scorer.done() && std::getline(input, line)) {
+			scorer.line(line);
+		}
+		return scorer.finish();
+	}
+
+}
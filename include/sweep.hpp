@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <units.h>
+#include <units/gps.hpp>
+
+#include "airports.hpp"
+#include "classification.hpp"
+#include "detection.hpp"
+#include "parallel.hpp"
+#include "scoring.hpp"
+#include "thermal.hpp"
+
+// Scores one flight under many variants of the contest rules. The flight is
+// parsed and the rule independent columns are derived once, every variant is
+// then evaluated on the shared arrays.
+namespace sweep {
+
+	// Runtime counterpart of a ruleset policy.
+	struct rules_t {
+		// Floating average window in fixes.
+		std::size_t window;
+		units::angular_velocity::degrees_per_second_t turn_rate;
+		units::time::second_t merge_gap;
+		units::length::meter_t cylinder_radius;
+		double glide_ratio;
+		units::time::second_t scoring_window;
+
+		template <class rules>
+		static rules_t of() {
+			return rules_t{
+				rules::window,
+				rules::turn_rate,
+				rules::merge_gap,
+				rules::cylinder_radius,
+				rules::glide_ratio,
+				rules::scoring_window
+			};
+		}
+	};
+
+	// Values to try for every parameter. The variants are their cartesian product.
+	struct grid_t {
+		std::vector<std::size_t> window;
+		std::vector<units::angular_velocity::degrees_per_second_t> turn_rate;
+		std::vector<units::time::second_t> merge_gap;
+		std::vector<units::length::meter_t> cylinder_radius;
+		std::vector<double> glide_ratio;
+		std::vector<units::time::second_t> scoring_window;
+
+		// A grid holding only the given variant.
+		explicit grid_t(const rules_t& base) :
+			window{ base.window },
+			turn_rate{ base.turn_rate },
+			merge_gap{ base.merge_gap },
+			cylinder_radius{ base.cylinder_radius },
+			glide_ratio{ base.glide_ratio },
+			scoring_window{ base.scoring_window }
+		{}
+
+		std::vector<rules_t> variants() const {
+			std::vector<rules_t> result;
+			for(auto w : window)
+			for(auto t : turn_rate)
+			for(auto g : merge_gap)
+			for(auto r : cylinder_radius)
+			for(auto q : glide_ratio)
+			for(auto s : scoring_window) {
+				result.push_back(rules_t{ w, t, g, r, q, s });
+			}
+			return result;
+		}
+	};
+
+	template <class iterator_t>
+	struct result_t {
+		rules_t rules;
+		std::vector<thermal_t<iterator_t>> thermals;
+		// Indices into thermals.
+		std::vector<std::uint32_t> local;
+		std::vector<std::uint32_t> remote;
+
+		auto local_thermals() const {
+			return classification::view_t(thermals.cbegin(), local);
+		}
+
+		auto remote_thermals() const {
+			return classification::view_t(thermals.cbegin(), remote);
+		}
+	};
+
+	template <class iterator_t>
+	std::vector<result_t<iterator_t>> run(iterator_t begin, iterator_t end, const airport_t& start, const std::vector<rules_t>& variants, unsigned int threads = std::thread::hardware_concurrency()) {
+		using interval_t = std::pair<std::size_t, std::size_t>;
+		const std::size_t n = std::distance(begin, end);
+
+		// Rule independent columns.
+		const auto turn = detection::turn_rates(begin, end, threads);
+		const auto distance = classification::distances(begin, end, start, std::pmr::get_default_resource(), threads);
+
+		std::vector<result_t<iterator_t>> results(variants.size());
+		std::vector<std::vector<interval_t>> runs(variants.size());
+
+		// Variants sharing a window share the floating average, and all their
+		// thresholds are tested in the same walk over the fixes.
+		std::map<std::size_t, std::vector<std::size_t>> by_window;
+		for(std::size_t v = 0; v < variants.size(); ++v) {
+			by_window[variants[v].window].push_back(v);
+		}
+
+		for(const auto& [window, members] : by_window) {
+			const auto average = detection::floating_average(turn, window);
+
+			std::vector<double> threshold(members.size());
+			for(std::size_t m = 0; m < members.size(); ++m) {
+				threshold[m] = variants[members[m]].turn_rate.template to<double>();
+			}
+			std::vector<std::uint8_t> circling(members.size(), 0);
+			std::vector<std::uint8_t> was_circling(members.size(), 0);
+			std::vector<std::size_t> open(members.size(), 0);
+
+			for(std::size_t i = 0; i < n; ++i) {
+				const double a = units::math::abs(average[i]).template to<double>();
+				for(std::size_t m = 0; m < members.size(); ++m) {
+					circling[m] = a >= threshold[m];
+				}
+				for(std::size_t m = 0; m < members.size(); ++m) {
+					if(circling[m] != was_circling[m]) {
+						if(circling[m]) {
+							open[m] = i;
+						} else {
+							runs[members[m]].emplace_back(open[m], i);
+						}
+						was_circling[m] = circling[m];
+					}
+				}
+			}
+			for(std::size_t m = 0; m < members.size(); ++m) {
+				if(was_circling[m] && open[m] + 1 < n) {
+					runs[members[m]].emplace_back(open[m], n - 1);
+				}
+			}
+		}
+
+		// optimize() only depends on the interval, variants finding the same thermal share it.
+		std::vector<std::vector<thermal_t<iterator_t>>> merged(variants.size());
+		std::map<interval_t, thermal_t<iterator_t>> optimized;
+		for(std::size_t v = 0; v < variants.size(); ++v) {
+			for(const auto& run : runs[v]) {
+				thermal_t<iterator_t> thermal(begin + run.first, begin + run.second);
+				if(thermal.points <= 0) continue;
+				if(!merged[v].empty() && thermal.begin->time - merged[v].back().end->time <= variants[v].merge_gap) {
+					merged[v].back() = thermal_t<iterator_t>(merged[v].back().begin, thermal.end);
+				} else {
+					merged[v].push_back(thermal);
+				}
+			}
+			for(const auto& thermal : merged[v]) {
+				optimized.emplace(interval_t(thermal.begin - begin, thermal.end - begin), thermal);
+			}
+		}
+
+		// Longest first, as in pipeline::score.
+		std::vector<thermal_t<iterator_t>*> pending;
+		for(auto& [key, t] : optimized) pending.push_back(&t);
+		std::stable_sort(pending.begin(), pending.end(), [](const auto* a, const auto* b) {
+			return a->end - a->begin > b->end - b->begin;
+		});
+		optimize_each<iterator_t>(pending.size(), [&](std::size_t i) -> thermal_t<iterator_t>& {
+			return *pending[i];
+		}, std::pmr::get_default_resource(), threads);
+
+		for(std::size_t v = 0; v < variants.size(); ++v) {
+			const auto& rules = variants[v];
+			auto& result = results[v];
+			result.rules = rules;
+
+			const classification::classes_t classes(begin, distance, start, rules.cylinder_radius, rules.glide_ratio, std::pmr::get_default_resource(), threads);
+
+			for(const auto& thermal : merged[v]) {
+				const auto& t = optimized.at(interval_t(thermal.begin - begin, thermal.end - begin));
+				const std::uint32_t index = result.thermals.size();
+				result.thermals.push_back(t);
+
+				const std::size_t first = t.begin - begin;
+				const std::size_t last = t.end - begin;
+				if(classes.local(first, last)) result.local.push_back(index);
+				if(classes.remote(first)) result.remote.push_back(index);
+			}
+		}
+
+		return results;
+	}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <algorithm>
+#include <units.h>
+
+template <class iterator_t>
+struct thermal_t {
+	iterator_t begin;
+	iterator_t end;
+	units::length::meter_t gain;
+	units::length::meter_t gain_te;
+	units::velocity::meters_per_second_t average;
+	double points;
+
+	thermal_t(
+		iterator_t begin,
+		iterator_t end
+	) :
+		begin(begin),
+		end(end),
+		gain(end->altitude - begin->altitude),
+		gain_te(
+			gain +
+			((
+				units::math::pow<2>(end->true_air_speed) -
+				units::math::pow<2>(begin->true_air_speed)
+			) /
+				units::acceleration::standard_gravity_t(2))
+		),
+		average(gain_te/ (end->time - begin->time)),
+		points(std::max(gain_te.to<double>(),0.0) * average.to<double>())
+	{
+	}
+};
@@ -0,0 +1,114 @@
+#ifndef THERMIK_H
+#define THERMIK_H
+
+// C interface of libthermik, for programs that score flights in process. Every
+// struct has a fixed layout. THERMIK_ABI_VERSION changes whenever a struct or
+// a function changes incompatibly, compare it with thermik_abi_version() of
+// the loaded library.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__)
+#define THERMIK_API __attribute__((visibility("default")))
+#else
+#define THERMIK_API
+#endif
+
+#define THERMIK_ABI_VERSION 2
+
+typedef enum {
+	THERMIK_OK = 0,
+	// Compressed in a way this build can not read, or a bundle of flights.
+	THERMIK_UNSUPPORTED = 1,
+	// The compressed data is corrupt or ends early.
+	THERMIK_DAMAGED = 2,
+	// Reading stopped before the first fix.
+	THERMIK_INVALID = 3,
+	// The file holds no usable fix.
+	THERMIK_NO_FIXES = 4,
+	// The flight has more thermals than the caller made room for. The summary
+	// is complete, the first capacity thermals are written.
+	THERMIK_TRUNCATED = 5,
+	// A null context or output pointer.
+	THERMIK_ARGUMENT = 6,
+	THERMIK_NO_MEMORY = 7,
+	// Any other failure inside the library, such as a thread that could not
+	// be started. The summary is empty, the context stays usable.
+	THERMIK_INTERNAL = 8
+} thermik_status;
+
+// Reuses its memory from flight to flight. Not thread safe, use one context
+// per thread.
+typedef struct thermik_context thermik_context;
+
+typedef struct {
+	// Seconds of the UTC day.
+	int32_t begin;
+	int32_t end;
+	// Total energy compensated height gain in m.
+	double gain_te;
+	// Average climb in m/s.
+	double average;
+	double points;
+	uint8_t local;
+	uint8_t remote;
+	uint8_t reserved[6];
+} thermik_thermal;
+
+typedef struct {
+	uint8_t has_strongest;
+	uint8_t has_window;
+	uint8_t reserved[6];
+	thermik_thermal strongest;
+	// Best sum of points within the scoring window and its time span.
+	double window_points;
+	int32_t window_begin;
+	int32_t window_end;
+} thermik_ranking;
+
+typedef struct {
+	// Name of the nearest airport to the first fix, null without fixes. Valid
+	// until the next call on the context.
+	const char* start_airport;
+	// All thermals of the flight, may be more than were written.
+	uint64_t thermals;
+	// Decoded and skipped B records.
+	uint64_t records;
+	uint64_t skipped;
+	thermik_ranking local;
+	thermik_ranking remote;
+} thermik_summary;
+
+THERMIK_API int thermik_abi_version(void);
+
+// rules null selects the default ruleset, threads 0 all cores. Returns null if
+// the ruleset does not exist.
+THERMIK_API thermik_context* thermik_create(const char* rules, unsigned int threads);
+
+THERMIK_API void thermik_destroy(thermik_context* context);
+
+// Scores one plain or compressed IGC file of size bytes. Thermals are written
+// to thermals in order of time, at most capacity of them, thermals may be null
+// if capacity is 0. summary must not be null.
+THERMIK_API thermik_status thermik_analyse(
+	thermik_context* context,
+	const void* data,
+	size_t size,
+	thermik_thermal* thermals,
+	size_t capacity,
+	thermik_summary* summary
+);
+
+// German description of a status, for messages.
+THERMIK_API const char* thermik_describe(thermik_status status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
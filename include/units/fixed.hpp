@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <units.h>
+
+namespace units {
+
+// Seconds of the UTC day, as logged in a B record. Differences are exact integers
+// and wrap around midnight, so a flight crossing 00:00 UTC keeps positive deltas.
+class timestamp {
+
+	std::int32_t seconds = 0;
+
+public:
+
+	static constexpr std::int32_t day = 24 * 60 * 60;
+
+	timestamp() = default;
+
+	explicit constexpr timestamp(std::int32_t seconds_of_day) :
+		seconds(seconds_of_day)
+	{}
+
+	constexpr std::int32_t count() const {
+		return seconds;
+	}
+
+	operator units::time::second_t() const {
+		return units::time::second_t(seconds);
+	}
+
+	// Shortest signed distance on the 24h circle, in whole seconds.
+	friend constexpr std::int32_t delta(timestamp from, timestamp to) {
+		std::int32_t d = to.seconds - from.seconds;
+		d += (d < -day / 2) * day;
+		d -= (d >= day / 2) * day;
+		return d;
+	}
+
+	friend units::time::second_t operator-(timestamp lhs, timestamp rhs) {
+		return units::time::second_t(delta(rhs, lhs));
+	}
+
+};
+
+// Altitude in whole meters, the resolution of the B record.
+class altitude {
+
+	std::int32_t meters = 0;
+
+public:
+
+	altitude() = default;
+
+	explicit constexpr altitude(std::int32_t meters) :
+		meters(meters)
+	{}
+
+	constexpr std::int32_t count() const {
+		return meters;
+	}
+
+	operator units::length::meter_t() const {
+		return units::length::meter_t(meters);
+	}
+
+	friend units::length::meter_t operator-(altitude lhs, altitude rhs) {
+		return units::length::meter_t(lhs.meters - rhs.meters);
+	}
+
+};
+
+}
@@ -1,14 +1,17 @@
 #pragma once
 
+#include <cstdint>
 #include <ostream>
+#include <string>
 #include <units.h>
 
 namespace units {
 
 class gps_position {
 
-	// Latitude and longitude in °, negative values indicating S/W;
-	double latitude, longitude;
+	// Latitude and longitude in thousandths of an arc minute, the native IGC
+	// resolution, negative values indicating S/W.
+	std::int32_t latitude = 0, longitude = 0;
 	friend std::ostream& operator<<(std::ostream& lhs, const gps_position& rhs);
 	friend units::length::meter_t distance(const gps_position& pos1, const gps_position& pos2);
 	friend units::angle::degree_t forward_azimuth(const gps_position& pos1, const gps_position& pos2);
@@ -20,6 +23,11 @@ public:
 	gps_position(const std::string& latitude, const std::string& longitude);
 	gps_position(double lat_deg, double lat_min, char n, double lon_deg, double lon_min, char e);
 
+	static gps_position from_milliminutes(std::int32_t latitude, std::int32_t longitude);
+
+	std::int32_t latitude_milliminutes() const { return latitude; }
+	std::int32_t longitude_milliminutes() const { return longitude; }
+
 };
 
 std::ostream& operator<<(std::ostream& lhs, const gps_position& rhs);
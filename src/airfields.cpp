@@ -0,0 +1,439 @@
+#include "airfields.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+
+#include "io/replace.hpp"
+
+namespace airfields {
+
+namespace {
+
+constexpr std::string_view kind = "THKAPT";
+constexpr std::uint8_t version = 1;
+
+// Half a degree in milliminutes.
+constexpr std::int32_t cell_size = 30000;
+
+// As units::distance.
+constexpr double earth_radius = 6371000;
+
+// Fields of one CSV line, quotes removed.
+std::vector<std::string> split(std::string_view line) {
+	std::vector<std::string> fields(1);
+	bool quoted = false;
+	for(std::size_t i = 0; i < line.size(); ++i) {
+		const char c = line[i];
+		if(quoted) {
+			if(c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+				fields.back() += '"';
+				++i;
+			} else if(c == '"') {
+				quoted = false;
+			} else {
+				fields.back() += c;
+			}
+		} else if(c == '"') {
+			quoted = true;
+		} else if(c == ',') {
+			fields.emplace_back();
+		} else {
+			fields.back() += c;
+		}
+	}
+	return fields;
+}
+
+std::string lower(std::string text) {
+	for(auto& c : text) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+	return text;
+}
+
+// DDMM.mmmN or DDDMM.mmmE to signed milliminutes.
+bool coordinate(const std::string& text, char positive, char negative, std::int32_t& value) {
+	if(text.size() < 2) return false;
+	const char hemisphere = static_cast<char>(std::toupper(static_cast<unsigned char>(text.back())));
+	if(hemisphere != positive && hemisphere != negative) return false;
+
+	const std::string number = text.substr(0, text.size() - 1);
+	char* end = nullptr;
+	const double v = std::strtod(number.c_str(), &end);
+	if(number.empty() || *end != '\0' || v < 0) return false;
+
+	const double degrees = std::floor(v / 100);
+	const double minutes = v - degrees * 100;
+	if(minutes >= 60) return false;
+	value = static_cast<std::int32_t>(std::lround(degrees * 60000 + minutes * 1000));
+	if(hemisphere == negative) value = -value;
+	return true;
+}
+
+// 230.0m, 755ft or a plain number of meters.
+bool elevation(const std::string& text, double& meters) {
+	char* end = nullptr;
+	meters = std::strtod(text.c_str(), &end);
+	if(end == text.c_str()) return false;
+	const std::string unit = lower(end);
+	if(unit == "ft") meters *= 0.3048;
+	else if(!unit.empty() && unit != "m") return false;
+	return true;
+}
+
+}
+
+cup_t read_cup(std::string_view text) {
+	cup_t result;
+	std::size_t name = 0, lat = 3, lon = 4, elev = 5, style = 6;
+	bool first = true;
+
+	while(!text.empty()) {
+		const auto end = text.find('\n');
+		auto line = text.substr(0, end);
+		text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+		if(!line.empty() && line.back() == '\r') line.remove_suffix(1);
+		if(first && line.substr(0, 3) == "\xEF\xBB\xBF") line.remove_prefix(3);
+		if(line.empty()) continue;
+		// Tasks follow the waypoints.
+		if(line.substr(0, 5) == "-----") break;
+
+		const auto fields = split(line);
+		if(lower(fields[0]) == "name") {
+			// Header, possibly repeated in concatenated files.
+			for(std::size_t i = 0; i < fields.size(); ++i) {
+				const auto f = lower(fields[i]);
+				if(f == "name") name = i;
+				else if(f == "lat" || f == "latitude") lat = i;
+				else if(f == "lon" || f == "longitude") lon = i;
+				else if(f == "elev" || f == "elevation") elev = i;
+				else if(f == "style") style = i;
+			}
+			first = false;
+			continue;
+		}
+		first = false;
+
+		if(std::max({ name, lat, lon, elev, style }) >= fields.size()) {
+			++result.skipped;
+			continue;
+		}
+		const int s = std::atoi(fields[style].c_str());
+		std::int32_t latitude, longitude;
+		double meters;
+		if(
+			(s != 2 && s != 4 && s != 5) ||
+			!coordinate(fields[lat], 'N', 'S', latitude) ||
+			!coordinate(fields[lon], 'E', 'W', longitude) ||
+			!elevation(fields[elev], meters)
+		) {
+			++result.skipped;
+			continue;
+		}
+		result.airports.push_back(airport_t{
+			fields[name],
+			units::gps_position::from_milliminutes(latitude, longitude),
+			units::length::meter_t(meters)
+		});
+	}
+	return result;
+}
+
+// Follows the header of io::replace.
+struct database_t::header_t {
+	std::uint32_t count;
+	// Grid of cell x cell milliminutes, row 0 and column 0 at lat0, lon0.
+	std::int32_t cell;
+	std::int32_t lat0;
+	std::int32_t lon0;
+	std::uint32_t rows;
+	std::uint32_t cols;
+	std::uint32_t names_size;
+};
+
+// Sorted by cell, names in the order of the source.
+struct database_t::entry_t {
+	std::int32_t latitude;
+	std::int32_t longitude;
+	float elevation;
+	std::uint32_t name;
+	std::uint32_t name_size;
+};
+
+// Layout: file header, header, entries, (rows * cols + 1) first entries of each cell, names.
+std::string compile(const std::vector<airport_t>& airports) {
+	using header_t = database_t::header_t;
+	using entry_t = database_t::entry_t;
+
+	header_t header{};
+	header.count = static_cast<std::uint32_t>(airports.size());
+	header.cell = cell_size;
+
+	std::int32_t lat_max = 0, lon_max = 0;
+	if(!airports.empty()) {
+		header.lat0 = lat_max = airports.front().position.latitude_milliminutes();
+		header.lon0 = lon_max = airports.front().position.longitude_milliminutes();
+	}
+	for(const auto& a : airports) {
+		header.lat0 = std::min(header.lat0, a.position.latitude_milliminutes());
+		header.lon0 = std::min(header.lon0, a.position.longitude_milliminutes());
+		lat_max = std::max(lat_max, a.position.latitude_milliminutes());
+		lon_max = std::max(lon_max, a.position.longitude_milliminutes());
+	}
+	header.rows = airports.empty() ? 0 : (lat_max - header.lat0) / cell_size + 1;
+	header.cols = airports.empty() ? 0 : (lon_max - header.lon0) / cell_size + 1;
+
+	auto cell_of = [&](const airport_t& a) {
+		const std::uint32_t row = (a.position.latitude_milliminutes() - header.lat0) / cell_size;
+		const std::uint32_t col = (a.position.longitude_milliminutes() - header.lon0) / cell_size;
+		return row * header.cols + col;
+	};
+
+	std::vector<std::uint32_t> order(airports.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+		return cell_of(airports[a]) < cell_of(airports[b]);
+	});
+
+	std::string names;
+	std::vector<std::uint32_t> name_offset(airports.size());
+	for(std::size_t i = 0; i < airports.size(); ++i) {
+		name_offset[i] = static_cast<std::uint32_t>(names.size());
+		names += airports[i].name;
+	}
+	header.names_size = static_cast<std::uint32_t>(names.size());
+
+	std::vector<entry_t> entries;
+	std::vector<std::uint32_t> cells(std::size_t(header.rows) * header.cols + 1, 0);
+	for(auto i : order) {
+		const auto& a = airports[i];
+		entries.push_back(entry_t{
+			a.position.latitude_milliminutes(),
+			a.position.longitude_milliminutes(),
+			a.elevation.to<float>(),
+			name_offset[i],
+			static_cast<std::uint32_t>(a.name.size())
+		});
+		++cells[cell_of(a) + 1];
+	}
+	std::partial_sum(cells.begin(), cells.end(), cells.begin());
+
+	std::string result = io::header(kind, version);
+	result.append(reinterpret_cast<const char*>(&header), sizeof(header));
+	result.append(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(entry_t));
+	result.append(reinterpret_cast<const char*>(cells.data()), cells.size() * sizeof(std::uint32_t));
+	result += names;
+	return result;
+}
+
+bool database_t::attach(std::string_view bytes) {
+	std::string_view rest = bytes;
+	header_t header;
+	if(io::check_header(rest, kind, version) != io::header_t::valid || rest.size() < sizeof(header)) return false;
+	std::memcpy(&header, rest.data(), sizeof(header));
+	if(header.cell <= 0) return false;
+
+	const std::uint64_t cells = std::uint64_t(header.rows) * header.cols + 1;
+	const std::uint64_t size =
+		io::header_size +
+		sizeof(header_t) +
+		std::uint64_t(header.count) * sizeof(entry_t) +
+		cells * sizeof(std::uint32_t) +
+		header.names_size;
+	if(size != bytes.size()) return false;
+
+	// A damaged cache is rebuilt, it must not lead nearest() out of its bounds.
+	const char* entries = rest.data() + sizeof(header_t);
+	const char* firsts = entries + std::size_t(header.count) * sizeof(entry_t);
+	std::uint32_t previous = 0;
+	for(std::uint64_t i = 0; i < cells; ++i) {
+		std::uint32_t v;
+		std::memcpy(&v, firsts + i * sizeof(v), sizeof(v));
+		if(v < previous || v > header.count) return false;
+		previous = v;
+	}
+	if(previous != header.count) return false;
+	for(std::uint32_t i = 0; i < header.count; ++i) {
+		entry_t e;
+		std::memcpy(&e, entries + std::size_t(i) * sizeof(entry_t), sizeof(e));
+		if(std::uint64_t(e.name) + e.name_size > header.names_size) return false;
+	}
+
+	data = bytes;
+	count = header.count;
+	cell = header.cell;
+	lat0 = header.lat0;
+	lon0 = header.lon0;
+	rows = header.rows;
+	cols = header.cols;
+	entries_offset = io::header_size + sizeof(header_t);
+	cells_offset = entries_offset + std::size_t(count) * sizeof(entry_t);
+	names_offset = cells_offset + cells * sizeof(std::uint32_t);
+	return true;
+}
+
+database_t::entry_t database_t::entry(std::uint32_t index) const {
+	entry_t e;
+	std::memcpy(&e, data.data() + entries_offset + std::size_t(index) * sizeof(entry_t), sizeof(e));
+	return e;
+}
+
+std::uint32_t database_t::first(std::size_t cell_index) const {
+	std::uint32_t v;
+	std::memcpy(&v, data.data() + cells_offset + cell_index * sizeof(v), sizeof(v));
+	return v;
+}
+
+std::unique_ptr<database_t> database_t::open(const std::string& path) {
+	auto db = std::make_unique<database_t>();
+	db->file = io::mapped_file(path);
+	if(!db->file || !db->attach(db->file.view())) return nullptr;
+	return db;
+}
+
+std::unique_ptr<database_t> database_t::from(std::string bytes) {
+	auto db = std::make_unique<database_t>();
+	db->buffer = std::move(bytes);
+	if(!db->attach(db->buffer)) return nullptr;
+	return db;
+}
+
+const airport_t* database_t::nearest(const units::gps_position& position, units::length::meter_t& distance) const {
+	if(count == 0) return nullptr;
+
+	const std::int64_t lat = position.latitude_milliminutes();
+	const std::int64_t lon = position.longitude_milliminutes();
+	auto row_of = [&](std::int64_t v) {
+		return std::clamp<std::int64_t>(v < lat0 ? -1 : (v - lat0) / cell, 0, rows - 1);
+	};
+	auto col_of = [&](std::int64_t v) {
+		return std::clamp<std::int64_t>(v < lon0 ? -1 : (v - lon0) / cell, 0, cols - 1);
+	};
+
+	bool found = false;
+	entry_t best{};
+	units::length::meter_t best_distance(0);
+	auto scan = [&](std::int64_t row, std::int64_t col) {
+		const std::size_t index = std::size_t(row) * cols + col;
+		for(std::uint32_t i = first(index), end = first(index + 1); i < end; ++i) {
+			const auto e = entry(i);
+			const auto d = units::distance(position, units::gps_position::from_milliminutes(e.latitude, e.longitude));
+			// Ties go to the airfield listed first in the source.
+			if(!found || d < best_distance || (d == best_distance && e.name < best.name)) {
+				found = true;
+				best = e;
+				best_distance = d;
+			}
+		}
+	};
+
+	// Rings of cells around the position until one holds an airfield.
+	const std::int64_t r0 = row_of(lat), c0 = col_of(lon);
+	for(std::int64_t ring = 0; !found && ring <= std::max(rows, cols); ++ring) {
+		for(std::int64_t r = r0 - ring; r <= r0 + ring; ++r) {
+			if(r < 0 || r >= rows) continue;
+			const bool edge = r == r0 - ring || r == r0 + ring;
+			for(std::int64_t c = c0 - ring; c <= c0 + ring; c += edge ? 1 : 2 * std::max<std::int64_t>(ring, 1)) {
+				if(c >= 0 && c < cols) scan(r, c);
+			}
+		}
+	}
+
+	// Every airfield closer than the one found lies within this box. From the
+	// haversine formula, sin(dlon / 2) <= sin(d / 2R) / cos(lat) at the
+	// latitude of the box farthest from the equator.
+	const double angle = best_distance.to<double>() / earth_radius;
+	const std::int64_t dlat = static_cast<std::int64_t>(std::ceil(angle * 180 / M_PI * 60000)) + 1;
+	const double pole = std::min(90.0, (std::abs(lat) + dlat) / 60000.0);
+	const double s = std::sin(angle / 2) / std::cos(pole * M_PI / 180);
+	const std::int64_t dlon = s >= 1 ? std::int64_t(360) * 60000 : static_cast<std::int64_t>(std::ceil(2 * std::asin(s) * 180 / M_PI * 60000)) + 1;
+
+	const std::int64_t row_begin = row_of(lat - dlat), row_end = row_of(lat + dlat);
+	const std::int64_t col_begin = col_of(lon - dlon), col_end = col_of(lon + dlon);
+	for(std::int64_t r = row_begin; r <= row_end; ++r) {
+		for(std::int64_t c = col_begin; c <= col_end; ++c) {
+			scan(r, c);
+		}
+	}
+
+	distance = best_distance;
+
+	std::lock_guard<std::mutex> guard(lock);
+	auto& slot = by_index[best.name];
+	if(!slot) {
+		materialized.push_back(airport_t{
+			std::string(data.substr(names_offset + best.name, best.name_size)),
+			units::gps_position::from_milliminutes(best.latitude, best.longitude),
+			units::length::meter_t(best.elevation)
+		});
+		slot = &materialized.back();
+	}
+	return slot;
+}
+
+std::unique_ptr<database_t> load(const std::string& path, std::string& error) {
+	io::mapped_file source(path);
+	if(!source) {
+		error = "Datei " + path + " kann nicht gelesen werden.";
+		return nullptr;
+	}
+	std::string_view head = source.view();
+	if(io::check_header(head, kind, version) != io::header_t::foreign) {
+		auto db = database_t::open(path);
+		if(!db) error = "Cache " + path + " ist beschädigt.";
+		return db;
+	}
+
+	const std::string cache = path + ".cache";
+	std::error_code source_ec, cache_ec;
+	const auto source_time = std::filesystem::last_write_time(path, source_ec);
+	const auto cache_time = std::filesystem::last_write_time(cache, cache_ec);
+	if(!source_ec && !cache_ec && cache_time >= source_time) {
+		if(auto db = database_t::open(cache)) return db;
+	}
+
+	const auto cup = read_cup(source.view());
+	if(cup.airports.empty()) {
+		error = "Keine Flugplätze in " + path + ".";
+		return nullptr;
+	}
+	std::string bytes = compile(cup.airports);
+
+	// Replaced as a whole, so a concurrent reader never maps half a cache.
+	if(io::replace(cache, bytes)) {
+		if(auto db = database_t::open(cache)) return db;
+	}
+	// Read only directory, use the compiled bytes this time.
+	return database_t::from(std::move(bytes));
+}
+
+namespace {
+
+std::vector<std::unique_ptr<database_t>>& databases() {
+	static std::vector<std::unique_ptr<database_t>> list;
+	return list;
+}
+
+}
+
+void use(std::unique_ptr<database_t> db) {
+	if(db) databases().push_back(std::move(db));
+}
+
+const airport_t* nearest(const units::gps_position& position) {
+	const airport_t* result = nullptr;
+	units::length::meter_t best(0);
+	for(const auto& db : databases()) {
+		units::length::meter_t d(0);
+		const auto* a = db->nearest(position, d);
+		if(a && (!result || d < best)) {
+			result = a;
+			best = d;
+		}
+	}
+	return result;
+}
+
+}
@@ -0,0 +1,59 @@
+#include "analysis.hpp"
+
+#include <istream>
+#include <iterator>
+
+#include "io/decompressor.hpp"
+
+namespace analysis {
+
+const char* describe(status_t status) {
+	switch(status) {
+		case status_t::ok: return "in Ordnung";
+		case status_t::unknown_rules: return "unbekannte Ausschreibung";
+		case status_t::unsupported: return "Kompression oder Archiv wird nicht unterstützt";
+		case status_t::damaged: return "Datei ist beschädigt";
+		case status_t::invalid: return "Datei kann nicht gelesen werden";
+		case status_t::no_fixes: return "keine Fixes";
+	}
+	return "unbekannter Status";
+}
+
+context_t::context_t(std::string rules, unsigned int threads) :
+	rules(std::move(rules)),
+	threads(threads)
+{
+	flight.emplace(arena.get());
+}
+
+status_t context_t::analyse(std::string_view data) {
+	flight.reset();
+	arena.reset();
+	flight.emplace(arena.get());
+
+	const auto format = io::detect(data);
+	if(format.container != io::container_t::none || !io::supported(format.compression)) {
+		return status_t::unsupported;
+	}
+
+	std::pmr::vector<sample_t> samples(arena.get());
+	if(format.compression == io::compression_t::none) {
+		flight->parse = parser::parse_parallel(data, samples, parser::policy_t::skip, threads);
+	} else {
+		io::decompressor buffer(data, format.compression);
+		std::istream input(&buffer);
+		flight->parse = parser::parse(input, std::back_inserter(samples), parser::policy_t::skip);
+		if(buffer.failed()) return status_t::damaged;
+	}
+	if(flight->parse.error != parser::error_t::none) return status_t::invalid;
+	if(samples.empty()) return status_t::no_fixes;
+
+	const bool found = ruleset::dispatch(rules, [&](auto r) {
+		using rules_t = decltype(r);
+		const auto score = pipeline::score<rules_t>(samples.cbegin(), samples.cend(), arena.get(), nullptr, threads);
+		summarize<rules_t>(score, *flight);
+	});
+	return found ? status_t::ok : status_t::unknown_rules;
+}
+
+}
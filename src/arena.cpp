@@ -0,0 +1,33 @@
+#include "arena.hpp"
+
+arena_t::arena_t(std::size_t initial_capacity) :
+	buffer(new std::byte[initial_capacity]),
+	capacity(initial_capacity)
+{
+	resource.emplace(buffer.get(), capacity, &overflow);
+}
+
+void arena_t::reset() {
+	resource->release();
+	if(overflow.bytes == 0) return;
+
+	// The last flight did not fit, grow the buffer to what it needed.
+	capacity += overflow.bytes;
+	overflow.bytes = 0;
+	resource.reset();
+	buffer.reset(new std::byte[capacity]);
+	resource.emplace(buffer.get(), capacity, &overflow);
+}
+
+void* arena_t::overflow_t::do_allocate(std::size_t size, std::size_t alignment) {
+	bytes += size;
+	return std::pmr::new_delete_resource()->allocate(size, alignment);
+}
+
+void arena_t::overflow_t::do_deallocate(void* p, std::size_t size, std::size_t alignment) {
+	std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+}
+
+bool arena_t::overflow_t::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
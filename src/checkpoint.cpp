@@ -0,0 +1,47 @@
+#include "checkpoint.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "io/replace.hpp"
+
+namespace checkpoint {
+
+namespace {
+
+// The file header is followed by the size of a pointer.
+constexpr std::string_view kind = "THKSNP";
+
+}
+
+bool save(const std::string& path, const writer_t& snapshot) {
+	std::string bytes = io::header(kind, version);
+	const std::uint32_t pointer = sizeof(void*);
+	bytes.append(reinterpret_cast<const char*>(&pointer), sizeof(pointer));
+	bytes += snapshot.data();
+	return io::replace(path, bytes);
+}
+
+std::optional<std::string> load(const std::string& path, std::string& error) {
+	error.clear();
+	std::ifstream in(path, std::ios::binary);
+	if(!in) return std::nullopt;
+	std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	std::string_view rest = bytes;
+	const auto header = io::check_header(rest, kind, version);
+	if(header == io::header_t::foreign) {
+		error = "Datei " + path + " ist keine Sicherung.";
+		return std::nullopt;
+	}
+	std::uint32_t pointer = 0;
+	if(header == io::header_t::valid && rest.size() >= sizeof(pointer)) std::memcpy(&pointer, rest.data(), sizeof(pointer));
+	if(pointer != sizeof(void*)) {
+		error = "Sicherung " + path + " stammt von einer anderen Version.";
+		return std::nullopt;
+	}
+	return std::string(rest.substr(sizeof(pointer)));
+}
+
+}
@@ -0,0 +1,484 @@
+#include "emit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace emit {
+
+namespace {
+
+void time(io::writer& out, units::timestamp t) {
+	const int s = t.count();
+	const char text[] = {
+		char('0' + s / 36000), char('0' + s / 3600 % 10), ':',
+		char('0' + s / 600 % 6), char('0' + s / 60 % 10), ':',
+		char('0' + s % 60 / 10), char('0' + s % 10)
+	};
+	out.write(std::string_view(text, sizeof(text)));
+}
+
+const char* class_name(class_t c) {
+	switch(c) {
+		case class_t::local: return "lokal";
+		case class_t::remote: return "ueberland";
+		case class_t::flight: break;
+	}
+	return "flug";
+}
+
+class text_t : public emitter_t {
+
+	io::writer& out;
+
+	// As date_time prints, without leading zeros.
+	void time(units::timestamp t) {
+		const int s = t.count();
+		out.number(std::int64_t(s / 3600)).put(':').number(std::int64_t(s / 60 % 60)).put(':').number(std::int64_t(s % 60));
+	}
+
+	void line(const stream::record_t& r) {
+		out.write("Von ");
+		time(r.begin);
+		out.write(" bis ");
+		time(r.end);
+		out.write(" mit ").number(r.gain_te.to<double>(), 6)
+			.write(" m und ").number(r.average.to<double>(), 6)
+			.write(" mps eribt ").number(r.points, 6)
+			.write(" Punkte\n");
+	}
+
+public:
+
+	explicit text_t(io::writer& out) :
+		out(out)
+	{}
+
+	void file(std::string_view name, bool announce) override {
+		if(announce) out.write("Datei ").write(name).put('\n');
+	}
+
+	void start(const airport_t& airport) override {
+		out.write("Took of on ").write(airport.name).put('\n');
+	}
+
+	void thermal(const stream::record_t& r) override {
+		line(r);
+	}
+
+	void ranking(class_t c, const stream::ranking_t& ranking) override {
+		out.write(c == class_t::local ? "Lokale Wertung:\n" : "Überland Wertung:\n");
+		if(ranking.strongest) {
+			out.write("Stärkster Bart:");
+			line(*ranking.strongest);
+		}
+		if(ranking.max_window) {
+			out.write("60min akkumuliert: ").number(ranking.max_points, 6).write(" Punkte, Wertung von ");
+			time(ranking.max_window->first);
+			out.write(" bis ");
+			time(ranking.max_window->second);
+			out.put('\n');
+		}
+	}
+
+	void top(class_t c, const std::vector<stream::record_t>& thermals) override {
+		switch(c) {
+			case class_t::local: out.write("Beste lokale Bärte:\n"); break;
+			case class_t::remote: out.write("Beste Überland Bärte:\n"); break;
+			case class_t::flight: out.write("Beste Bärte:\n"); break;
+		}
+		for(std::size_t i = 0; i < thermals.size(); ++i) {
+			out.number(std::int64_t(i + 1)).write(". ");
+			line(thermals[i]);
+		}
+	}
+
+	void circles(const stream::record_t&, const circling::summary_t& s, const parser::wind_t* logged) override {
+		out.write("  Kreise: ").number(std::int64_t(s.circles));
+		if(s.circles > 0) {
+			out.write(" (").number(std::int64_t(s.right)).write(" rechts), Radius ").number(s.radius.to<double>(), 4)
+				.write(" m, Abweichung ").number(s.deviation.to<double>(), 3).write(" m");
+		}
+		if(s.has_wind) {
+			out.write(", Wind ").number(s.wind_direction.to<double>(), 3).write("° ").number(s.wind_speed.to<double>(), 3).write(" km/h");
+		}
+		if(logged) {
+			out.write(", Logger ").number(logged->direction.to<double>(), 3).write("° ").number(logged->speed.to<double>(), 3).write(" km/h");
+		}
+		out.put('\n');
+	}
+
+	void duplicate(std::string_view original, double similarity) override {
+		out.write("Doppelt, gleicher Flug wie ").write(original).write(" (Ähnlichkeit ").number(similarity, 3).write(")\n");
+	}
+
+};
+
+class csv_t : public emitter_t {
+
+	io::writer& out;
+	std::string name;
+
+	void field(std::string_view text) {
+		if(text.find_first_of(",\"\n") == std::string_view::npos) {
+			out.write(text);
+			return;
+		}
+		out.put('"');
+		for(char c : text) {
+			if(c == '"') out.put('"');
+			out.put(c);
+		}
+		out.put('"');
+	}
+
+	void row(std::string_view art) {
+		field(name);
+		out.put(',').write(art).put(',');
+	}
+
+	// CSV has no inf or nan, a value that is not finite leaves its field empty.
+	void number(double v) {
+		if(std::isfinite(v)) out.number(v);
+	}
+
+	void values(const stream::record_t& r) {
+		out.put(',');
+		emit::time(out, r.begin);
+		out.put(',');
+		emit::time(out, r.end);
+		out.put(',');
+		number(r.gain_te.to<double>());
+		out.put(',');
+		number(r.average.to<double>());
+		out.put(',');
+		number(r.points);
+		out.put(',').put(r.local ? '1' : '0')
+			.put(',').put(r.remote ? '1' : '0')
+			.put('\n');
+	}
+
+public:
+
+	explicit csv_t(io::writer& out) :
+		out(out)
+	{
+		out.write("datei,art,flugplatz,von,bis,tek_hoehe,steigen,punkte,lokal,ueberland\n");
+	}
+
+	void file(std::string_view name, bool) override {
+		this->name = name;
+	}
+
+	void start(const airport_t& airport) override {
+		row("start");
+		field(airport.name);
+		out.write(",,,,,,,\n");
+	}
+
+	void thermal(const stream::record_t& r) override {
+		row("bart");
+		values(r);
+	}
+
+	void ranking(class_t c, const stream::ranking_t& ranking) override {
+		if(ranking.strongest) {
+			row(std::string("bester_bart_") + class_name(c));
+			values(*ranking.strongest);
+		}
+		if(ranking.max_window) {
+			row(std::string("summe_") + class_name(c));
+			out.put(',');
+			emit::time(out, ranking.max_window->first);
+			out.put(',');
+			emit::time(out, ranking.max_window->second);
+			out.write(",,,");
+			number(ranking.max_points);
+			out.write(",,\n");
+		}
+	}
+
+	void top(class_t c, const std::vector<stream::record_t>& thermals) override {
+		const std::string art = std::string("platz_") + class_name(c);
+		for(const auto& r : thermals) {
+			row(art);
+			values(r);
+		}
+	}
+
+	void circles(const stream::record_t&, const circling::summary_t&, const parser::wind_t*) override {}
+
+	void duplicate(std::string_view, double) override {}
+
+};
+
+class jsonl_t : public emitter_t {
+
+	io::writer& out;
+	std::string name;
+
+	void string(std::string_view text) {
+		out.put('"');
+		for(char c : text) {
+			if(c == '"' || c == '\\') {
+				out.put('\\').put(c);
+			} else if(static_cast<unsigned char>(c) < 0x20) {
+				const char hex[] = "0123456789abcdef";
+				out.write("\\u00").put(hex[c >> 4]).put(hex[c & 15]);
+			} else {
+				out.put(c);
+			}
+		}
+		out.put('"');
+	}
+
+	// JSON has no inf or nan, a value that is not finite is null.
+	void number(double v) {
+		if(std::isfinite(v)) out.number(v);
+		else out.write("null");
+	}
+
+	void object(std::string_view art) {
+		out.write("{\"datei\":");
+		string(name);
+		out.write(",\"art\":\"").write(art).put('"');
+	}
+
+	void times(units::timestamp begin, units::timestamp end) {
+		out.write(",\"von\":\"");
+		time(out, begin);
+		out.write("\",\"bis\":\"");
+		time(out, end);
+		out.put('"');
+	}
+
+	void values(const stream::record_t& r) {
+		times(r.begin, r.end);
+		out.write(",\"tek_hoehe\":");
+		number(r.gain_te.to<double>());
+		out.write(",\"steigen\":");
+		number(r.average.to<double>());
+		out.write(",\"punkte\":");
+		number(r.points);
+		out.write(",\"lokal\":").write(r.local ? "true" : "false")
+			.write(",\"ueberland\":").write(r.remote ? "true" : "false")
+			.write("}\n");
+	}
+
+public:
+
+	explicit jsonl_t(io::writer& out) :
+		out(out)
+	{}
+
+	void file(std::string_view name, bool) override {
+		this->name = name;
+	}
+
+	void start(const airport_t& airport) override {
+		object("start");
+		out.write(",\"flugplatz\":");
+		string(airport.name);
+		out.write("}\n");
+	}
+
+	void thermal(const stream::record_t& r) override {
+		object("bart");
+		values(r);
+	}
+
+	void ranking(class_t c, const stream::ranking_t& ranking) override {
+		if(ranking.strongest) {
+			object(std::string("bester_bart_") + class_name(c));
+			values(*ranking.strongest);
+		}
+		if(ranking.max_window) {
+			object(std::string("summe_") + class_name(c));
+			times(ranking.max_window->first, ranking.max_window->second);
+			out.write(",\"punkte\":");
+			number(ranking.max_points);
+			out.write("}\n");
+		}
+	}
+
+	void top(class_t c, const std::vector<stream::record_t>& thermals) override {
+		const std::string art = std::string("platz_") + class_name(c);
+		for(std::size_t i = 0; i < thermals.size(); ++i) {
+			object(art);
+			out.write(",\"platz\":").number(std::int64_t(i + 1));
+			values(thermals[i]);
+		}
+	}
+
+	void circles(const stream::record_t& r, const circling::summary_t& s, const parser::wind_t* logged) override {
+		object("kreise");
+		times(r.begin, r.end);
+		out.write(",\"kreise\":").number(std::int64_t(s.circles))
+			.write(",\"rechts\":").number(std::int64_t(s.right))
+			.write(",\"radius\":");
+		number(s.radius.to<double>());
+		out.write(",\"abweichung\":");
+		number(s.deviation.to<double>());
+		if(s.has_wind) {
+			out.write(",\"wind_richtung\":");
+			number(s.wind_direction.to<double>());
+			out.write(",\"wind_staerke\":");
+			number(s.wind_speed.to<double>());
+		}
+		if(logged) {
+			out.write(",\"logger_wind_richtung\":");
+			number(logged->direction.to<double>());
+			out.write(",\"logger_wind_staerke\":");
+			number(logged->speed.to<double>());
+		}
+		out.write("}\n");
+	}
+
+	void duplicate(std::string_view original, double similarity) override {
+		object("duplikat");
+		out.write(",\"wie\":");
+		string(original);
+		out.write(",\"aehnlichkeit\":");
+		number(similarity);
+		out.write("}\n");
+	}
+
+};
+
+class binary_t : public emitter_t {
+
+	io::writer& out;
+
+	void u8(std::uint8_t v) {
+		out.put(static_cast<char>(v));
+	}
+
+	void u16(std::uint16_t v) {
+		const char b[] = { char(v), char(v >> 8) };
+		out.bytes(b, sizeof(b));
+	}
+
+	void u32(std::uint32_t v) {
+		const char b[] = { char(v), char(v >> 8), char(v >> 16), char(v >> 24) };
+		out.bytes(b, sizeof(b));
+	}
+
+	void f64(double v) {
+		std::uint64_t bits;
+		std::memcpy(&bits, &v, sizeof(bits));
+		u32(static_cast<std::uint32_t>(bits));
+		u32(static_cast<std::uint32_t>(bits >> 32));
+	}
+
+	void string(std::string_view text) {
+		text = text.substr(0, 0xffff);
+		u16(static_cast<std::uint16_t>(text.size()));
+		out.write(text);
+	}
+
+	void payload(const stream::record_t& r) {
+		u32(r.begin.count());
+		u32(r.end.count());
+		f64(r.gain_te.to<double>());
+		f64(r.average.to<double>());
+		f64(r.points);
+		u8(r.local | r.remote << 1);
+	}
+
+public:
+
+	explicit binary_t(io::writer& out) :
+		out(out)
+	{
+		out.write(std::string_view("THK\1", 4));
+	}
+
+	void file(std::string_view name, bool) override {
+		u8('D');
+		string(name);
+	}
+
+	void start(const airport_t& airport) override {
+		u8('S');
+		string(airport.name);
+	}
+
+	void thermal(const stream::record_t& r) override {
+		u8('T');
+		payload(r);
+	}
+
+	void ranking(class_t c, const stream::ranking_t& ranking) override {
+		u8('R');
+		u8(c == class_t::local ? 0 : 1);
+		u8(bool(ranking.strongest) | bool(ranking.max_window) << 1);
+		if(ranking.strongest) {
+			payload(*ranking.strongest);
+		}
+		if(ranking.max_window) {
+			f64(ranking.max_points);
+			u32(ranking.max_window->first.count());
+			u32(ranking.max_window->second.count());
+		}
+	}
+
+	void top(class_t c, const std::vector<stream::record_t>& thermals) override {
+		const std::size_t n = std::min<std::size_t>(thermals.size(), 0xffff);
+		u8('K');
+		u8(static_cast<std::uint8_t>(c));
+		u16(static_cast<std::uint16_t>(n));
+		for(std::size_t i = 0; i < n; ++i) {
+			payload(thermals[i]);
+		}
+	}
+
+	void circles(const stream::record_t& r, const circling::summary_t& s, const parser::wind_t* logged) override {
+		u8('C');
+		u32(r.begin.count());
+		u32(r.end.count());
+		u16(static_cast<std::uint16_t>(std::min<std::size_t>(s.circles, 0xffff)));
+		u16(static_cast<std::uint16_t>(std::min<std::size_t>(s.right, 0xffff)));
+		f64(s.radius.to<double>());
+		f64(s.deviation.to<double>());
+		u8(s.has_wind | bool(logged) << 1);
+		if(s.has_wind) {
+			f64(s.wind_direction.to<double>());
+			f64(s.wind_speed.to<double>());
+		}
+		if(logged) {
+			f64(logged->direction.to<double>());
+			f64(logged->speed.to<double>());
+		}
+	}
+
+	void duplicate(std::string_view original, double similarity) override {
+		u8('U');
+		string(original);
+		f64(similarity);
+	}
+
+};
+
+}
+
+bool parse(std::string_view name, format_t& format) {
+	if(name == "text") format = format_t::text;
+	else if(name == "csv") format = format_t::csv;
+	else if(name == "jsonl") format = format_t::jsonl;
+	else if(name == "binary") format = format_t::binary;
+	else return false;
+	return true;
+}
+
+std::unique_ptr<emitter_t> make(format_t format, io::writer& out) {
+	switch(format) {
+		case format_t::csv: return std::make_unique<csv_t>(out);
+		case format_t::jsonl: return std::make_unique<jsonl_t>(out);
+		case format_t::binary: return std::make_unique<binary_t>(out);
+		case format_t::text: break;
+	}
+	return std::make_unique<text_t>(out);
+}
+
+}
@@ -0,0 +1,113 @@
+#include "fingerprint.hpp"
+
+#include <cstring>
+
+#include "io/mapped_file.hpp"
+#include "io/replace.hpp"
+
+namespace fingerprint {
+
+namespace {
+
+constexpr std::string_view kind = "THKFPR";
+constexpr std::uint8_t version = 1;
+
+// Layout: file header, count, then per flight its number of cells, the
+// minima, the size of the name and the name.
+template <class value_type>
+bool take(std::string_view& bytes, value_type& value) {
+	if(bytes.size() < sizeof(value)) return false;
+	std::memcpy(&value, bytes.data(), sizeof(value));
+	bytes.remove_prefix(sizeof(value));
+	return true;
+}
+
+template <class value_type>
+void put(std::string& bytes, const value_type& value) {
+	bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}
+
+std::uint64_t index_t::key(const sketch_t& s, std::size_t band) {
+	std::uint64_t result = band;
+	for(std::size_t r = 0; r < rows; ++r) {
+		result = detail::mix(result ^ s.minima[band * rows + r]);
+	}
+	return result;
+}
+
+void index_t::add(std::string name, const sketch_t& sketch) {
+	const auto id = static_cast<std::uint32_t>(names.size());
+	names.push_back(std::move(name));
+	sketches.push_back(sketch);
+	seen.push_back(0);
+	if(sketch.cells == 0) return;
+	for(std::size_t band = 0; band < bands; ++band) {
+		buckets[key(sketch, band)].push_back(id);
+	}
+}
+
+index_t::match_t index_t::find(const sketch_t& sketch, double threshold) const {
+	match_t result;
+	if(sketch.cells == 0) return result;
+	if(++lookups == 0) {
+		std::fill(seen.begin(), seen.end(), 0);
+		lookups = 1;
+	}
+	for(std::size_t band = 0; band < bands; ++band) {
+		const auto bucket = buckets.find(key(sketch, band));
+		if(bucket == buckets.end()) continue;
+		for(auto id : bucket->second) {
+			if(seen[id] == lookups) continue;
+			seen[id] = lookups;
+			const double s = sketch.similarity(sketches[id]);
+			if(s >= threshold && s > result.similarity) {
+				result.name = &names[id];
+				result.similarity = s;
+			}
+		}
+	}
+	return result;
+}
+
+bool index_t::load(const std::string& path) {
+	*this = index_t();
+	io::mapped_file file(path);
+	if(!file) return false;
+	std::string_view bytes = file.view();
+
+	std::uint32_t count;
+	if(io::check_header(bytes, kind, version) != io::header_t::valid || !take(bytes, count)) return false;
+
+	for(std::uint32_t i = 0; i < count; ++i) {
+		sketch_t s;
+		std::uint32_t cells, size;
+		if(!take(bytes, cells) || !take(bytes, s.minima) || !take(bytes, size) || bytes.size() < size) {
+			*this = index_t();
+			return false;
+		}
+		s.cells = cells;
+		add(std::string(bytes.substr(0, size)), s);
+		bytes.remove_prefix(size);
+	}
+	if(!bytes.empty()) {
+		*this = index_t();
+		return false;
+	}
+	return true;
+}
+
+bool index_t::save(const std::string& path) const {
+	std::string bytes = io::header(kind, version);
+	put(bytes, static_cast<std::uint32_t>(names.size()));
+	for(std::size_t i = 0; i < names.size(); ++i) {
+		put(bytes, static_cast<std::uint32_t>(sketches[i].cells));
+		put(bytes, sketches[i].minima);
+		put(bytes, static_cast<std::uint32_t>(names[i].size()));
+		bytes += names[i];
+	}
+	return io::replace(path, bytes);
+}
+
+}
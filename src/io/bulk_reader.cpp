@@ -0,0 +1,369 @@
+#include "io/bulk_reader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace io {
+
+// Submission and completion queues shared with the kernel, set up with the raw
+// system calls so no liburing is needed.
+struct bulk_reader::ring_t {
+
+	int fd = -1;
+	void* sq_memory = MAP_FAILED;
+	void* cq_memory = MAP_FAILED;
+	std::size_t sq_size = 0;
+	std::size_t cq_size = 0;
+	io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+	std::size_t sqes_size = 0;
+
+	unsigned* sq_head;
+	unsigned* sq_tail;
+	unsigned sq_mask;
+	unsigned* sq_array;
+	unsigned sq_entries;
+	unsigned* cq_head;
+	unsigned* cq_tail;
+	unsigned cq_mask;
+	io_uring_cqe* cqes;
+
+	// Submissions queued since the last enter().
+	unsigned pending = 0;
+
+	// Whether the kernel behind ring knows opcode. The probe came with kernel
+	// 5.6 as IORING_OP_READ did, older ones with io_uring fail it.
+	static bool supports(int ring, unsigned opcode) {
+		constexpr unsigned ops = 256;
+		std::vector<char> memory(sizeof(io_uring_probe) + ops * sizeof(io_uring_probe_op));
+		auto probe = reinterpret_cast<io_uring_probe*>(memory.data());
+		if(::syscall(__NR_io_uring_register, ring, IORING_REGISTER_PROBE, probe, ops) < 0) return false;
+		return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+	}
+
+	static std::unique_ptr<ring_t> create(unsigned entries) {
+		auto ring = std::make_unique<ring_t>();
+		io_uring_params params{};
+		ring->fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+		if(ring->fd < 0) return nullptr;
+		// Without IORING_OP_READ every read would fail, the threads read instead.
+		if(!supports(ring->fd, IORING_OP_READ)) return nullptr;
+
+		ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+		if(single) {
+			ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+		}
+
+		ring->sq_memory = ::mmap(nullptr, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+		if(ring->sq_memory == MAP_FAILED) return nullptr;
+		if(single) {
+			ring->cq_memory = ring->sq_memory;
+		} else {
+			ring->cq_memory = ::mmap(nullptr, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+			if(ring->cq_memory == MAP_FAILED) return nullptr;
+		}
+		ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		ring->sqes = static_cast<io_uring_sqe*>(::mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+		if(ring->sqes == MAP_FAILED) return nullptr;
+
+		auto sq = static_cast<char*>(ring->sq_memory);
+		ring->sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+		ring->sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+		ring->sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+		ring->sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+		ring->sq_entries = params.sq_entries;
+		auto cq = static_cast<char*>(ring->cq_memory);
+		ring->cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+		ring->cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+		ring->cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+		ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+		return ring;
+	}
+
+	~ring_t() {
+		if(sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+		if(cq_memory != MAP_FAILED && cq_memory != sq_memory) ::munmap(cq_memory, cq_size);
+		if(sq_memory != MAP_FAILED) ::munmap(sq_memory, sq_size);
+		if(fd >= 0) ::close(fd);
+	}
+
+	// Queues a read, the caller keeps no more reads in flight than the ring holds.
+	void read(int file, char* data, std::size_t size, std::size_t offset, std::uint64_t user) {
+		const unsigned tail = *sq_tail;
+		const unsigned index = tail & sq_mask;
+		io_uring_sqe& sqe = sqes[index];
+		sqe = io_uring_sqe{};
+		sqe.opcode = IORING_OP_READ;
+		sqe.fd = file;
+		sqe.addr = reinterpret_cast<std::uint64_t>(data);
+		sqe.len = static_cast<unsigned>(std::min<std::size_t>(size, 1u << 30));
+		sqe.off = offset;
+		sqe.user_data = user;
+		sq_array[index] = index;
+		__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+		++pending;
+	}
+
+	// Submits the queued reads and waits for at least wait completions.
+	bool enter(unsigned wait) {
+		for(;;) {
+			long n = ::syscall(__NR_io_uring_enter, fd, pending, wait, wait ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+			if(n >= 0) {
+				pending -= std::min<unsigned>(pending, n);
+				return true;
+			}
+			if(errno != EINTR) return false;
+		}
+	}
+
+	// Waits for wait completions without submitting anything.
+	bool wait(unsigned wait) {
+		for(;;) {
+			if(::syscall(__NR_io_uring_enter, fd, 0, wait, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0) return true;
+			if(errno != EINTR) return false;
+		}
+	}
+
+	bool complete(io_uring_cqe& cqe) {
+		const unsigned head = *cq_head;
+		if(head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) return false;
+		cqe = cqes[head & cq_mask];
+		__atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+
+};
+
+bulk_reader::bulk_reader(std::size_t depth, backend_t backend) :
+	depth(std::max<std::size_t>(1, depth))
+{
+	if(backend != backend_t::threads) {
+		ring = ring_t::create(static_cast<unsigned>(this->depth));
+	}
+}
+
+bulk_reader::~bulk_reader() = default;
+
+bulk_reader::backend_t bulk_reader::backend() const {
+	return ring ? backend_t::io_uring : backend_t::threads;
+}
+
+bulk_reader::buffer_t bulk_reader::acquire(std::size_t size) {
+	// Smallest free buffer that fits, so large buffers stay for large files.
+	auto best = pool.end();
+	for(auto it = pool.begin(); it != pool.end(); ++it) {
+		if(it->capacity >= size && (best == pool.end() || it->capacity < best->capacity)) {
+			best = it;
+		}
+	}
+	if(best == pool.end()) {
+		// Uninitialized, the read overwrites it anyway.
+		return buffer_t{ std::unique_ptr<char[]>(new char[std::max<std::size_t>(size, 1)]), size };
+	}
+	buffer_t buffer = std::move(*best);
+	*best = std::move(pool.back());
+	pool.pop_back();
+	return buffer;
+}
+
+void bulk_reader::release(buffer_t buffer) {
+	pool.push_back(std::move(buffer));
+}
+
+bool bulk_reader::open(slot_t& slot, const std::string& path) {
+	slot = slot_t{};
+	slot.fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	struct stat st;
+	if(slot.fd < 0 || ::fstat(slot.fd, &st) != 0) return false;
+	::posix_fadvise(slot.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	slot.size = st.st_size;
+	slot.ok = slot.size == 0;
+	return !slot.ok;
+}
+
+void bulk_reader::hand_over(std::size_t index, slot_t& slot, const callback_t& f) {
+	if(slot.fd >= 0) ::close(slot.fd);
+	f(index, slot.ok ? std::string_view(slot.buffer.data.get(), slot.done) : std::string_view(), slot.ok);
+	if(slot.buffer.data) release(std::move(slot.buffer));
+}
+
+void bulk_reader::read(const std::vector<std::string>& paths, const callback_t& f) {
+	if(ring) {
+		read_ring(paths, f);
+	} else {
+		read_threads(paths, f);
+	}
+}
+
+void bulk_reader::read_ring(const std::vector<std::string>& paths, const callback_t& f) {
+	std::vector<slot_t> slots(depth);
+	std::size_t next_open = 0;
+	std::size_t next_deliver = 0;
+	// Reads queued or submitted and not completed yet.
+	std::size_t in_flight = 0;
+
+	auto submit = [&](std::size_t index) {
+		auto& slot = slots[index % depth];
+		ring->read(slot.fd, slot.buffer.data.get() + slot.done, slot.size - slot.done, slot.done, index);
+		++in_flight;
+	};
+
+	while(next_deliver < paths.size()) {
+		while(next_open < paths.size() && next_open - next_deliver < depth) {
+			auto& slot = slots[next_open % depth];
+			if(open(slot, paths[next_open])) {
+				slot.buffer = acquire(slot.size);
+				submit(next_open);
+			} else {
+				slot.complete = true;
+			}
+			++next_open;
+		}
+
+		if(slots[next_deliver % depth].complete) {
+			// The kernel reads ahead while the caller works on this file.
+			if(ring->pending) ring->enter(0);
+			hand_over(next_deliver, slots[next_deliver % depth], f);
+			++next_deliver;
+			continue;
+		}
+
+		if(!ring->enter(1)) {
+			// The ring failed as a whole, finish with the threads. Reads the
+			// kernel took still write into their buffers until they complete,
+			// queued ones it never saw are dropped with the ring.
+			std::size_t taken = in_flight - ring->pending;
+			io_uring_cqe cqe;
+			while(taken > 0) {
+				while(taken > 0 && ring->complete(cqe)) --taken;
+				if(taken > 0 && !ring->wait(1)) break;
+			}
+			ring.reset();
+
+			for(std::size_t i = next_deliver; i < next_open; ++i) {
+				auto& slot = slots[i % depth];
+				if(slot.fd >= 0) ::close(slot.fd);
+				// Never handed to the pool if the kernel might still write there.
+				if(taken > 0 && !slot.complete) {
+					slot.buffer.data.release();
+				} else if(slot.buffer.data) {
+					release(std::move(slot.buffer));
+				}
+			}
+			// Files not delivered yet are read again from their beginning.
+			std::vector<std::string> rest(paths.begin() + next_deliver, paths.end());
+			const std::size_t first = next_deliver;
+			read_threads(rest, [&](std::size_t index, std::string_view data, bool ok) {
+				f(first + index, data, ok);
+			});
+			return;
+		}
+
+		io_uring_cqe cqe;
+		while(ring->complete(cqe)) {
+			--in_flight;
+			const std::size_t index = cqe.user_data;
+			auto& slot = slots[index % depth];
+			if(cqe.res == -EINTR || cqe.res == -EAGAIN) {
+				submit(index);
+			} else if(cqe.res < 0) {
+				slot.complete = true;
+			} else {
+				slot.done += cqe.res;
+				// A file that shrank since fstat ends at the short read.
+				if(slot.done < slot.size && cqe.res > 0) {
+					submit(index);
+				} else {
+					slot.ok = slot.complete = true;
+				}
+			}
+		}
+	}
+}
+
+void bulk_reader::read_threads(const std::vector<std::string>& paths, const callback_t& f) {
+	std::vector<slot_t> slots(depth);
+	std::size_t next_open = 0;
+	std::size_t next_deliver = 0;
+	std::mutex mutex;
+	std::condition_variable changed;
+
+	auto work = [&]() {
+		std::unique_lock<std::mutex> lock(mutex);
+		for(;;) {
+			changed.wait(lock, [&]() {
+				return next_open >= paths.size() || next_open - next_deliver < depth;
+			});
+			if(next_open >= paths.size()) return;
+
+			const std::size_t index = next_open++;
+			lock.unlock();
+
+			// Read aside, the slot may still be delivered to the caller and
+			// is only written under the lock.
+			slot_t read;
+			if(open(read, paths[index])) {
+				lock.lock();
+				read.buffer = acquire(read.size);
+				lock.unlock();
+
+				read.ok = true;
+				while(read.done < read.size) {
+					ssize_t n = ::pread(read.fd, read.buffer.data.get() + read.done, read.size - read.done, read.done);
+					if(n < 0 && errno == EINTR) continue;
+					// A file that shrank since fstat ends at the short read.
+					read.ok = n >= 0;
+					if(n <= 0) break;
+					read.done += n;
+				}
+			}
+
+			lock.lock();
+			auto& slot = slots[index % depth];
+			slot = std::move(read);
+			slot.complete = true;
+			changed.notify_all();
+		}
+	};
+
+	// Enough threads to keep depth reads in flight, bounded for small machines.
+	const std::size_t n = std::min<std::size_t>({ depth, paths.size(), 16 });
+	std::vector<std::thread> workers;
+	for(std::size_t i = 0; i < n; ++i) {
+		workers.emplace_back(work);
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	while(next_deliver < paths.size()) {
+		auto& slot = slots[next_deliver % depth];
+		changed.wait(lock, [&]() { return slot.complete; });
+
+		lock.unlock();
+		if(slot.fd >= 0) ::close(slot.fd);
+		f(next_deliver, slot.ok ? std::string_view(slot.buffer.data.get(), slot.done) : std::string_view(), slot.ok);
+		lock.lock();
+
+		if(slot.buffer.data) release(std::move(slot.buffer));
+		slot = slot_t{};
+		++next_deliver;
+		changed.notify_all();
+	}
+	lock.unlock();
+
+	for(auto& w : workers) {
+		w.join();
+	}
+}
+
+}
@@ -0,0 +1,245 @@
+#include "io/bundle.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace io {
+
+namespace {
+
+constexpr std::size_t tar_block = 512;
+
+bool is_igc(const std::string& name) {
+	if(name.size() < 4) return false;
+	std::string extension = name.substr(name.size() - 4);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+		return std::tolower(c);
+	});
+	return extension == ".igc";
+}
+
+// Exposes the next size bytes of another stream buffer, so a tar entry can be
+// read as a stream of its own.
+class limited_buf : public std::streambuf {
+
+	std::streambuf& source;
+	std::size_t remaining;
+	std::array<char, 16 * 1024> buffer;
+
+protected:
+
+	int_type underflow() override {
+		if(gptr() < egptr()) return traits_type::to_int_type(*gptr());
+		if(remaining == 0) return traits_type::eof();
+
+		const auto n = source.sgetn(buffer.data(), std::min(remaining, buffer.size()));
+		remaining -= n;
+		if(n <= 0) {
+			remaining = 0;
+			return traits_type::eof();
+		}
+		setg(buffer.data(), buffer.data(), buffer.data() + n);
+		return traits_type::to_int_type(*gptr());
+	}
+
+public:
+
+	limited_buf(std::streambuf& source, std::size_t size) :
+		source(source),
+		remaining(size)
+	{}
+
+	// Consumes what the reader left, true if the entry was complete.
+	bool drain() {
+		setg(buffer.data(), buffer.data(), buffer.data());
+		while(remaining > 0) {
+			const auto n = source.sgetn(buffer.data(), std::min(remaining, buffer.size()));
+			if(n <= 0) return false;
+			remaining -= n;
+		}
+		return true;
+	}
+
+};
+
+bool skip(std::streambuf& source, std::size_t size) {
+	std::array<char, 16 * 1024> buffer;
+	while(size > 0) {
+		const auto n = source.sgetn(buffer.data(), std::min(size, buffer.size()));
+		if(n <= 0) return false;
+		size -= n;
+	}
+	return true;
+}
+
+// Size field of a tar header, octal text or GNU base 256 for large files.
+bool tar_number(std::string_view field, std::uint64_t& value) {
+	value = 0;
+	if(!field.empty() && (static_cast<unsigned char>(field[0]) & 0x80)) {
+		for(std::size_t i = 1; i < field.size(); ++i) {
+			value = value << 8 | static_cast<unsigned char>(field[i]);
+		}
+		return true;
+	}
+	bool digits = false;
+	for(char c : field) {
+		if(c == ' ' && !digits) continue;
+		if(c < '0' || c > '7') break;
+		value = value * 8 + (c - '0');
+		digits = true;
+	}
+	return digits;
+}
+
+std::string tar_string(std::string_view field) {
+	return std::string(field.substr(0, std::min(field.find('\0'), field.size())));
+}
+
+bool for_each_tar(std::streambuf& source, const entry_callback_t& f) {
+	std::array<char, tar_block> block;
+	// Name given by a GNU long name or pax header for the next entry.
+	std::string long_name;
+
+	for(;;) {
+		if(source.sgetn(block.data(), block.size()) != static_cast<std::streamsize>(block.size())) {
+			return false;
+		}
+		const std::string_view header(block.data(), block.size());
+		if(std::all_of(block.begin(), block.end(), [](char c) { return c == '\0'; })) {
+			return true;
+		}
+
+		std::uint64_t checksum, sum = 0;
+		for(std::size_t i = 0; i < block.size(); ++i) {
+			sum += i >= 148 && i < 156 ? ' ' : static_cast<unsigned char>(block[i]);
+		}
+		std::uint64_t size;
+		if(!tar_number(header.substr(148, 8), checksum) || checksum != sum || !tar_number(header.substr(124, 12), size)) {
+			return false;
+		}
+		const std::size_t padding = (tar_block - size % tar_block) % tar_block;
+		const char type = header[156];
+
+		if(type == 'L' || type == 'x') {
+			std::string text(size, '\0');
+			if(source.sgetn(text.data(), size) != static_cast<std::streamsize>(size) || !skip(source, padding)) {
+				return false;
+			}
+			if(type == 'L') {
+				long_name = tar_string(text);
+			} else {
+				// pax records, "length path=value\n".
+				for(std::size_t at = 0; at < text.size();) {
+					const auto space = text.find(' ', at);
+					const auto length = std::strtoul(text.c_str() + at, nullptr, 10);
+					if(space == std::string::npos || length == 0) break;
+					const auto record = text.substr(space + 1, at + length - space - 2);
+					if(record.rfind("path=", 0) == 0) long_name = record.substr(5);
+					at += length;
+				}
+			}
+			continue;
+		}
+
+		std::string name = long_name;
+		long_name.clear();
+		if(name.empty()) {
+			// Only POSIX ustar has a prefix field, GNU tar keeps other data there.
+			const bool posix = header.substr(257, 6) == std::string_view("ustar\0", 6);
+			const auto prefix = posix ? tar_string(header.substr(345, 155)) : std::string();
+			name = tar_string(header.substr(0, 100));
+			if(!prefix.empty()) name = prefix + "/" + name;
+		}
+
+		if((type == '0' || type == '\0') && is_igc(name)) {
+			limited_buf entry(source, size);
+			std::istream input(&entry);
+			f(name, input);
+			if(!entry.drain()) return false;
+			if(!skip(source, padding)) return false;
+		} else if(!skip(source, size + padding)) {
+			return false;
+		}
+	}
+}
+
+std::uint32_t u16(std::string_view data, std::size_t at) {
+	return static_cast<unsigned char>(data[at]) | static_cast<unsigned char>(data[at + 1]) << 8;
+}
+
+std::uint32_t u32(std::string_view data, std::size_t at) {
+	return u16(data, at) | u16(data, at + 2) << 16;
+}
+
+bool for_each_zip(std::string_view data, const entry_callback_t& f) {
+	// The end of central directory record follows an optional comment of up to 64 KiB.
+	constexpr std::size_t end_size = 22;
+	if(data.size() < end_size) return false;
+	std::size_t end = std::string_view::npos;
+	const std::size_t lowest = data.size() > end_size + 0xffff ? data.size() - end_size - 0xffff : 0;
+	for(std::size_t at = data.size() - end_size + 1; at-- > lowest;) {
+		if(data.substr(at, 4) == "PK\x05\x06") {
+			end = at;
+			break;
+		}
+	}
+	if(end == std::string_view::npos) return false;
+
+	const std::size_t entries = u16(data, end + 10);
+	std::size_t at = u32(data, end + 16);
+	bool intact = true;
+
+	for(std::size_t i = 0; i < entries; ++i) {
+		if(at + 46 > data.size() || data.substr(at, 4) != "PK\x01\x02") return false;
+		const auto method = u16(data, at + 10);
+		const std::uint64_t compressed = u32(data, at + 20);
+		const std::size_t name_size = u16(data, at + 28);
+		const std::size_t extra_size = u16(data, at + 30);
+		const std::size_t comment_size = u16(data, at + 32);
+		const std::uint64_t local = u32(data, at + 42);
+		if(at + 46 + name_size > data.size()) return false;
+		const std::string name(data.substr(at + 46, name_size));
+		at += 46 + name_size + extra_size + comment_size;
+
+		if(!is_igc(name)) continue;
+
+		// Zip64 marks sizes and offsets that do not fit 32 bits.
+		if(compressed == 0xffffffff || local == 0xffffffff || local + 30 > data.size() || data.substr(local, 4) != "PK\x03\x04") {
+			intact = false;
+			continue;
+		}
+		const std::size_t begin = local + 30 + u16(data, local + 26) + u16(data, local + 28);
+		if(begin + compressed > data.size() || (method != 0 && method != 8)) {
+			intact = false;
+			continue;
+		}
+
+		decompressor entry(data.substr(begin, compressed), method == 8 ? compression_t::deflate : compression_t::none);
+		std::istream input(&entry);
+		f(name, input);
+		intact &= !entry.failed();
+	}
+	return intact;
+}
+
+}
+
+bool for_each_entry(std::string_view data, format_t format, const entry_callback_t& f) {
+	switch(format.container) {
+		case container_t::zip:
+			return for_each_zip(data, f);
+		case container_t::tar: {
+			decompressor source(data, format.compression);
+			return for_each_tar(source, f) && !source.failed();
+		}
+		case container_t::none:
+			break;
+	}
+	return false;
+}
+
+}
@@ -0,0 +1,194 @@
+#include "io/decompressor.hpp"
+
+#include <algorithm>
+#include <zlib.h>
+#ifdef THERMIK_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+namespace io {
+
+namespace {
+
+constexpr std::size_t tar_block = 512;
+
+bool starts_with(std::string_view data, std::string_view magic) {
+	return data.substr(0, magic.size()) == magic;
+}
+
+bool is_tar(std::string_view block) {
+	// POSIX ustar and GNU tar both start the magic with "ustar".
+	return block.size() >= tar_block && block.substr(257, 5) == "ustar";
+}
+
+}
+
+format_t detect(std::string_view data) {
+	format_t format;
+	if(starts_with(data, "\x1f\x8b")) {
+		format.compression = compression_t::gzip;
+	} else if(starts_with(data, "\x28\xb5\x2f\xfd")) {
+		format.compression = compression_t::zstd;
+	} else if(starts_with(data, "PK\x03\x04") || starts_with(data, "PK\x05\x06")) {
+		format.container = container_t::zip;
+		return format;
+	}
+
+	if(format.compression == compression_t::none) {
+		format.container = is_tar(data) ? container_t::tar : container_t::none;
+		return format;
+	}
+
+	if(supported(format.compression)) {
+		decompressor probe(data, format.compression, tar_block);
+		char block[tar_block];
+		const auto n = probe.sgetn(block, sizeof(block));
+		format.container = is_tar(std::string_view(block, n)) ? container_t::tar : container_t::none;
+	}
+	return format;
+}
+
+bool supported(compression_t compression) {
+#ifdef THERMIK_WITH_ZSTD
+	return true;
+#else
+	return compression != compression_t::zstd;
+#endif
+}
+
+struct decompressor::state_t {
+	compression_t compression;
+	std::string_view input;
+	bool ended = false;
+
+	z_stream zlib{};
+#ifdef THERMIK_WITH_ZSTD
+	ZSTD_DStream* zstd = nullptr;
+	ZSTD_inBuffer zstd_input{};
+	// Nonzero while a frame is incomplete.
+	std::size_t zstd_pending = 0;
+#endif
+
+	~state_t() {
+		if(compression == compression_t::gzip || compression == compression_t::deflate) {
+			inflateEnd(&zlib);
+		}
+#ifdef THERMIK_WITH_ZSTD
+		if(zstd) ZSTD_freeDStream(zstd);
+#endif
+	}
+
+	// Fills out with up to size decompressed bytes, returns how many. Zero at
+	// the end of the data, damaged is set if it ended too early.
+	std::size_t inflate_into(char* out, std::size_t size, bool& damaged) {
+		zlib.next_out = reinterpret_cast<Bytef*>(out);
+		zlib.avail_out = static_cast<uInt>(size);
+		while(zlib.avail_out == size && !ended) {
+			if(zlib.avail_in == 0) {
+				// zlib counts in 32 bits, larger inputs are fed in pieces.
+				const std::size_t piece = std::min<std::size_t>(input.size(), 1u << 30);
+				zlib.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+				zlib.avail_in = static_cast<uInt>(piece);
+				input.remove_prefix(piece);
+			}
+
+			const int status = inflate(&zlib, Z_NO_FLUSH);
+			if(status == Z_STREAM_END) {
+				// A gzip file may hold several members, as from cat a.gz b.gz.
+				if(compression == compression_t::gzip && (zlib.avail_in > 0 || !input.empty())) {
+					inflateReset(&zlib);
+				} else {
+					ended = true;
+				}
+			} else if(status == Z_BUF_ERROR && zlib.avail_in == 0 && input.empty()) {
+				ended = damaged = true;
+			} else if(status != Z_OK) {
+				ended = damaged = true;
+			}
+		}
+		return size - zlib.avail_out;
+	}
+
+#ifdef THERMIK_WITH_ZSTD
+	std::size_t decompress_into(char* out, std::size_t size, bool& damaged) {
+		ZSTD_outBuffer output{ out, size, 0 };
+		while(output.pos == 0 && !ended) {
+			if(zstd_input.pos == zstd_input.size) {
+				ended = true;
+				damaged = zstd_pending != 0;
+				break;
+			}
+			zstd_pending = ZSTD_decompressStream(zstd, &output, &zstd_input);
+			if(ZSTD_isError(zstd_pending)) {
+				ended = damaged = true;
+			}
+		}
+		return output.pos;
+	}
+#endif
+};
+
+decompressor::decompressor(std::string_view data, compression_t compression, std::size_t capacity) :
+	state(std::make_unique<state_t>()),
+	capacity(capacity)
+{
+	state->compression = compression;
+	state->input = data;
+
+	switch(compression) {
+		case compression_t::none: {
+			// Read in place, there is nothing to refill.
+			char* begin = const_cast<char*>(data.data());
+			setg(begin, begin, begin + data.size());
+			state->ended = true;
+			return;
+		}
+		case compression_t::gzip:
+		case compression_t::deflate:
+			// 15 + 32 accepts gzip and zlib headers, -15 is headerless deflate.
+			if(inflateInit2(&state->zlib, compression == compression_t::gzip ? 15 + 32 : -15) != Z_OK) {
+				state->compression = compression_t::none;
+				state->ended = damaged = true;
+			}
+			break;
+		case compression_t::zstd:
+#ifdef THERMIK_WITH_ZSTD
+			state->zstd = ZSTD_createDStream();
+			state->zstd_input = ZSTD_inBuffer{ data.data(), data.size(), 0 };
+			if(!state->zstd || ZSTD_isError(ZSTD_initDStream(state->zstd))) {
+				state->ended = damaged = true;
+			}
+#else
+			state->ended = damaged = true;
+#endif
+			break;
+	}
+
+	buffer.reset(new char[capacity]);
+	setg(buffer.get(), buffer.get(), buffer.get());
+}
+
+decompressor::~decompressor() = default;
+
+decompressor::int_type decompressor::underflow() {
+	if(gptr() < egptr()) {
+		return traits_type::to_int_type(*gptr());
+	}
+	if(state->ended) {
+		return traits_type::eof();
+	}
+
+	std::size_t n = 0;
+	if(state->compression == compression_t::zstd) {
+#ifdef THERMIK_WITH_ZSTD
+		n = state->decompress_into(buffer.get(), capacity, damaged);
+#endif
+	} else {
+		n = state->inflate_into(buffer.get(), capacity, damaged);
+	}
+
+	setg(buffer.get(), buffer.get(), buffer.get() + n);
+	return n > 0 ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+}
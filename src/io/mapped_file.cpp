@@ -0,0 +1,53 @@
+#include "io/mapped_file.hpp"
+
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace io {
+
+mapped_file::mapped_file(const std::string& path)
+{
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if(fd < 0) return;
+
+	struct stat st;
+	if(::fstat(fd, &st) == 0) {
+		if(st.st_size == 0) {
+			open = true;
+		} else {
+			void* p = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(p != MAP_FAILED) {
+				::madvise(p, st.st_size, MADV_SEQUENTIAL);
+				data = static_cast<const char*>(p);
+				size = st.st_size;
+				open = true;
+			}
+		}
+	}
+	::close(fd);
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept :
+	data(std::exchange(other.data, nullptr)),
+	size(std::exchange(other.size, 0)),
+	open(std::exchange(other.open, false))
+{
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+	std::swap(data, other.data);
+	std::swap(size, other.size);
+	std::swap(open, other.open);
+	return *this;
+}
+
+mapped_file::~mapped_file() {
+	if(data) {
+		::munmap(const_cast<char*>(data), size);
+	}
+}
+
+}
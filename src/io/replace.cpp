@@ -0,0 +1,48 @@
+#include "io/replace.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+namespace io {
+
+namespace {
+
+constexpr std::uint32_t byte_order = 0x01020304;
+
+}
+
+std::string header(std::string_view kind, std::uint8_t version) {
+	std::string result(kind.substr(0, 6));
+	result.resize(6, '\0');
+	result.push_back('\0');
+	result.push_back(static_cast<char>(version));
+	result.append(reinterpret_cast<const char*>(&byte_order), sizeof(byte_order));
+	return result;
+}
+
+header_t check_header(std::string_view& bytes, std::string_view kind, std::uint8_t version) {
+	const std::string expected = header(kind, version);
+	if(bytes.size() < header_size || bytes.substr(0, 7) != std::string_view(expected).substr(0, 7)) {
+		return header_t::foreign;
+	}
+	if(bytes.substr(0, header_size) != expected) return header_t::outdated;
+	bytes.remove_prefix(header_size);
+	return header_t::valid;
+}
+
+bool replace(const std::string& path, std::string_view bytes) {
+	const std::string temporary = path + ".tmp" + std::to_string(::getpid());
+	std::error_code ec;
+	std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), bytes.size());
+	out.close();
+	if(out) std::filesystem::rename(temporary, path, ec);
+	if(!out || ec) {
+		std::filesystem::remove(temporary, ec);
+		return false;
+	}
+	return true;
+}
+
+}
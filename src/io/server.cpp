@@ -0,0 +1,163 @@
+#include "io/server.hpp"
+
+#include <cerrno>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace io {
+
+namespace {
+
+// UDP senders are told apart from TCP descriptors by the top bit.
+constexpr std::uint64_t udp_stream = std::uint64_t(1) << 63;
+
+int bound(int type, std::uint16_t port) {
+	int fd = ::socket(AF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if(fd < 0) return -1;
+
+	int on = 1;
+	::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		::close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+bool watch(int epoll, int fd) {
+	epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.u64 = static_cast<std::uint64_t>(fd);
+	return ::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+}
+
+server::server(std::uint16_t port, std::chrono::steady_clock::duration idle) :
+	tcp(bound(SOCK_STREAM, port)),
+	udp(bound(SOCK_DGRAM, port)),
+	idle(idle)
+{
+	if(tcp < 0 || udp < 0 || ::listen(tcp, SOMAXCONN) != 0) return;
+
+	// Bursts from many senders must not overflow the socket between two waits.
+	int size = 8 * 1024 * 1024;
+	::setsockopt(udp, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+	int fd = ::epoll_create1(EPOLL_CLOEXEC);
+	if(fd >= 0 && watch(fd, tcp) && watch(fd, udp)) {
+		epoll = fd;
+	} else if(fd >= 0) {
+		::close(fd);
+	}
+}
+
+server::~server() {
+	if(epoll >= 0) ::close(epoll);
+	if(tcp >= 0) ::close(tcp);
+	if(udp >= 0) ::close(udp);
+}
+
+void server::accept(handler& h) {
+	for(;;) {
+		int fd = ::accept4(tcp, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if(fd < 0) return;
+		if(!watch(epoll, fd)) {
+			::close(fd);
+			continue;
+		}
+		streams.insert(static_cast<std::uint64_t>(fd));
+		h.opened(static_cast<std::uint64_t>(fd));
+	}
+}
+
+void server::read(int fd, handler& h) {
+	// Level triggered, whatever is left is reported by the next wait.
+	ssize_t n = ::recv(fd, buffer.data(), buffer.size(), 0);
+	if(n > 0) {
+		h.received(static_cast<std::uint64_t>(fd), std::string_view(buffer.data(), n));
+		return;
+	}
+	if(n < 0 && (errno == EAGAIN || errno == EINTR)) return;
+
+	::epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+	::close(fd);
+	streams.erase(static_cast<std::uint64_t>(fd));
+	h.closed(static_cast<std::uint64_t>(fd));
+}
+
+void server::receive(handler& h) {
+	const auto now = std::chrono::steady_clock::now();
+	for(;;) {
+		sockaddr_in from{};
+		socklen_t length = sizeof(from);
+		ssize_t n = ::recvfrom(udp, buffer.data(), buffer.size(), 0, reinterpret_cast<sockaddr*>(&from), &length);
+		if(n < 0) return;
+
+		const std::uint64_t stream = udp_stream |
+			std::uint64_t(ntohl(from.sin_addr.s_addr)) << 16 |
+			ntohs(from.sin_port);
+		if(streams.insert(stream).second) {
+			h.opened(stream);
+		}
+		heard[stream] = now;
+		h.received(stream, std::string_view(buffer.data(), n));
+	}
+}
+
+void server::expire(handler& h) {
+	const auto now = std::chrono::steady_clock::now();
+	for(auto it = heard.begin(); it != heard.end();) {
+		if(now - it->second < idle) {
+			++it;
+			continue;
+		}
+		const auto stream = it->first;
+		it = heard.erase(it);
+		streams.erase(stream);
+		h.closed(stream);
+	}
+	expired = now;
+}
+
+void server::run(handler& h, const std::atomic<bool>& stop) {
+	std::array<epoll_event, 256> events;
+
+	while(!stop) {
+		int n = ::epoll_wait(epoll, events.data(), events.size(), 250);
+		for(int i = 0; i < n; ++i) {
+			const int fd = static_cast<int>(events[i].data.u64);
+			if(fd == tcp) {
+				accept(h);
+			} else if(fd == udp) {
+				receive(h);
+			} else {
+				read(fd, h);
+			}
+		}
+		// Quiet senders are looked for once a second, not per datagram.
+		if(std::chrono::steady_clock::now() - expired >= std::chrono::seconds(1)) {
+			expire(h);
+		}
+	}
+
+	for(auto stream : streams) {
+		if(!(stream & udp_stream)) {
+			::epoll_ctl(epoll, EPOLL_CTL_DEL, static_cast<int>(stream), nullptr);
+			::close(static_cast<int>(stream));
+		}
+		h.closed(stream);
+	}
+	streams.clear();
+	heard.clear();
+}
+
+}
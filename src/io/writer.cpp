@@ -0,0 +1,85 @@
+#include "io/writer.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <unistd.h>
+
+namespace io {
+
+writer::writer(int fd, std::size_t capacity) :
+	fd(fd),
+	buffer(new char[capacity]),
+	capacity(capacity)
+{}
+
+writer::~writer() {
+	flush();
+}
+
+char* writer::reserve(std::size_t n) {
+	if(used + n > capacity) flush();
+	return buffer.get() + used;
+}
+
+writer& writer::write(std::string_view text) {
+	if(text.size() > capacity) {
+		flush();
+		// Too large to buffer, handed on as is.
+		std::size_t done = 0;
+		while(done < text.size() && !broken) {
+			ssize_t n = ::write(fd, text.data() + done, text.size() - done);
+			if(n < 0 && errno == EINTR) continue;
+			broken = n <= 0;
+			if(n > 0) done += n;
+		}
+		return *this;
+	}
+	std::memcpy(reserve(text.size()), text.data(), text.size());
+	used += text.size();
+	return *this;
+}
+
+writer& writer::put(char c) {
+	*reserve(1) = c;
+	++used;
+	return *this;
+}
+
+writer& writer::number(std::int64_t value) {
+	constexpr std::size_t longest = 24;
+	char* out = reserve(longest);
+	used += std::to_chars(out, out + longest, value).ptr - out;
+	return *this;
+}
+
+writer& writer::number(double value) {
+	constexpr std::size_t longest = 32;
+	char* out = reserve(longest);
+	used += std::to_chars(out, out + longest, value).ptr - out;
+	return *this;
+}
+
+writer& writer::number(double value, int precision) {
+	constexpr std::size_t longest = 32;
+	char* out = reserve(longest);
+	used += std::to_chars(out, out + longest, value, std::chars_format::general, precision).ptr - out;
+	return *this;
+}
+
+writer& writer::bytes(const void* data, std::size_t size) {
+	return write(std::string_view(static_cast<const char*>(data), size));
+}
+
+void writer::flush() {
+	std::size_t done = 0;
+	while(done < used && !broken) {
+		ssize_t n = ::write(fd, buffer.get() + done, used - done);
+		if(n < 0 && errno == EINTR) continue;
+		broken = n <= 0;
+		if(n > 0) done += n;
+	}
+	used = 0;
+}
+
+}
@@ -0,0 +1,140 @@
+#include "thermik.h"
+
+#include <algorithm>
+#include <new>
+#include <thread>
+
+#include "analysis.hpp"
+
+struct thermik_context {
+	analysis::context_t context;
+
+	thermik_context(std::string rules, unsigned int threads) :
+		context(std::move(rules), threads)
+	{}
+};
+
+namespace {
+
+thermik_thermal convert(const stream::record_t& r) {
+	thermik_thermal result{};
+	result.begin = r.begin.count();
+	result.end = r.end.count();
+	result.gain_te = r.gain_te.to<double>();
+	result.average = r.average.to<double>();
+	result.points = r.points;
+	result.local = r.local;
+	result.remote = r.remote;
+	return result;
+}
+
+thermik_ranking convert(const stream::ranking_t& r) {
+	thermik_ranking result{};
+	result.has_strongest = bool(r.strongest);
+	if(r.strongest) {
+		result.strongest = convert(*r.strongest);
+	}
+	result.has_window = bool(r.max_window);
+	if(r.max_window) {
+		result.window_points = r.max_points;
+		result.window_begin = r.max_window->first.count();
+		result.window_end = r.max_window->second.count();
+	}
+	return result;
+}
+
+thermik_status convert(analysis::status_t status) {
+	switch(status) {
+		case analysis::status_t::ok: return THERMIK_OK;
+		case analysis::status_t::damaged: return THERMIK_DAMAGED;
+		case analysis::status_t::invalid: return THERMIK_INVALID;
+		case analysis::status_t::no_fixes: return THERMIK_NO_FIXES;
+		// The ruleset is checked by thermik_create.
+		case analysis::status_t::unknown_rules:
+		case analysis::status_t::unsupported: break;
+	}
+	return THERMIK_UNSUPPORTED;
+}
+
+}
+
+extern "C" {
+
+int thermik_abi_version(void) {
+	return THERMIK_ABI_VERSION;
+}
+
+thermik_context* thermik_create(const char* rules, unsigned int threads) {
+	// Nothing may escape into the caller, it need not be C++.
+	try {
+		const std::string name = rules ? rules : ruleset::akaflieg_dresden::name;
+		if(!ruleset::dispatch(name, [](auto) {})) return nullptr;
+		if(threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+		return new thermik_context(name, threads);
+	} catch(...) {
+		return nullptr;
+	}
+}
+
+void thermik_destroy(thermik_context* context) {
+	delete context;
+}
+
+thermik_status thermik_analyse(
+	thermik_context* context,
+	const void* data,
+	size_t size,
+	thermik_thermal* thermals,
+	size_t capacity,
+	thermik_summary* summary
+) {
+	if(!context || !summary || (!data && size > 0) || (!thermals && capacity > 0)) {
+		return THERMIK_ARGUMENT;
+	}
+
+	analysis::status_t status;
+	try {
+		status = context->context.analyse(std::string_view(static_cast<const char*>(data), size));
+	} catch(const std::bad_alloc&) {
+		*summary = thermik_summary{};
+		return THERMIK_NO_MEMORY;
+	} catch(...) {
+		*summary = thermik_summary{};
+		return THERMIK_INTERNAL;
+	}
+	const auto& flight = context->context.result();
+
+	*summary = thermik_summary{};
+	summary->start_airport = flight.start_airport ? flight.start_airport->name.c_str() : nullptr;
+	summary->thermals = flight.thermals.size();
+	summary->records = flight.parse.records;
+	summary->skipped = flight.parse.skipped;
+	if(status != analysis::status_t::ok) {
+		return convert(status);
+	}
+	summary->local = convert(flight.local);
+	summary->remote = convert(flight.remote);
+
+	const std::size_t n = std::min(capacity, flight.thermals.size());
+	for(std::size_t i = 0; i < n; ++i) {
+		thermals[i] = convert(flight.thermals[i]);
+	}
+	return n < flight.thermals.size() ? THERMIK_TRUNCATED : THERMIK_OK;
+}
+
+const char* thermik_describe(thermik_status status) {
+	switch(status) {
+		case THERMIK_OK: return "in Ordnung";
+		case THERMIK_UNSUPPORTED: return "Kompression oder Archiv wird nicht unterstützt";
+		case THERMIK_DAMAGED: return "Datei ist beschädigt";
+		case THERMIK_INVALID: return "Datei kann nicht gelesen werden";
+		case THERMIK_NO_FIXES: return "keine Fixes";
+		case THERMIK_TRUNCATED: return "mehr Bärte als Platz";
+		case THERMIK_ARGUMENT: return "ungültiges Argument";
+		case THERMIK_NO_MEMORY: return "kein Speicher";
+		case THERMIK_INTERNAL: return "interner Fehler";
+	}
+	return "unbekannter Status";
+}
+
+}
@@ -8,18 +8,26 @@ gps_position::gps_position()
 
 }
 
-double init(const std::string& str) {
+std::int32_t init(const std::string& str) {
 	char dir = *str.rbegin();
-	double sign = (dir == 'N' || dir == 'E') ? 1 : -1;
+	std::int32_t sign = (dir == 'N' || dir == 'E') ? 1 : -1;
 	std::uint8_t lat_size = (dir == 'E' || dir == 'W') ? 3 : 2;
-	double degrees = std::stod(str.substr(0,lat_size));
-	double minutes = std::stod(str.substr(lat_size, 5)) / 1000;
-	return sign * (degrees + minutes / 60);
+	std::int32_t degrees = std::stoi(str.substr(0,lat_size));
+	std::int32_t minutes = std::stoi(str.substr(lat_size, 5));
+	return sign * (degrees * 60000 + minutes);
+}
+
+std::int32_t milliminutes(double degrees) {
+	return static_cast<std::int32_t>(std::lround(degrees * 60000));
+}
+
+double degrees(std::int32_t milliminutes) {
+	return milliminutes / 60000.0;
 }
 
 gps_position::gps_position(double latitude, double longitude) :
-	latitude(latitude),
-	longitude(longitude)
+	latitude(milliminutes(latitude)),
+	longitude(milliminutes(longitude))
 {
 }
 
@@ -31,17 +39,24 @@ gps_position::gps_position(const std::string& latitude, const std::string& longi
 }
 
 gps_position::gps_position(double lat_deg, double lat_min, char n, double lon_deg, double lon_min, char e) :
-    latitude(lat_deg+lat_min/60),
-    longitude(lon_deg+lon_min/60)
+    latitude(milliminutes(lat_deg+lat_min/60)),
+    longitude(milliminutes(lon_deg+lon_min/60))
 {
     if(n=='S') latitude *= -1;
     if(e=='W') longitude *= -1;
 }
 
+gps_position gps_position::from_milliminutes(std::int32_t latitude, std::int32_t longitude) {
+	gps_position result;
+	result.latitude = latitude;
+	result.longitude = longitude;
+	return result;
+}
+
 std::ostream& operator<<(std::ostream& lhs, const gps_position& rhs) {
 	lhs
-		<< std::abs(rhs.latitude) << (rhs.latitude >= 0 ? 'N' : 'S')
-		<< std::abs(rhs.longitude) << (rhs.longitude >= 0 ? 'E' : 'W');
+		<< std::abs(degrees(rhs.latitude)) << (rhs.latitude >= 0 ? 'N' : 'S')
+		<< std::abs(degrees(rhs.longitude)) << (rhs.longitude >= 0 ? 'E' : 'W');
 	return lhs;
 }
 
@@ -55,10 +70,10 @@ constexpr double deg(double rad) {
 
 units::length::meter_t distance(const gps_position& pos1, const gps_position& pos2) {
 	auto R = units::length::kilometer_t(6371.0);
-	auto phi1 = rad(pos1.latitude);
-	auto phi2 = rad(pos2.latitude);
-	auto dphi = rad(pos2.latitude-pos1.latitude);
-	auto dlambda = rad(pos2.longitude-pos1.longitude);
+	auto phi1 = rad(degrees(pos1.latitude));
+	auto phi2 = rad(degrees(pos2.latitude));
+	auto dphi = rad(degrees(pos2.latitude-pos1.latitude));
+	auto dlambda = rad(degrees(pos2.longitude-pos1.longitude));
 
 	auto a = std::sin(dphi/2) * std::sin(dphi/2) +
 			std::cos(phi1) * std::cos(phi2) *
@@ -71,14 +86,13 @@ units::length::meter_t distance(const gps_position& pos1, const gps_position& po
 
 units::angle::degree_t forward_azimuth(const gps_position& pos1, const gps_position& pos2) {
 
-	const auto phi1 = rad(pos1.latitude);
-	const auto lam1 = rad(pos1.longitude);
-	const auto phi2 = rad(pos2.latitude);
-	const auto lam2 = rad(pos2.longitude);
+	const auto phi1 = rad(degrees(pos1.latitude));
+	const auto phi2 = rad(degrees(pos2.latitude));
+	const auto dlam = rad(degrees(pos2.longitude-pos1.longitude));
 
-	auto y = std::sin(lam2-lam1) * std::cos(phi2);
+	auto y = std::sin(dlam) * std::cos(phi2);
 	auto x = std::cos(phi1)*std::sin(phi2) -
-			std::sin(phi1)*std::cos(phi2)*std::cos(lam2-lam1);
+			std::sin(phi1)*std::cos(phi2)*std::cos(dlam);
 	auto brng = deg(std::atan2(y, x));
 
 	return units::angle::degree_t(std::fmod(brng+360, 360));